@@ -0,0 +1,76 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BASE58_CODEC_HPP
+#define BX_BASE58_CODEC_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Encode data as Base58, compatible with bc::encode_base58. The conversion
+ * works on 32 bit words and limbs of five Base58 digits, so it makes about
+ * one twentieth of the passes of the bytewise conversion, and values of up
+ * to 128 bytes (including addresses, WIF and HD keys) are converted without
+ * heap allocation.
+ * @param[in]  data  The data to encode.
+ * @return           The Base58 encoding.
+ */
+BCX_API std::string to_base58(data_slice data);
+
+/**
+ * Decode Base58 text, compatible with bc::decode_base58.
+ * @param[out] out   The decoded data.
+ * @param[in]  text  The Base58 text.
+ * @return           True if the text is valid Base58.
+ */
+BCX_API bool from_base58(data_chunk& out, const std::string& text);
+
+/**
+ * Encode each of a set of values as Base58, concurrently.
+ * @param[in]  values   The data to encode.
+ * @param[in]  threads  The number of threads, zero implies one per core.
+ * @return              The encodings, in the order of the values.
+ */
+BCX_API std::vector<std::string> to_base58_batch(const data_stack& values,
+    size_t threads=1);
+
+/**
+ * Decode each of a set of Base58 texts, concurrently.
+ * @param[out] out      The decoded data, in the order of the texts.
+ * @param[out] invalid  The index of the first text that is not valid.
+ * @param[in]  texts    The Base58 texts.
+ * @param[in]  threads  The number of threads, zero implies one per core.
+ * @return              True if all of the texts are valid.
+ */
+BCX_API bool from_base58_batch(data_stack& out, size_t& invalid,
+    const std::vector<std::string>& texts, size_t threads=1);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_BLOCK_FILE_HPP
+#define BX_BLOCK_FILE_HPP
+
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The network magic of the block records of mainnet block files.
+ */
+BC_CONSTEXPR uint32_t mainnet_block_file_magic = 0xd9b4bef9;
+
+/**
+ * Find the serialized blocks of a block file (blk*.dat), in which each block
+ * is preceded by the network magic and the block size. Bytes that do not
+ * begin a record, such as the zero padding of a preallocated file, are
+ * skipped up to the next occurrence of the magic.
+ * @param[out] out    The serialized blocks, in file order, each a slice of
+ *                    the file contents.
+ * @param[in]  file   The contents of the block file.
+ * @param[in]  magic  The network magic.
+ * @return            False if the last record is truncated, in which case
+ *                    the preceding records are still populated.
+ */
+BCX_API bool read_block_records(std::vector<data_slice>& out,
+    data_slice file, uint32_t magic);
+
+/**
+ * Parse a serialized block in place, without copying its contents.
+ * @param[out] out     The parsed block.
+ * @param[in]  record  The serialized block.
+ * @return             True if the record is a valid block.
+ */
+BCX_API bool parse_block_record(chain::block& out, data_slice record);
+
+/**
+ * Parse the header of a serialized block in place, ignoring its transactions.
+ * @param[out] out     The parsed header.
+ * @param[in]  record  The serialized block.
+ * @return             True if the record begins with a valid header.
+ */
+BCX_API bool parse_block_header(chain::header& out, data_slice record);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,329 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_CHAIN_SCAN_HPP
+#define BX_CHAIN_SCAN_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/header.hpp>
+#include <bitcoin/explorer/config/input.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/output.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/script.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/transaction.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_CHAIN_SCAN_NO_TARGETS \
+    "At least one address or script is required."
+#define BX_CHAIN_SCAN_FILE_NOT_FOUND \
+    "The block file %1% cannot be read."
+#define BX_CHAIN_SCAN_TRUNCATED \
+    "The last block of the file %1% is truncated."
+#define BX_CHAIN_SCAN_INVALID_BLOCK \
+    "The block at offset %2% of the file %1% is not valid."
+
+/**
+ * Class to implement the chain-scan command.
+ */
+class BCX_API chain_scan 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "chain-scan";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return chain_scan::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "WALLET";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Scan block files (blk*.dat) for the outputs and inputs of a set of payment addresses and scripts, without a server. The files are memory mapped and their blocks are parsed concurrently. Each match is written as a line of its kind (output or input), the block hash and the transaction point. An output is followed by its value and an input by its previous output, then the matched address or Base16 script.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("FILE", -1);
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "address,a",
+            value<std::vector<bc::wallet::payment_address>>(&option_.addresses),
+            "The set of payment addresses to match, against output scripts and the signatures of input scripts."
+        )
+        (
+            "magic,m",
+            value<uint32_t>(&option_.magic)->default_value(3652501241),
+            "The network magic of the block records, defaults to 3652501241 (mainnet)."
+        )
+        (
+            "script,s",
+            value<std::vector<explorer::config::script>>(&option_.scripts),
+            "The set of output scripts to match. Multiple tokens must be quoted."
+        )
+        (
+            "threads,t",
+            value<uint32_t>(&option_.threads),
+            "The number of threads, defaults to 0 (one per processor)."
+        )
+        (
+            "FILE",
+            value<std::vector<std::string>>(&argument_.files)->required(),
+            "The set of paths of the block files to scan, in order."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the FILE arguments.
+     */
+    virtual std::vector<std::string>& get_files_argument()
+    {
+        return argument_.files;
+    }
+
+    /**
+     * Set the value of the FILE arguments.
+     */
+    virtual void set_files_argument(
+        const std::vector<std::string>& value)
+    {
+        argument_.files = value;
+    }
+
+    /**
+     * Get the value of the address options.
+     */
+    virtual std::vector<bc::wallet::payment_address>& get_addresses_option()
+    {
+        return option_.addresses;
+    }
+
+    /**
+     * Set the value of the address options.
+     */
+    virtual void set_addresses_option(
+        const std::vector<bc::wallet::payment_address>& value)
+    {
+        option_.addresses = value;
+    }
+
+    /**
+     * Get the value of the magic option.
+     */
+    virtual uint32_t& get_magic_option()
+    {
+        return option_.magic;
+    }
+
+    /**
+     * Set the value of the magic option.
+     */
+    virtual void set_magic_option(
+        const uint32_t& value)
+    {
+        option_.magic = value;
+    }
+
+    /**
+     * Get the value of the script options.
+     */
+    virtual std::vector<explorer::config::script>& get_scripts_option()
+    {
+        return option_.scripts;
+    }
+
+    /**
+     * Set the value of the script options.
+     */
+    virtual void set_scripts_option(
+        const std::vector<explorer::config::script>& value)
+    {
+        option_.scripts = value;
+    }
+
+    /**
+     * Get the value of the threads option.
+     */
+    virtual uint32_t& get_threads_option()
+    {
+        return option_.threads;
+    }
+
+    /**
+     * Set the value of the threads option.
+     */
+    virtual void set_threads_option(
+        const uint32_t& value)
+    {
+        option_.threads = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : files()
+        {
+        }
+
+        std::vector<std::string> files;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : addresses(),
+            magic(),
+            scripts(),
+            threads()
+        {
+        }
+
+        std::vector<bc::wallet::payment_address> addresses;
+        uint32_t magic;
+        std::vector<explorer::config::script> scripts;
+        uint32_t threads;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,288 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_EC_MULTIPLY_BATCH_HPP
+#define BX_EC_MULTIPLY_BATCH_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/header.hpp>
+#include <bitcoin/explorer/config/input.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/output.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/script.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/transaction.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_EC_MULTIPLY_BATCH_INVALID_SECRET \
+    "The secret on line %1% is not a valid EC secret."
+
+/**
+ * Class to implement the ec-multiply-batch command.
+ */
+class BCX_API ec_multiply_batch 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "ec-multiply-batch";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return ec_multiply_batch::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "MATH";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Calculate the EC product (POINT * SECRET) for each of a batch of secrets. The secrets are multiplied concurrently and in constant time.";
+    }
+
+    /**
+     * Determines if STDIN is required to be raw.
+     * @return  True if the type of the STDIN argument is primitive::raw.
+     */
+    virtual bool requires_raw_input()
+    {
+        return true;
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("POINT", 1)
+            .add("SECRETS", 1);
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+        const auto raw = requires_raw_input();
+        load_path(get_secrets_argument(), "SECRETS", variables, raw);
+        load_input(get_secrets_argument(), "SECRETS", variables, input, raw);
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "threads,t",
+            value<uint32_t>(&option_.threads),
+            "The number of threads, defaults to 0 (one per processor)."
+        )
+        (
+            "POINT",
+            value<bc::wallet::ec_public>(&argument_.point)->required(),
+            "The Base16 EC point to multiply."
+        )
+        (
+            "SECRETS",
+            value<std::string>(),
+            "The path to a file of Base16 EC secrets to multiply, one per line. If not specified or '-' the secrets are read from STDIN."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the POINT argument.
+     */
+    virtual bc::wallet::ec_public& get_point_argument()
+    {
+        return argument_.point;
+    }
+
+    /**
+     * Set the value of the POINT argument.
+     */
+    virtual void set_point_argument(
+        const bc::wallet::ec_public& value)
+    {
+        argument_.point = value;
+    }
+
+    /**
+     * Get the value of the SECRETS argument.
+     */
+    virtual explorer::config::raw& get_secrets_argument()
+    {
+        return argument_.secrets;
+    }
+
+    /**
+     * Set the value of the SECRETS argument.
+     */
+    virtual void set_secrets_argument(
+        const explorer::config::raw& value)
+    {
+        argument_.secrets = value;
+    }
+
+    /**
+     * Get the value of the threads option.
+     */
+    virtual uint32_t& get_threads_option()
+    {
+        return option_.threads;
+    }
+
+    /**
+     * Set the value of the threads option.
+     */
+    virtual void set_threads_option(
+        const uint32_t& value)
+    {
+        option_.threads = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : point(),
+            secrets()
+        {
+        }
+
+        bc::wallet::ec_public point;
+        explorer::config::raw secrets;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : threads()
+        {
+        }
+
+        uint32_t threads;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,344 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_EC_TO_EK_BATCH_HPP
+#define BX_EC_TO_EK_BATCH_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/header.hpp>
+#include <bitcoin/explorer/config/input.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/output.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/script.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/transaction.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_EC_TO_EK_BATCH_INVALID_KEY \
+    "The key on line %1% is not a valid EC private key."
+#define BX_EC_TO_EK_BATCH_REQUIRES_ICU \
+    "The command requires an ICU build."
+
+/**
+ * Class to implement the ec-to-ek-batch command.
+ */
+class BCX_API ec_to_ek_batch 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "ec-to-ek-batch";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return ec_to_ek_batch::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "KEY_ENCRYPTION";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Encrypt a batch of EC private keys as encrypted private keys (BIP38), with concurrency bounded by available memory.";
+    }
+
+    /**
+     * Determines if STDIN is required to be raw.
+     * @return  True if the type of the STDIN argument is primitive::raw.
+     */
+    virtual bool requires_raw_input()
+    {
+        return true;
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("PASSPHRASE", 1)
+            .add("EC_PRIVATE_KEYS", 1);
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+        const auto raw = requires_raw_input();
+        load_path(get_ec_private_keys_argument(), "EC_PRIVATE_KEYS", variables, raw);
+        load_input(get_ec_private_keys_argument(), "EC_PRIVATE_KEYS", variables, input, raw);
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "threads,t",
+            value<uint32_t>(&option_.threads),
+            "The maximum number of encryption threads, defaults to 0 (one per processor). Fewer are used if available memory is insufficient."
+        )
+        (
+            "uncompressed,u",
+            value<bool>(&option_.uncompressed)->zero_tokens(),
+            "Use the uncompressed public key format."
+        )
+        (
+            "version,v",
+            value<explorer::config::byte>(&option_.version)->default_value(0),
+            "The desired payment address version."
+        )
+        (
+            "PASSPHRASE",
+            value<std::string>(&argument_.passphrase)->required(),
+            "The passphrase for encrypting the private keys."
+        )
+        (
+            "EC_PRIVATE_KEYS",
+            value<std::string>(),
+            "The path to a file of Base16 EC private keys to encrypt, one per line. If not specified or '-' the keys are read from STDIN."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+        const auto& option_version = variables["version"];
+        const auto& option_version_config = variables["wallet.pay_to_public_key_hash_version"];
+        if (option_version.defaulted() && !option_version_config.defaulted())
+        {
+            option_.version = option_version_config.as<explorer::config::byte>();
+        }
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the PASSPHRASE argument.
+     */
+    virtual std::string& get_passphrase_argument()
+    {
+        return argument_.passphrase;
+    }
+
+    /**
+     * Set the value of the PASSPHRASE argument.
+     */
+    virtual void set_passphrase_argument(
+        const std::string& value)
+    {
+        argument_.passphrase = value;
+    }
+
+    /**
+     * Get the value of the EC_PRIVATE_KEYS argument.
+     */
+    virtual explorer::config::raw& get_ec_private_keys_argument()
+    {
+        return argument_.ec_private_keys;
+    }
+
+    /**
+     * Set the value of the EC_PRIVATE_KEYS argument.
+     */
+    virtual void set_ec_private_keys_argument(
+        const explorer::config::raw& value)
+    {
+        argument_.ec_private_keys = value;
+    }
+
+    /**
+     * Get the value of the threads option.
+     */
+    virtual uint32_t& get_threads_option()
+    {
+        return option_.threads;
+    }
+
+    /**
+     * Set the value of the threads option.
+     */
+    virtual void set_threads_option(
+        const uint32_t& value)
+    {
+        option_.threads = value;
+    }
+
+    /**
+     * Get the value of the uncompressed option.
+     */
+    virtual bool& get_uncompressed_option()
+    {
+        return option_.uncompressed;
+    }
+
+    /**
+     * Set the value of the uncompressed option.
+     */
+    virtual void set_uncompressed_option(
+        const bool& value)
+    {
+        option_.uncompressed = value;
+    }
+
+    /**
+     * Get the value of the version option.
+     */
+    virtual explorer::config::byte& get_version_option()
+    {
+        return option_.version;
+    }
+
+    /**
+     * Set the value of the version option.
+     */
+    virtual void set_version_option(
+        const explorer::config::byte& value)
+    {
+        option_.version = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : passphrase(),
+            ec_private_keys()
+        {
+        }
+
+        std::string passphrase;
+        explorer::config::raw ec_private_keys;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : threads(),
+            uncompressed(),
+            version()
+        {
+        }
+
+        uint32_t threads;
+        bool uncompressed;
+        explorer::config::byte version;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
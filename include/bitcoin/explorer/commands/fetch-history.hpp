@@ -56,6 +56,12 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_FETCH_HISTORY_INVALID_INDEX \
+    "The chain index %1% cannot be read."
+
 /**
  * Class to implement the fetch-history command.
  */
@@ -94,7 +100,7 @@ public:
      */
     virtual const char* description()
     {
-        return "Get list of output points, values, and spends for a payment address. Requires a Libbitcoin/Obelisk server connection.";
+        return "Get list of output points, values, and spends for a payment address. Requires a Libbitcoin/Obelisk server connection, or a chain-index with the offline option.";
     }
 
     /**
@@ -145,6 +151,16 @@ public:
             value<explorer::config::encoding>(&option_.format),
             "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
         )
+        (
+            "index,i",
+            value<std::string>(&option_.index)->default_value("chain-index"),
+            "The path of the chain-index directory used by the offline option, defaults to 'chain-index'."
+        )
+        (
+            "offline,o",
+            value<bool>(&option_.offline)->zero_tokens(),
+            "Answer from the local chain-index rather than a server."
+        )
         (
             "PAYMENT_ADDRESS",
             value<bc::wallet::payment_address>(&argument_.payment_address),
@@ -207,6 +223,40 @@ public:
         option_.format = value;
     }
 
+    /**
+     * Get the value of the index option.
+     */
+    virtual std::string& get_index_option()
+    {
+        return option_.index;
+    }
+
+    /**
+     * Set the value of the index option.
+     */
+    virtual void set_index_option(
+        const std::string& value)
+    {
+        option_.index = value;
+    }
+
+    /**
+     * Get the value of the offline option.
+     */
+    virtual bool& get_offline_option()
+    {
+        return option_.offline;
+    }
+
+    /**
+     * Set the value of the offline option.
+     */
+    virtual void set_offline_option(
+        const bool& value)
+    {
+        option_.offline = value;
+    }
+
 private:
 
     /**
@@ -232,11 +282,15 @@ private:
     struct option
     {
         option()
-          : format()
+          : format(),
+            index(),
+            offline()
         {
         }
 
         explorer::config::encoding format;
+        std::string index;
+        bool offline;
     } option_;
 };
 
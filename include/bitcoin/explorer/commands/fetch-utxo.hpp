@@ -56,6 +56,12 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_FETCH_UTXO_INVALID_INDEX \
+    "The chain index %1% cannot be read."
+
 /**
  * Class to implement the fetch-utxo command.
  */
@@ -101,7 +107,7 @@ public:
      */
     virtual const char* description()
     {
-        return "Get enough unspent transaction outputs from a payment address to pay a number of satoshi. Requires a Libbitcoin server connection.";
+        return "Get enough unspent transaction outputs from a payment address to pay a number of satoshi. Requires a Libbitcoin server connection, or a chain-index with the offline option.";
     }
 
     /**
@@ -158,6 +164,16 @@ public:
             value<explorer::config::algorithm>(&option_.algorithm),
             "The algorithm for unspent output selection. Options are 'greedy', defaults to 'greedy'"
         )
+        (
+            "index,i",
+            value<std::string>(&option_.index)->default_value("chain-index"),
+            "The path of the chain-index directory used by the offline option, defaults to 'chain-index'."
+        )
+        (
+            "offline,o",
+            value<bool>(&option_.offline)->zero_tokens(),
+            "Answer from the local chain-index rather than a server."
+        )
         (
             "SATOSHI",
             value<uint64_t>(&argument_.satoshi)->required(),
@@ -259,6 +275,40 @@ public:
         option_.algorithm = value;
     }
 
+    /**
+     * Get the value of the index option.
+     */
+    virtual std::string& get_index_option()
+    {
+        return option_.index;
+    }
+
+    /**
+     * Set the value of the index option.
+     */
+    virtual void set_index_option(
+        const std::string& value)
+    {
+        option_.index = value;
+    }
+
+    /**
+     * Get the value of the offline option.
+     */
+    virtual bool& get_offline_option()
+    {
+        return option_.offline;
+    }
+
+    /**
+     * Set the value of the offline option.
+     */
+    virtual void set_offline_option(
+        const bool& value)
+    {
+        option_.offline = value;
+    }
+
 private:
 
     /**
@@ -287,12 +337,16 @@ private:
     {
         option()
           : format(),
-            algorithm()
+            algorithm(),
+            index(),
+            offline()
         {
         }
 
         explorer::config::encoding format;
         explorer::config::algorithm algorithm;
+        std::string index;
+        bool offline;
     } option_;
 };
 
@@ -56,6 +56,12 @@ namespace libbitcoin {
 namespace explorer {
 namespace commands {
 
+/**
+ * Various localizable strings.
+ */
+#define BX_HD_PRIVATE_INVALID_PATH \
+    "The path is not valid."
+
 /**
  * Class to implement the hd-private command.
  */
@@ -150,6 +156,11 @@ public:
             value<uint32_t>(&option_.index),
             "The HD index, defaults to 0."
         )
+        (
+            "path,p",
+            value<std::string>(&option_.path),
+            "The derivation path of the child from the parent key, as indexes separated by '/', each followed by an apostrophe if hardened, such as 44'/0'/0'/0/0. Overrides the index and hard options."
+        )
         (
             "HD_PRIVATE_KEY",
             value<bc::wallet::hd_private>(&argument_.hd_private_key),
@@ -229,6 +240,23 @@ public:
         option_.index = value;
     }
 
+    /**
+     * Get the value of the path option.
+     */
+    virtual std::string& get_path_option()
+    {
+        return option_.path;
+    }
+
+    /**
+     * Set the value of the path option.
+     */
+    virtual void set_path_option(
+        const std::string& value)
+    {
+        option_.path = value;
+    }
+
 private:
 
     /**
@@ -255,12 +283,14 @@ private:
     {
         option()
           : hard(),
-            index()
+            index(),
+            path()
         {
         }
 
         bool hard;
         uint32_t index;
+        std::string path;
     } option_;
 };
 
@@ -61,6 +61,12 @@ namespace commands {
  */
 #define BX_HD_PUBLIC_HARD_OPTION_CONFLICT \
     "The hard option requires a private key."
+#define BX_HD_PUBLIC_HARD_PATH_CONFLICT \
+    "The hardened path requires a private key."
+#define BX_HD_PUBLIC_INVALID_PATH \
+    "The path is not valid."
+#define BX_HD_PUBLIC_CACHE_NOT_WRITTEN \
+    "The cache could not be written."
 
 /**
  * Class to implement the hd-public command.
@@ -146,6 +152,11 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "cache,f",
+            value<std::string>(&option_.cache),
+            "The path to a file of public keys at intermediate paths, used with the path option. A key is derived from its deepest cached ancestor and the cache is extended with its parent. Private keys are never cached."
+        )
         (
             "hard,d",
             value<bool>(&option_.hard)->zero_tokens(),
@@ -156,6 +167,11 @@ public:
             value<uint32_t>(&option_.index),
             "The HD index, defaults to 0."
         )
+        (
+            "path,a",
+            value<std::string>(&option_.path),
+            "The derivation path of the child from the parent key, as indexes separated by '/', each followed by an apostrophe if hardened, such as 44'/0'/0'/0/0. Overrides the index and hard options."
+        )
         (
             "secret_version,s",
             value<uint32_t>(&option_.secret_version)->default_value(76066276),
@@ -224,6 +240,23 @@ public:
         argument_.hd_key = value;
     }
 
+    /**
+     * Get the value of the cache option.
+     */
+    virtual std::string& get_cache_option()
+    {
+        return option_.cache;
+    }
+
+    /**
+     * Set the value of the cache option.
+     */
+    virtual void set_cache_option(
+        const std::string& value)
+    {
+        option_.cache = value;
+    }
+
     /**
      * Get the value of the hard option.
      */
@@ -258,6 +291,23 @@ public:
         option_.index = value;
     }
 
+    /**
+     * Get the value of the path option.
+     */
+    virtual std::string& get_path_option()
+    {
+        return option_.path;
+    }
+
+    /**
+     * Set the value of the path option.
+     */
+    virtual void set_path_option(
+        const std::string& value)
+    {
+        option_.path = value;
+    }
+
     /**
      * Get the value of the secret_version option.
      */
@@ -317,15 +367,19 @@ private:
     struct option
     {
         option()
-          : hard(),
+          : cache(),
+            hard(),
             index(),
+            path(),
             secret_version(),
             public_version()
         {
         }
 
+        std::string cache;
         bool hard;
         uint32_t index;
+        std::string path;
         uint32_t secret_version;
         uint32_t public_version;
     } option_;
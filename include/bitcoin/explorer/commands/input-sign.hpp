@@ -162,6 +162,11 @@ public:
             value<bool>(&option_.anyone)->zero_tokens(),
             "Modify signature hashing so that other inputs are ignored."
         )
+        (
+            "binary,b",
+            value<bool>(&option_.binary)->zero_tokens(),
+            "Read the transaction from STDIN in its binary (wire) encoding rather than as Base16. A regular file redirected to STDIN is memory mapped and parsed in place."
+        )
         (
             "index,i",
             value<uint32_t>(&option_.index),
@@ -278,6 +283,23 @@ public:
         option_.anyone = value;
     }
 
+    /**
+     * Get the value of the binary option.
+     */
+    virtual bool& get_binary_option()
+    {
+        return option_.binary;
+    }
+
+    /**
+     * Set the value of the binary option.
+     */
+    virtual void set_binary_option(
+        const bool& value)
+    {
+        option_.binary = value;
+    }
+
     /**
      * Get the value of the index option.
      */
@@ -342,12 +364,14 @@ private:
     {
         option()
           : anyone(),
+            binary(),
             index(),
             sign_type()
         {
         }
 
         bool anyone;
+        bool binary;
         uint32_t index;
         explorer::config::hashtype sign_type;
     } option_;
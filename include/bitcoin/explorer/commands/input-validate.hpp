@@ -160,6 +160,11 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "binary,b",
+            value<bool>(&option_.binary)->zero_tokens(),
+            "Read the transaction from STDIN in its binary (wire) encoding rather than as Base16. A regular file redirected to STDIN is memory mapped and parsed in place."
+        )
         (
             "index,i",
             value<uint32_t>(&option_.index),
@@ -276,6 +281,23 @@ public:
         argument_.transaction = value;
     }
 
+    /**
+     * Get the value of the binary option.
+     */
+    virtual bool& get_binary_option()
+    {
+        return option_.binary;
+    }
+
+    /**
+     * Set the value of the binary option.
+     */
+    virtual void set_binary_option(
+        const bool& value)
+    {
+        option_.binary = value;
+    }
+
     /**
      * Get the value of the index option.
      */
@@ -324,10 +346,12 @@ private:
     struct option
     {
         option()
-          : index()
+          : binary(),
+            index()
         {
         }
 
+        bool binary;
         uint32_t index;
     } option_;
 };
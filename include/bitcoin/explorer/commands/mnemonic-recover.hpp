@@ -0,0 +1,389 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_MNEMONIC_RECOVER_HPP
+#define BX_MNEMONIC_RECOVER_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/header.hpp>
+#include <bitcoin/explorer/config/input.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/output.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/script.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/transaction.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_MNEMONIC_RECOVER_LENGTH_INVALID_SENTENCE \
+    "The number of words must be divisible by 3."
+#define BX_MNEMONIC_RECOVER_PASSPHRASE_UNSUPPORTED \
+    "The passphrase option requires an ICU build."
+#define BX_MNEMONIC_RECOVER_TARGET_REQUIRED \
+    "Either the address or the key option must be specified."
+#define BX_MNEMONIC_RECOVER_INVALID_PATH \
+    "The path is not valid."
+#define BX_MNEMONIC_RECOVER_INVALID_IN_LANGUAGES \
+    "The known words are not all in any one of the dictionaries."
+#define BX_MNEMONIC_RECOVER_TOO_MANY_CANDIDATES \
+    "There are too many candidate mnemonics to search."
+#define BX_MNEMONIC_RECOVER_NOT_FOUND \
+    "No candidate mnemonic derives the target."
+#define BX_MNEMONIC_RECOVER_PROGRESS \
+    "Checked %1% of %2% candidates, derived %3% seeds (%4% seeds per second)."
+#define BX_MNEMONIC_RECOVER_RATE \
+    "Checked %1% candidates and derived %2% seeds in %3% seconds (%4% seeds per second)."
+
+/**
+ * Class to implement the mnemonic-recover command.
+ */
+class BCX_API mnemonic_recover 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "mnemonic-recover";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return mnemonic_recover::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "WALLET";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Recover a mnemonic seed (BIP39) with unknown words, given a payment address or HD (BIP32) public key derived from its seed. Candidate mnemonics are first checked against the mnemonic checksum, and the seeds of those that pass are derived across all processors. Progress is reported to STDERR.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("WORD", -1);
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+        const auto raw = requires_raw_input();
+        load_input(get_words_argument(), "WORD", variables, input, raw);
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "address,a",
+            value<bc::wallet::payment_address>(&option_.address),
+            "The payment address of the HD key at the path, as created by hd-to-ec and ec-to-address."
+        )
+        (
+            "key,k",
+            value<bc::wallet::hd_public>(&option_.key),
+            "The HD public key at the path, as created by hd-public."
+        )
+        (
+            "language,l",
+            value<explorer::config::language>(&option_.language),
+            "The language identifier of the dictionary of the mnemonic. Options are 'en', 'es', 'ja', 'zh_Hans', 'zh_Hant' and 'any', defaults to 'any'."
+        )
+        (
+            "passphrase,p",
+            value<std::string>(&option_.passphrase),
+            "An optional passphrase for converting the mnemonic to a seed."
+        )
+        (
+            "path,d",
+            value<std::string>(&option_.path),
+            "The derivation path of the target from the master HD key, as indexes separated by '/', each followed by an apostrophe if hardened, such as 44'/0'/0'/0/0. Defaults to the master key."
+        )
+        (
+            "threads,t",
+            value<uint32_t>(&option_.threads),
+            "The number of derivation threads, defaults to 0 (one per processor)."
+        )
+        (
+            "WORD",
+            value<std::vector<std::string>>(&argument_.words),
+            "The set of words that make up the mnemonic. An unknown word is specified as '?' and a word known only by its leading letters as the letters followed by '*'. A word that is not in the dictionary is also treated as unknown. If not specified the words are read from STDIN."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the WORD arguments.
+     */
+    virtual std::vector<std::string>& get_words_argument()
+    {
+        return argument_.words;
+    }
+
+    /**
+     * Set the value of the WORD arguments.
+     */
+    virtual void set_words_argument(
+        const std::vector<std::string>& value)
+    {
+        argument_.words = value;
+    }
+
+    /**
+     * Get the value of the address option.
+     */
+    virtual bc::wallet::payment_address& get_address_option()
+    {
+        return option_.address;
+    }
+
+    /**
+     * Set the value of the address option.
+     */
+    virtual void set_address_option(
+        const bc::wallet::payment_address& value)
+    {
+        option_.address = value;
+    }
+
+    /**
+     * Get the value of the key option.
+     */
+    virtual bc::wallet::hd_public& get_key_option()
+    {
+        return option_.key;
+    }
+
+    /**
+     * Set the value of the key option.
+     */
+    virtual void set_key_option(
+        const bc::wallet::hd_public& value)
+    {
+        option_.key = value;
+    }
+
+    /**
+     * Get the value of the language option.
+     */
+    virtual explorer::config::language& get_language_option()
+    {
+        return option_.language;
+    }
+
+    /**
+     * Set the value of the language option.
+     */
+    virtual void set_language_option(
+        const explorer::config::language& value)
+    {
+        option_.language = value;
+    }
+
+    /**
+     * Get the value of the passphrase option.
+     */
+    virtual std::string& get_passphrase_option()
+    {
+        return option_.passphrase;
+    }
+
+    /**
+     * Set the value of the passphrase option.
+     */
+    virtual void set_passphrase_option(
+        const std::string& value)
+    {
+        option_.passphrase = value;
+    }
+
+    /**
+     * Get the value of the path option.
+     */
+    virtual std::string& get_path_option()
+    {
+        return option_.path;
+    }
+
+    /**
+     * Set the value of the path option.
+     */
+    virtual void set_path_option(
+        const std::string& value)
+    {
+        option_.path = value;
+    }
+
+    /**
+     * Get the value of the threads option.
+     */
+    virtual uint32_t& get_threads_option()
+    {
+        return option_.threads;
+    }
+
+    /**
+     * Set the value of the threads option.
+     */
+    virtual void set_threads_option(
+        const uint32_t& value)
+    {
+        option_.threads = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : words()
+        {
+        }
+
+        std::vector<std::string> words;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : address(),
+            key(),
+            language(),
+            passphrase(),
+            path(),
+            threads()
+        {
+        }
+
+        bc::wallet::payment_address address;
+        bc::wallet::hd_public key;
+        explorer::config::language language;
+        std::string passphrase;
+        std::string path;
+        uint32_t threads;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -153,6 +153,11 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "binary,b",
+            value<bool>(&option_.binary)->zero_tokens(),
+            "Read the transaction from STDIN in its binary (wire) encoding rather than as Base16. A regular file redirected to STDIN is memory mapped and parsed in place."
+        )
         (
             "host,t",
             value<std::string>(&option_.host)->default_value("localhost"),
@@ -208,6 +213,23 @@ public:
         argument_.transaction = value;
     }
 
+    /**
+     * Get the value of the binary option.
+     */
+    virtual bool& get_binary_option()
+    {
+        return option_.binary;
+    }
+
+    /**
+     * Set the value of the binary option.
+     */
+    virtual void set_binary_option(
+        const bool& value)
+    {
+        option_.binary = value;
+    }
+
     /**
      * Get the value of the host option.
      */
@@ -267,11 +289,13 @@ private:
     struct option
     {
         option()
-          : host(),
+          : binary(),
+            host(),
             port()
         {
         }
 
+        bool binary;
         std::string host;
         uint16_t port;
     } option_;
@@ -153,6 +153,11 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "binary,b",
+            value<bool>(&option_.binary)->zero_tokens(),
+            "Read the transaction from STDIN in its binary (wire) encoding rather than as Base16. A regular file redirected to STDIN is memory mapped and parsed in place."
+        )
         (
             "nodes,n",
             value<size_t>(&option_.nodes)->default_value(2),
@@ -203,6 +208,23 @@ public:
         argument_.transaction = value;
     }
 
+    /**
+     * Get the value of the binary option.
+     */
+    virtual bool& get_binary_option()
+    {
+        return option_.binary;
+    }
+
+    /**
+     * Set the value of the binary option.
+     */
+    virtual void set_binary_option(
+        const bool& value)
+    {
+        option_.binary = value;
+    }
+
     /**
      * Get the value of the nodes option.
      */
@@ -245,10 +267,12 @@ private:
     struct option
     {
         option()
-          : nodes()
+          : binary(),
+            nodes()
         {
         }
 
+        bool binary;
         size_t nodes;
     } option_;
 };
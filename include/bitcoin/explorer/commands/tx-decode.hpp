@@ -140,6 +140,11 @@ public:
             value<boost::filesystem::path>(),
             "The path to the configuration settings file."
         )
+        (
+            "binary,b",
+            value<bool>(&option_.binary)->zero_tokens(),
+            "Read the transaction from STDIN in its binary (wire) encoding rather than as Base16. A regular file redirected to STDIN is memory mapped and parsed in place."
+        )
         (
             "format,f",
             value<explorer::config::encoding>(&option_.format),
@@ -190,6 +195,23 @@ public:
         argument_.transaction = value;
     }
 
+    /**
+     * Get the value of the binary option.
+     */
+    virtual bool& get_binary_option()
+    {
+        return option_.binary;
+    }
+
+    /**
+     * Set the value of the binary option.
+     */
+    virtual void set_binary_option(
+        const bool& value)
+    {
+        option_.binary = value;
+    }
+
     /**
      * Get the value of the format option.
      */
@@ -232,10 +254,12 @@ private:
     struct option
     {
         option()
-          : format()
+          : binary(),
+            format()
         {
         }
 
+        bool binary;
         explorer::config::encoding format;
     } option_;
 };
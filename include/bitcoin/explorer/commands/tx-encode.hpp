@@ -61,6 +61,12 @@ namespace commands {
  */
 #define BX_TX_ENCODE_INVALID_OUTPUT \
     "An output is not valid."
+#define BX_TX_ENCODE_MANIFEST_NOT_FOUND \
+    "The manifest %1% cannot be read."
+#define BX_TX_ENCODE_INVALID_MANIFEST \
+    "Line %2% of the manifest %1% is not valid."
+#define BX_TX_ENCODE_ESTIMATE \
+    "The signed transaction is at most %1% bytes, for a fee of %2% satoshi."
 #define BX_TX_ENCODE_LOCKTIME_CONFLICT \
     "The specified lock time is ineffective because all sequences are set to the maximum value."
 
@@ -102,7 +108,7 @@ public:
      */
     virtual const char* description()
     {
-        return "Encode an unsigned transaction as Base16.";
+        return "Encode an unsigned transaction as Base16. Large sets of inputs and outputs may be read from a manifest file.";
     }
 
     /**
@@ -169,6 +175,21 @@ public:
             "output,o",
             value<std::vector<explorer::config::output>>(&option_.outputs),
             "The set of transaction output data encoded as TARGET:SATOSHI:SEED. TARGET is an address (including stealth or pay-to-script-hash) or a Base16 script. SATOSHI is the 64 bit spend amount in satoshi. SEED is required for stealth outputs and not used otherwise. The same seed should NOT be used for multiple outputs."
+        )
+        (
+            "manifest,m",
+            value<std::string>(&option_.manifest),
+            "The path of a manifest of inputs and outputs, which follow those of the input and output options. Each line is either comma-separated values, as 'input,TXHASH,INDEX[,SEQUENCE]' or 'output,TARGET,SATOSHI', or a JSON object with the 'hash', 'index' and optional 'sequence' of an input or the 'target' and 'amount' of an output. TARGET is a payment address or a Base16 script, stealth addresses are not supported in a manifest. Empty lines and lines that begin with '#' are ignored."
+        )
+        (
+            "estimate,e",
+            value<bool>(&option_.estimate)->zero_tokens(),
+            "Write the estimated size and fee of the signed transaction rather than the transaction. Each input is presumed to spend a pay-to-public-key-hash output with a compressed key, so the size is an upper bound for such inputs."
+        )
+        (
+            "fee_rate,f",
+            value<uint64_t>(&option_.fee_rate),
+            "The fee rate of the estimate in satoshi per byte, defaults to 0."
         );
 
         return options;
@@ -291,6 +312,57 @@ public:
         option_.outputs = value;
     }
 
+    /**
+     * Get the value of the manifest option.
+     */
+    virtual std::string& get_manifest_option()
+    {
+        return option_.manifest;
+    }
+
+    /**
+     * Set the value of the manifest option.
+     */
+    virtual void set_manifest_option(
+        const std::string& value)
+    {
+        option_.manifest = value;
+    }
+
+    /**
+     * Get the value of the estimate option.
+     */
+    virtual bool& get_estimate_option()
+    {
+        return option_.estimate;
+    }
+
+    /**
+     * Set the value of the estimate option.
+     */
+    virtual void set_estimate_option(
+        const bool& value)
+    {
+        option_.estimate = value;
+    }
+
+    /**
+     * Get the value of the fee_rate option.
+     */
+    virtual uint64_t& get_fee_rate_option()
+    {
+        return option_.fee_rate;
+    }
+
+    /**
+     * Set the value of the fee_rate option.
+     */
+    virtual void set_fee_rate_option(
+        const uint64_t& value)
+    {
+        option_.fee_rate = value;
+    }
+
 private:
 
     /**
@@ -318,7 +390,10 @@ private:
             lock_time(),
             version(),
             inputs(),
-            outputs()
+            outputs(),
+            manifest(),
+            estimate(),
+            fee_rate()
         {
         }
 
@@ -327,6 +402,9 @@ private:
         uint32_t version;
         std::vector<explorer::config::input> inputs;
         std::vector<explorer::config::output> outputs;
+        std::string manifest;
+        bool estimate;
+        uint64_t fee_rate;
     } option_;
 };
 
@@ -0,0 +1,354 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_TX_ESTIMATE_HPP
+#define BX_TX_ESTIMATE_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/header.hpp>
+#include <bitcoin/explorer/config/input.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/output.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/script.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/transaction.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_TX_ESTIMATE_TYPE_COUNT_MISMATCH \
+    "The number of script types must be zero, one or equal to the number of inputs."
+#define BX_TX_ESTIMATE_INVALID_TYPE \
+    "The script type %1% is not valid."
+
+/**
+ * Class to implement the tx-estimate command.
+ */
+class BCX_API tx_estimate 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "tx-estimate";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return tx_estimate::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "TRANSACTION";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Estimate the size, virtual size and fee of a transaction once its inputs are signed, without encoding it. The inputs and outputs are those of tx-encode, with the expected script type of each input.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata();
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "fee_rate,r",
+            value<uint64_t>(&option_.fee_rate),
+            "The fee rate in satoshi per virtual byte, defaults to 0."
+        )
+        (
+            "format,f",
+            value<explorer::config::encoding>(&option_.format),
+            "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
+        )
+        (
+            "script_type,t",
+            value<std::vector<std::string>>(&option_.script_types),
+            "The set of expected input script types, one per input in input order. A single type applies to all inputs. Options are 'p2pkh', 'p2pkh-uncompressed', 'p2pk', 'p2wpkh', 'p2sh-p2wpkh' and 'p2sh-multisig:M:N' (M signatures of N compressed keys), defaults to 'p2pkh'."
+        )
+        (
+            "script_version,s",
+            value<explorer::config::byte>(&option_.script_version)->default_value(5),
+            "The pay-to-script-hash payment address version, defaults to 5. This is used to differentiate output addresses."
+        )
+        (
+            "input,i",
+            value<std::vector<explorer::config::input>>(&option_.inputs),
+            "The set of transaction input points encoded as TXHASH:INDEX:SEQUENCE. TXHASH is a Base16 transaction hash. INDEX is the 32 bit input index in the context of the transaction. SEQUENCE is the optional 32 bit input sequence and defaults to the maximum value."
+        )
+        (
+            "output,o",
+            value<std::vector<explorer::config::output>>(&option_.outputs),
+            "The set of transaction output data encoded as TARGET:SATOSHI:SEED. TARGET is an address (including stealth or pay-to-script-hash) or a Base16 script. SATOSHI is the 64 bit spend amount in satoshi. SEED is required for stealth outputs and not used otherwise."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+        const auto& option_script_version = variables["script_version"];
+        const auto& option_script_version_config = variables["wallet.pay_to_script_hash_version"];
+        if (option_script_version.defaulted() && !option_script_version_config.defaulted())
+        {
+            option_.script_version = option_script_version_config.as<explorer::config::byte>();
+        }
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the fee_rate option.
+     */
+    virtual uint64_t& get_fee_rate_option()
+    {
+        return option_.fee_rate;
+    }
+
+    /**
+     * Set the value of the fee_rate option.
+     */
+    virtual void set_fee_rate_option(
+        const uint64_t& value)
+    {
+        option_.fee_rate = value;
+    }
+
+    /**
+     * Get the value of the format option.
+     */
+    virtual explorer::config::encoding& get_format_option()
+    {
+        return option_.format;
+    }
+
+    /**
+     * Set the value of the format option.
+     */
+    virtual void set_format_option(
+        const explorer::config::encoding& value)
+    {
+        option_.format = value;
+    }
+
+    /**
+     * Get the value of the script_type options.
+     */
+    virtual std::vector<std::string>& get_script_types_option()
+    {
+        return option_.script_types;
+    }
+
+    /**
+     * Set the value of the script_type options.
+     */
+    virtual void set_script_types_option(
+        const std::vector<std::string>& value)
+    {
+        option_.script_types = value;
+    }
+
+    /**
+     * Get the value of the script_version option.
+     */
+    virtual explorer::config::byte& get_script_version_option()
+    {
+        return option_.script_version;
+    }
+
+    /**
+     * Set the value of the script_version option.
+     */
+    virtual void set_script_version_option(
+        const explorer::config::byte& value)
+    {
+        option_.script_version = value;
+    }
+
+    /**
+     * Get the value of the input options.
+     */
+    virtual std::vector<explorer::config::input>& get_inputs_option()
+    {
+        return option_.inputs;
+    }
+
+    /**
+     * Set the value of the input options.
+     */
+    virtual void set_inputs_option(
+        const std::vector<explorer::config::input>& value)
+    {
+        option_.inputs = value;
+    }
+
+    /**
+     * Get the value of the output options.
+     */
+    virtual std::vector<explorer::config::output>& get_outputs_option()
+    {
+        return option_.outputs;
+    }
+
+    /**
+     * Set the value of the output options.
+     */
+    virtual void set_outputs_option(
+        const std::vector<explorer::config::output>& value)
+    {
+        option_.outputs = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+        {
+        }
+
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : fee_rate(),
+            format(),
+            script_types(),
+            script_version(),
+            inputs(),
+            outputs()
+        {
+        }
+
+        uint64_t fee_rate;
+        explorer::config::encoding format;
+        std::vector<std::string> script_types;
+        explorer::config::byte script_version;
+        std::vector<explorer::config::input> inputs;
+        std::vector<explorer::config::output> outputs;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -59,8 +59,16 @@ namespace commands {
 /**
  * Various localizable strings.
  */
-#define BX_TX_SIGN_NOT_IMPLEMENTED \
-    "This command is not yet implemented."
+#define BX_TX_SIGN_KEY_COUNT_MISMATCH \
+    "The number of keys must be one or equal to the number of inputs."
+#define BX_TX_SIGN_PREVOUT_COUNT_MISMATCH \
+    "The number of previous output scripts must be one or equal to the number of inputs."
+#define BX_TX_SIGN_UNSUPPORTED_PREVOUT \
+    "The previous output script for input %1% is not pay-to-public-key or pay-to-public-key-hash."
+#define BX_TX_SIGN_KEY_MISMATCH \
+    "The key for input %1% does not correspond to its previous output script."
+#define BX_TX_SIGN_FAILED \
+    "The signing operation failed for input %1%."
 
 /**
  * Class to implement the tx-sign command.
@@ -107,7 +115,7 @@ public:
      */
     virtual const char* description()
     {
-        return "Sign a set of transactions using a private key. Output is suitable for sending to Bitcoin network.";
+        return "Sign all inputs of a transaction. Inputs are signed concurrently and the transaction is serialized once. Output is suitable for sending to Bitcoin network.";
     }
 
     /**
@@ -118,8 +126,7 @@ public:
     virtual arguments_metadata& load_arguments()
     {
         return get_argument_metadata()
-            .add("EC_PRIVATE_KEY", 1)
-            .add("TRANSACTION", -1);
+            .add("TRANSACTION", 1);
     }
 
 	/**
@@ -131,7 +138,7 @@ public:
         po::variables_map& variables)
     {
         const auto raw = requires_raw_input();
-        load_input(get_transactions_argument(), "TRANSACTION", variables, input, raw);
+        load_input(get_transaction_argument(), "TRANSACTION", variables, input, raw);
     }
 
     /**
@@ -155,14 +162,39 @@ public:
             "The path to the configuration settings file."
         )
         (
-            "EC_PRIVATE_KEY",
-            value<explorer::config::ec_private>(&argument_.ec_private_key)->required(),
-            "The EC private key to be used for signing."
+            "anyone,a",
+            value<bool>(&option_.anyone)->zero_tokens(),
+            "Modify signature hashing so that other inputs are ignored."
+        )
+        (
+            "binary,b",
+            value<bool>(&option_.binary)->zero_tokens(),
+            "Read the transaction from STDIN in its binary (wire) encoding rather than as Base16. A regular file redirected to STDIN is memory mapped and parsed in place."
+        )
+        (
+            "key,k",
+            value<std::vector<explorer::config::ec_private>>(&option_.keys),
+            "The set of Base16 EC private keys to sign with, one per input in input order. A single key signs all inputs."
+        )
+        (
+            "prevout,p",
+            value<std::vector<explorer::config::script>>(&option_.prevouts),
+            "The set of previous output scripts to use in signing, one per input in input order. A single script applies to all inputs. Multiple tokens must be quoted."
+        )
+        (
+            "sign_type,s",
+            value<explorer::config::hashtype>(&option_.sign_type),
+            "A token that indicates how the transaction should be hashed for signing. Options are 'all', 'none', and 'single', defaults to 'all'."
+        )
+        (
+            "threads,t",
+            value<uint32_t>(&option_.threads),
+            "The number of signing threads, defaults to 0 (one per processor)."
         )
         (
             "TRANSACTION",
-            value<std::vector<explorer::config::transaction>>(&argument_.transactions),
-            "The set of Base16 transactions. If not specified the transactions are read from STDIN."
+            value<explorer::config::transaction>(&argument_.transaction),
+            "The Base16 transaction. If not specified the transaction is read from STDIN."
         );
 
         return options;
@@ -188,37 +220,122 @@ public:
     /* Properties */
 
     /**
-     * Get the value of the EC_PRIVATE_KEY argument.
+     * Get the value of the TRANSACTION argument.
+     */
+    virtual explorer::config::transaction& get_transaction_argument()
+    {
+        return argument_.transaction;
+    }
+
+    /**
+     * Set the value of the TRANSACTION argument.
+     */
+    virtual void set_transaction_argument(
+        const explorer::config::transaction& value)
+    {
+        argument_.transaction = value;
+    }
+
+    /**
+     * Get the value of the anyone option.
+     */
+    virtual bool& get_anyone_option()
+    {
+        return option_.anyone;
+    }
+
+    /**
+     * Set the value of the anyone option.
+     */
+    virtual void set_anyone_option(
+        const bool& value)
+    {
+        option_.anyone = value;
+    }
+
+    /**
+     * Get the value of the binary option.
+     */
+    virtual bool& get_binary_option()
+    {
+        return option_.binary;
+    }
+
+    /**
+     * Set the value of the binary option.
+     */
+    virtual void set_binary_option(
+        const bool& value)
+    {
+        option_.binary = value;
+    }
+
+    /**
+     * Get the value of the key options.
+     */
+    virtual std::vector<explorer::config::ec_private>& get_keys_option()
+    {
+        return option_.keys;
+    }
+
+    /**
+     * Set the value of the key options.
+     */
+    virtual void set_keys_option(
+        const std::vector<explorer::config::ec_private>& value)
+    {
+        option_.keys = value;
+    }
+
+    /**
+     * Get the value of the prevout options.
+     */
+    virtual std::vector<explorer::config::script>& get_prevouts_option()
+    {
+        return option_.prevouts;
+    }
+
+    /**
+     * Set the value of the prevout options.
+     */
+    virtual void set_prevouts_option(
+        const std::vector<explorer::config::script>& value)
+    {
+        option_.prevouts = value;
+    }
+
+    /**
+     * Get the value of the sign_type option.
      */
-    virtual explorer::config::ec_private& get_ec_private_key_argument()
+    virtual explorer::config::hashtype& get_sign_type_option()
     {
-        return argument_.ec_private_key;
+        return option_.sign_type;
     }
 
     /**
-     * Set the value of the EC_PRIVATE_KEY argument.
+     * Set the value of the sign_type option.
      */
-    virtual void set_ec_private_key_argument(
-        const explorer::config::ec_private& value)
+    virtual void set_sign_type_option(
+        const explorer::config::hashtype& value)
     {
-        argument_.ec_private_key = value;
+        option_.sign_type = value;
     }
 
     /**
-     * Get the value of the TRANSACTION arguments.
+     * Get the value of the threads option.
      */
-    virtual std::vector<explorer::config::transaction>& get_transactions_argument()
+    virtual uint32_t& get_threads_option()
     {
-        return argument_.transactions;
+        return option_.threads;
     }
 
     /**
-     * Set the value of the TRANSACTION arguments.
+     * Set the value of the threads option.
      */
-    virtual void set_transactions_argument(
-        const std::vector<explorer::config::transaction>& value)
+    virtual void set_threads_option(
+        const uint32_t& value)
     {
-        argument_.transactions = value;
+        option_.threads = value;
     }
 
 private:
@@ -231,13 +348,11 @@ private:
     struct argument
     {
         argument()
-          : ec_private_key(),
-            transactions()
+          : transaction()
         {
         }
 
-        explorer::config::ec_private ec_private_key;
-        std::vector<explorer::config::transaction> transactions;
+        explorer::config::transaction transaction;
     } argument_;
 
     /**
@@ -248,9 +363,21 @@ private:
     struct option
     {
         option()
+          : anyone(),
+            binary(),
+            keys(),
+            prevouts(),
+            sign_type(),
+            threads()
         {
         }
 
+        bool anyone;
+        bool binary;
+        std::vector<explorer::config::ec_private> keys;
+        std::vector<explorer::config::script> prevouts;
+        explorer::config::hashtype sign_type;
+        uint32_t threads;
     } option_;
 };
 
@@ -0,0 +1,357 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_TX_VERIFY_HPP
+#define BX_TX_VERIFY_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/header.hpp>
+#include <bitcoin/explorer/config/input.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/output.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/script.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/transaction.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_TX_VERIFY_PREVOUT_COUNT_MISMATCH \
+    "The number of previous output scripts must be one or equal to the number of inputs."
+#define BX_TX_VERIFY_AMOUNT_COUNT_MISMATCH \
+    "The number of previous output values must be zero, one or equal to the number of inputs."
+#define BX_TX_VERIFY_UNKNOWN_RULE \
+    "The rule %1% is not known."
+#define BX_TX_VERIFY_VALID \
+    "Input %1% is valid, %2% operations."
+#define BX_TX_VERIFY_INVALID \
+    "Input %1% is not valid, %2% operations."
+
+/**
+ * Class to implement the tx-verify command.
+ */
+class BCX_API tx_verify 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "tx-verify";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return tx_verify::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "TRANSACTION";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Verify the scripts of all inputs of a transaction against their previous outputs, using the local script interpreter. Inputs are verified concurrently. Requires no server connection.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("TRANSACTION", 1);
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+        const auto raw = requires_raw_input();
+        load_input(get_transaction_argument(), "TRANSACTION", variables, input, raw);
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "amount,a",
+            value<std::vector<uint64_t>>(&option_.amounts),
+            "The set of previous output values in satoshi, one per input in input order. A single value applies to all inputs, defaults to zero."
+        )
+        (
+            "binary,b",
+            value<bool>(&option_.binary)->zero_tokens(),
+            "Read the transaction from STDIN in its binary (wire) encoding rather than as Base16. A regular file redirected to STDIN is memory mapped and parsed in place."
+        )
+        (
+            "prevout,p",
+            value<std::vector<explorer::config::script>>(&option_.prevouts),
+            "The set of previous output scripts, one per input in input order. A single script applies to all inputs. Multiple tokens must be quoted."
+        )
+        (
+            "rule,r",
+            value<std::vector<std::string>>(&option_.rules),
+            "The set of consensus rules to enforce. Options are 'bip16', 'bip65' and 'bip66', defaults to all rules."
+        )
+        (
+            "threads,t",
+            value<uint32_t>(&option_.threads),
+            "The number of verification threads, defaults to 0 (one per processor)."
+        )
+        (
+            "TRANSACTION",
+            value<explorer::config::transaction>(&argument_.transaction),
+            "The Base16 transaction. If not specified the transaction is read from STDIN."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the TRANSACTION argument.
+     */
+    virtual explorer::config::transaction& get_transaction_argument()
+    {
+        return argument_.transaction;
+    }
+
+    /**
+     * Set the value of the TRANSACTION argument.
+     */
+    virtual void set_transaction_argument(
+        const explorer::config::transaction& value)
+    {
+        argument_.transaction = value;
+    }
+
+    /**
+     * Get the value of the amount options.
+     */
+    virtual std::vector<uint64_t>& get_amounts_option()
+    {
+        return option_.amounts;
+    }
+
+    /**
+     * Set the value of the amount options.
+     */
+    virtual void set_amounts_option(
+        const std::vector<uint64_t>& value)
+    {
+        option_.amounts = value;
+    }
+
+    /**
+     * Get the value of the binary option.
+     */
+    virtual bool& get_binary_option()
+    {
+        return option_.binary;
+    }
+
+    /**
+     * Set the value of the binary option.
+     */
+    virtual void set_binary_option(
+        const bool& value)
+    {
+        option_.binary = value;
+    }
+
+    /**
+     * Get the value of the prevout options.
+     */
+    virtual std::vector<explorer::config::script>& get_prevouts_option()
+    {
+        return option_.prevouts;
+    }
+
+    /**
+     * Set the value of the prevout options.
+     */
+    virtual void set_prevouts_option(
+        const std::vector<explorer::config::script>& value)
+    {
+        option_.prevouts = value;
+    }
+
+    /**
+     * Get the value of the rule options.
+     */
+    virtual std::vector<std::string>& get_rules_option()
+    {
+        return option_.rules;
+    }
+
+    /**
+     * Set the value of the rule options.
+     */
+    virtual void set_rules_option(
+        const std::vector<std::string>& value)
+    {
+        option_.rules = value;
+    }
+
+    /**
+     * Get the value of the threads option.
+     */
+    virtual uint32_t& get_threads_option()
+    {
+        return option_.threads;
+    }
+
+    /**
+     * Set the value of the threads option.
+     */
+    virtual void set_threads_option(
+        const uint32_t& value)
+    {
+        option_.threads = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : transaction()
+        {
+        }
+
+        explorer::config::transaction transaction;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : amounts(),
+            binary(),
+            prevouts(),
+            rules(),
+            threads()
+        {
+        }
+
+        std::vector<uint64_t> amounts;
+        bool binary;
+        std::vector<explorer::config::script> prevouts;
+        std::vector<std::string> rules;
+        uint32_t threads;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
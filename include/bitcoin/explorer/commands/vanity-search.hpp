@@ -0,0 +1,364 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_VANITY_SEARCH_HPP
+#define BX_VANITY_SEARCH_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/program_options.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/generated.hpp>
+#include <bitcoin/explorer/config/address.hpp>
+#include <bitcoin/explorer/config/algorithm.hpp>
+#include <bitcoin/explorer/config/btc.hpp>
+#include <bitcoin/explorer/config/byte.hpp>
+#include <bitcoin/explorer/config/cert_key.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/config/encoding.hpp>
+#include <bitcoin/explorer/config/endorsement.hpp>
+#include <bitcoin/explorer/config/hashtype.hpp>
+#include <bitcoin/explorer/config/hd_key.hpp>
+#include <bitcoin/explorer/config/header.hpp>
+#include <bitcoin/explorer/config/input.hpp>
+#include <bitcoin/explorer/config/language.hpp>
+#include <bitcoin/explorer/config/output.hpp>
+#include <bitcoin/explorer/config/raw.hpp>
+#include <bitcoin/explorer/config/script.hpp>
+#include <bitcoin/explorer/config/signature.hpp>
+#include <bitcoin/explorer/config/transaction.hpp>
+#include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+/********* GENERATED SOURCE CODE, DO NOT EDIT EXCEPT EXPERIMENTALLY **********/
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+/**
+ * Various localizable strings.
+ */
+#define BX_VANITY_SEARCH_SHORT_SEED \
+    "The seed is less than 128 bits long."
+#define BX_VANITY_SEARCH_INVALID_KEY \
+    "The seed produced an invalid key."
+#define BX_VANITY_SEARCH_INVALID_PREFIX \
+    "No payment address of the version can begin with the prefix."
+#define BX_VANITY_SEARCH_NOT_FOUND \
+    "No payment address with the prefix was found within the limit."
+#define BX_VANITY_SEARCH_RATE \
+    "Searched %1% keys in %2% seconds (%3% keys per second)."
+
+/**
+ * Class to implement the vanity-search command.
+ */
+class BCX_API vanity_search 
+  : public command
+{
+public:
+
+    /**
+     * The symbolic (not localizable) command name, lower case.
+     */
+    static const char* symbol()
+    {
+        return "vanity-search";
+    }
+
+
+    /**
+     * The member symbolic (not localizable) command name, lower case.
+     */
+    virtual const char* name()
+    {
+        return vanity_search::symbol();
+    }
+
+    /**
+     * The localizable command category name, upper case.
+     */
+    virtual const char* category()
+    {
+        return "WALLET";
+    }
+
+    /**
+     * The localizable command description.
+     */
+    virtual const char* description()
+    {
+        return "Search for an EC private key with a payment address that begins with the specified prefix. Keys are walked from the key of the seed (see ec-new) by incremental point addition across all processors, so the private key is the key of the seed plus the reported offset. WARNING: the seed should be created from properly generated entropy.";
+    }
+
+    /**
+     * Load program argument definitions.
+     * A value of -1 indicates that the number of instances is unlimited.
+     * @return  The loaded program argument definitions.
+     */
+    virtual arguments_metadata& load_arguments()
+    {
+        return get_argument_metadata()
+            .add("PREFIX", 1)
+            .add("SEED", 1);
+    }
+
+	/**
+     * Load parameter fallbacks from file or input as appropriate.
+     * @param[in]  input  The input stream for loading the parameters.
+     * @param[in]         The loaded variables.
+     */
+    virtual void load_fallbacks(std::istream& input, 
+        po::variables_map& variables)
+    {
+        const auto raw = requires_raw_input();
+        load_input(get_seed_argument(), "SEED", variables, input, raw);
+    }
+
+    /**
+     * Load program option definitions.
+     * BUGBUG: see boost bug/fix: svn.boost.org/trac/boost/ticket/8009
+     * @return  The loaded program option definitions.
+     */
+    virtual options_metadata& load_options()
+    {
+        using namespace po;
+        options_description& options = get_option_metadata();
+        options.add_options()
+        (
+            BX_HELP_VARIABLE ",h",
+            value<bool>()->zero_tokens(),
+            "Get a description and instructions for this command."
+        )
+        (
+            BX_CONFIG_VARIABLE ",c",
+            value<boost::filesystem::path>(),
+            "The path to the configuration settings file."
+        )
+        (
+            "format,f",
+            value<explorer::config::encoding>(&option_.format),
+            "The output format. Options are 'info', 'json' and 'xml', defaults to 'info'."
+        )
+        (
+            "limit,l",
+            value<uint64_t>(&option_.limit),
+            "The maximum number of keys to search, defaults to 0 (unlimited)."
+        )
+        (
+            "threads,t",
+            value<uint32_t>(&option_.threads),
+            "The number of search threads, defaults to 0 (one per processor)."
+        )
+        (
+            "version,v",
+            value<explorer::config::byte>(&option_.version)->default_value(0),
+            "The desired payment address version."
+        )
+        (
+            "PREFIX",
+            value<std::string>(&argument_.prefix)->required(),
+            "The Base58 prefix of the payment address, including the version character. The prefix is case sensitive."
+        )
+        (
+            "SEED",
+            value<bc::config::base16>(&argument_.seed),
+            "The Base16 entropy from which the first key is derived. Must be at least 128 bits in length. If not specified the seed is read from STDIN."
+        );
+
+        return options;
+    }
+
+    /**
+     * Set variable defaults from configuration variable values.
+     * @param[in]  variables  The loaded variables.
+     */
+    virtual void set_defaults_from_config(po::variables_map& variables)
+    {
+        const auto& option_version = variables["version"];
+        const auto& option_version_config = variables["wallet.pay_to_public_key_hash_version"];
+        if (option_version.defaulted() && !option_version_config.defaulted())
+        {
+            option_.version = option_version_config.as<explorer::config::byte>();
+        }
+    }
+
+    /**
+     * Invoke the command.
+     * @param[out]  output  The input stream for the command execution.
+     * @param[out]  error   The input stream for the command execution.
+     * @return              The appropriate console return code { -1, 0, 1 }.
+     */
+    virtual console_result invoke(std::ostream& output,
+        std::ostream& cerr);
+
+    /* Properties */
+
+    /**
+     * Get the value of the PREFIX argument.
+     */
+    virtual std::string& get_prefix_argument()
+    {
+        return argument_.prefix;
+    }
+
+    /**
+     * Set the value of the PREFIX argument.
+     */
+    virtual void set_prefix_argument(
+        const std::string& value)
+    {
+        argument_.prefix = value;
+    }
+
+    /**
+     * Get the value of the SEED argument.
+     */
+    virtual bc::config::base16& get_seed_argument()
+    {
+        return argument_.seed;
+    }
+
+    /**
+     * Set the value of the SEED argument.
+     */
+    virtual void set_seed_argument(
+        const bc::config::base16& value)
+    {
+        argument_.seed = value;
+    }
+
+    /**
+     * Get the value of the format option.
+     */
+    virtual explorer::config::encoding& get_format_option()
+    {
+        return option_.format;
+    }
+
+    /**
+     * Set the value of the format option.
+     */
+    virtual void set_format_option(
+        const explorer::config::encoding& value)
+    {
+        option_.format = value;
+    }
+
+    /**
+     * Get the value of the limit option.
+     */
+    virtual uint64_t& get_limit_option()
+    {
+        return option_.limit;
+    }
+
+    /**
+     * Set the value of the limit option.
+     */
+    virtual void set_limit_option(
+        const uint64_t& value)
+    {
+        option_.limit = value;
+    }
+
+    /**
+     * Get the value of the threads option.
+     */
+    virtual uint32_t& get_threads_option()
+    {
+        return option_.threads;
+    }
+
+    /**
+     * Set the value of the threads option.
+     */
+    virtual void set_threads_option(
+        const uint32_t& value)
+    {
+        option_.threads = value;
+    }
+
+    /**
+     * Get the value of the version option.
+     */
+    virtual explorer::config::byte& get_version_option()
+    {
+        return option_.version;
+    }
+
+    /**
+     * Set the value of the version option.
+     */
+    virtual void set_version_option(
+        const explorer::config::byte& value)
+    {
+        option_.version = value;
+    }
+
+private:
+
+    /**
+     * Command line argument bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct argument
+    {
+        argument()
+          : prefix(),
+            seed()
+        {
+        }
+
+        std::string prefix;
+        bc::config::base16 seed;
+    } argument_;
+
+    /**
+     * Command line option bound variables.
+     * Uses cross-compiler safe constructor-based zeroize.
+     * Zeroize for unit test consistency with program_options initialization.
+     */
+    struct option
+    {
+        option()
+          : format(),
+            limit(),
+            threads(),
+            version()
+        {
+        }
+
+        explorer::config::encoding format;
+        uint64_t limit;
+        uint32_t threads;
+        explorer::config::byte version;
+    } option_;
+};
+
+} // namespace commands
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
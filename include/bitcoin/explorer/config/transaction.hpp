@@ -75,6 +75,21 @@ public:
      */
     operator const tx_type&() const;
 
+    /**
+     * Deserialize the wire encoding in place, without copying the data.
+     * @param[in]  data  The serialized transaction.
+     * @return           True if the data is a valid transaction.
+     */
+    bool from_data(data_slice data);
+
+    /**
+     * Read the wire encoding from the stream. If the stream is STDIN and is
+     * a regular file the file is memory mapped and parsed in place.
+     * @param[in]  input  The input stream to read the transaction from.
+     * @return            True if the input is a valid transaction.
+     */
+    bool from_binary(std::istream& input);
+
     /**
      * Overload stream in. Throws if input is invalid.
      * @param[in]   input     The input stream to read the value from.
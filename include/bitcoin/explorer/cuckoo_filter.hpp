@@ -0,0 +1,97 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_CUCKOO_FILTER_HPP
+#define BX_CUCKOO_FILTER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * An approximate set of hashes, which never misses an inserted hash but may
+ * report a hash as present that was not inserted.
+ *
+ * Each hash is held as a 32 bit fingerprint in one of two buckets of four
+ * fingerprints. As hashes are uniform, the fingerprint and the first bucket
+ * are taken from the hash itself, and the second bucket is derived from the
+ * first and the fingerprint, so that an entry may be moved between its
+ * buckets without the hash. The table is sized for no more than half load at
+ * its capacity, at which a lookup is a false positive with a probability of
+ * less than one in a billion.
+ */
+class BCX_API cuckoo_filter
+{
+public:
+
+    /**
+     * Construct an empty filter.
+     * @param[in]  capacity  The expected number of hashes. More may be
+     *                       inserted, at a higher false positive rate.
+     */
+    explicit cuckoo_filter(size_t capacity);
+
+    /**
+     * The number of hashes inserted.
+     */
+    size_t size() const;
+
+    /**
+     * Determine if a hash is present.
+     * @param[in]  hash  The hash.
+     * @return           True if the hash is probably present.
+     */
+    bool contains(const hash_digest& hash) const;
+
+    /**
+     * Insert a hash unless it is present.
+     * @param[in]  hash  The hash.
+     * @return           False if the hash is probably present, in which case
+     *                   the filter is unchanged.
+     */
+    bool insert(const hash_digest& hash);
+
+private:
+    typedef std::array<uint32_t, 4> bucket;
+    typedef std::pair<size_t, uint32_t> entry;
+
+    size_t alternate(size_t index, uint32_t fingerprint) const;
+    bool contains(size_t index, uint32_t fingerprint) const;
+    bool place(size_t index, uint32_t fingerprint);
+
+    const size_t mask_;
+    std::vector<bucket> buckets_;
+    std::vector<entry> overflow_;
+    size_t size_;
+    size_t evict_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
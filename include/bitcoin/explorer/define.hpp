@@ -70,6 +70,12 @@
  */
 #define BX_STDIO_PATH_SENTINEL "-"
 
+/**
+ * Command line option for indicating that a transaction should be read from
+ * STDIN in its binary (wire) encoding.
+ */
+#define BX_BINARY_VARIABLE "binary"
+
 /**
  * Space-saving namespaces.
  */
@@ -95,6 +101,11 @@ BC_CONSTEXPR size_t minimum_seed_bits = 128;
  */
 BC_CONSTEXPR size_t minimum_seed_size = minimum_seed_bits / bc::byte_bits;
 
+/**
+ * The scrypt working memory of a BIP38 key derivation (N=16384, r=8, p=8).
+ */
+BC_CONSTEXPR uint64_t bip38_scrypt_memory = 128 * 8 * (16384 + 8);
+
 /**
  * Suppported output encoding engines.
  */
@@ -0,0 +1,168 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_EC_ARITHMETIC_HPP
+#define BX_EC_ARITHMETIC_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * An element of the secp256k1 base field, always fully reduced. This is a
+ * portable, variable time implementation intended for batched public
+ * operations (such as walking public keys), not for use with secrets.
+ */
+class field_element
+{
+public:
+
+    /**
+     * Construct an instance of the field_element class with value zero.
+     */
+    BCX_API field_element();
+
+    /**
+     * Construct an instance of the field_element class from a small value.
+     * @param[in]  value  The value.
+     */
+    BCX_API explicit field_element(uint32_t value);
+
+    /**
+     * Set the value from a big endian encoding.
+     * @param[in]  data  The 32 byte encoding, which must be less than p.
+     * @return           True if the encoding is less than p.
+     */
+    BCX_API bool from_bytes(const uint8_t* data);
+
+    /**
+     * Write the big endian encoding of the value.
+     * @param[out] data  The 32 byte buffer to write to.
+     */
+    BCX_API void to_bytes(uint8_t* data) const;
+
+    /**
+     * Determine if the value is zero.
+     */
+    BCX_API bool is_zero() const;
+
+    /**
+     * Determine if the value is odd.
+     */
+    BCX_API bool is_odd() const;
+
+    /**
+     * Get the multiplicative inverse of the value, which must be non-zero.
+     */
+    BCX_API field_element inverse() const;
+
+    /**
+     * Overload == operator to compare values.
+     */
+    BCX_API bool operator==(const field_element& other) const;
+
+    /**
+     * Overload != operator to compare values.
+     */
+    BCX_API bool operator!=(const field_element& other) const;
+
+    /**
+     * Overload + operator to add modulo p.
+     */
+    BCX_API field_element operator+(const field_element& other) const;
+
+    /**
+     * Overload - operator to subtract modulo p.
+     */
+    BCX_API field_element operator-(const field_element& other) const;
+
+    /**
+     * Overload * operator to multiply modulo p.
+     */
+    BCX_API field_element operator*(const field_element& other) const;
+
+private:
+#ifdef __SIZEOF_INT128__
+    static field_element multiply_wide(const field_element& left,
+        const field_element& right);
+#endif
+
+    std::array<uint32_t, 8> limbs_;
+};
+
+/**
+ * An affine point on the secp256k1 curve, excluding the point at infinity.
+ */
+struct affine_point
+{
+    field_element x;
+    field_element y;
+
+    /**
+     * Set the point from a serialized uncompressed public key.
+     * @param[in]  point  The uncompressed public key.
+     * @return            True if the key is well-formed.
+     */
+    BCX_API bool from_uncompressed(const ec_uncompressed& point);
+
+    /**
+     * Get the serialized compressed public key of the point.
+     */
+    BCX_API ec_compressed to_compressed() const;
+
+    /**
+     * Get the serialized uncompressed public key of the point.
+     */
+    BCX_API ec_uncompressed to_uncompressed() const;
+};
+
+typedef std::vector<field_element> field_elements;
+typedef std::vector<affine_point> affine_points;
+
+/**
+ * Replace each element with its inverse using a single field inversion.
+ * @param[in,out] elements  The elements to invert, all must be non-zero.
+ * @return                  False (with elements unchanged) if any is zero.
+ */
+BCX_API bool batch_inverse(field_elements& elements);
+
+/**
+ * Add a point to each of a set of points, normalizing all of the sums to
+ * affine coordinates with a single field inversion.
+ * @param[out] out      The sums, in the order of the addends.
+ * @param[in]  base     The point added to each addend.
+ * @param[in]  addends  The points to add to the base.
+ * @return              False if any addend shares the x coordinate of the
+ *                      base (doubling or infinity), which is not handled.
+ */
+BCX_API bool batch_add(affine_points& out, const affine_point& base,
+    const affine_points& addends);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
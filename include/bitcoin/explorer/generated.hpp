@@ -25,6 +25,7 @@
 #include <string>
 #include <bitcoin/explorer/command.hpp>
 #include <bitcoin/explorer/commands/address-decode.hpp>
+#include <bitcoin/explorer/commands/address-decode-batch.hpp>
 #include <bitcoin/explorer/commands/address-embed.hpp>
 #include <bitcoin/explorer/commands/address-encode.hpp>
 #include <bitcoin/explorer/commands/base16-decode.hpp>
@@ -37,25 +38,34 @@
 #include <bitcoin/explorer/commands/base64-encode.hpp>
 #include <bitcoin/explorer/commands/bitcoin160.hpp>
 #include <bitcoin/explorer/commands/bitcoin256.hpp>
+#include <bitcoin/explorer/commands/block-decode.hpp>
 #include <bitcoin/explorer/commands/btc-to-satoshi.hpp>
 #include <bitcoin/explorer/commands/cert-new.hpp>
 #include <bitcoin/explorer/commands/cert-public.hpp>
+#include <bitcoin/explorer/commands/chain-index.hpp>
+#include <bitcoin/explorer/commands/chain-scan.hpp>
 #include <bitcoin/explorer/commands/ec-add.hpp>
 #include <bitcoin/explorer/commands/ec-add-secrets.hpp>
 #include <bitcoin/explorer/commands/ec-multiply.hpp>
+#include <bitcoin/explorer/commands/ec-multiply-batch.hpp>
 #include <bitcoin/explorer/commands/ec-multiply-secrets.hpp>
 #include <bitcoin/explorer/commands/ec-new.hpp>
 #include <bitcoin/explorer/commands/ec-to-address.hpp>
+#include <bitcoin/explorer/commands/ec-to-address-batch.hpp>
 #include <bitcoin/explorer/commands/ec-to-ek.hpp>
+#include <bitcoin/explorer/commands/ec-to-ek-batch.hpp>
 #include <bitcoin/explorer/commands/ec-to-public.hpp>
+#include <bitcoin/explorer/commands/ec-to-public-batch.hpp>
 #include <bitcoin/explorer/commands/ec-to-wif.hpp>
 #include <bitcoin/explorer/commands/ek-address.hpp>
 #include <bitcoin/explorer/commands/ek-new.hpp>
+#include <bitcoin/explorer/commands/ek-new-batch.hpp>
 #include <bitcoin/explorer/commands/ek-public.hpp>
 #include <bitcoin/explorer/commands/ek-public-to-address.hpp>
 #include <bitcoin/explorer/commands/ek-public-to-ec.hpp>
 #include <bitcoin/explorer/commands/ek-to-address.hpp>
 #include <bitcoin/explorer/commands/ek-to-ec.hpp>
+#include <bitcoin/explorer/commands/ek-to-ec-batch.hpp>
 #include <bitcoin/explorer/commands/fetch-balance.hpp>
 #include <bitcoin/explorer/commands/fetch-header.hpp>
 #include <bitcoin/explorer/commands/fetch-height.hpp>
@@ -65,6 +75,7 @@
 #include <bitcoin/explorer/commands/fetch-tx.hpp>
 #include <bitcoin/explorer/commands/fetch-tx-index.hpp>
 #include <bitcoin/explorer/commands/fetch-utxo.hpp>
+#include <bitcoin/explorer/commands/hash-batch.hpp>
 #include <bitcoin/explorer/commands/hd-new.hpp>
 #include <bitcoin/explorer/commands/hd-private.hpp>
 #include <bitcoin/explorer/commands/hd-public.hpp>
@@ -76,17 +87,26 @@
 #include <bitcoin/explorer/commands/input-set.hpp>
 #include <bitcoin/explorer/commands/input-sign.hpp>
 #include <bitcoin/explorer/commands/input-validate.hpp>
+#include <bitcoin/explorer/commands/key-manifest.hpp>
+#include <bitcoin/explorer/commands/merkle-proof.hpp>
+#include <bitcoin/explorer/commands/merkle-root.hpp>
+#include <bitcoin/explorer/commands/merkle-verify.hpp>
 #include <bitcoin/explorer/commands/message-sign.hpp>
 #include <bitcoin/explorer/commands/message-validate.hpp>
+#include <bitcoin/explorer/commands/message-validate-batch.hpp>
 #include <bitcoin/explorer/commands/mnemonic-decode.hpp>
 #include <bitcoin/explorer/commands/mnemonic-encode.hpp>
 #include <bitcoin/explorer/commands/mnemonic-new.hpp>
+#include <bitcoin/explorer/commands/mnemonic-recover.hpp>
 #include <bitcoin/explorer/commands/mnemonic-to-seed.hpp>
+#include <bitcoin/explorer/commands/mnemonic-to-seed-batch.hpp>
 #include <bitcoin/explorer/commands/qrcode.hpp>
 #include <bitcoin/explorer/commands/ripemd160.hpp>
 #include <bitcoin/explorer/commands/satoshi-to-btc.hpp>
 #include <bitcoin/explorer/commands/script-decode.hpp>
+#include <bitcoin/explorer/commands/script-decode-batch.hpp>
 #include <bitcoin/explorer/commands/script-encode.hpp>
+#include <bitcoin/explorer/commands/script-encode-batch.hpp>
 #include <bitcoin/explorer/commands/script-to-address.hpp>
 #include <bitcoin/explorer/commands/seed.hpp>
 #include <bitcoin/explorer/commands/send-tx.hpp>
@@ -102,12 +122,17 @@
 #include <bitcoin/explorer/commands/stealth-secret.hpp>
 #include <bitcoin/explorer/commands/stealth-shared.hpp>
 #include <bitcoin/explorer/commands/token-new.hpp>
+#include <bitcoin/explorer/commands/tx-ancestors.hpp>
 #include <bitcoin/explorer/commands/tx-decode.hpp>
 #include <bitcoin/explorer/commands/tx-encode.hpp>
+#include <bitcoin/explorer/commands/tx-estimate.hpp>
+#include <bitcoin/explorer/commands/tx-hash.hpp>
 #include <bitcoin/explorer/commands/tx-sign.hpp>
+#include <bitcoin/explorer/commands/tx-verify.hpp>
 #include <bitcoin/explorer/commands/uri-decode.hpp>
 #include <bitcoin/explorer/commands/uri-encode.hpp>
 #include <bitcoin/explorer/commands/validate-tx.hpp>
+#include <bitcoin/explorer/commands/vanity-search.hpp>
 #include <bitcoin/explorer/commands/watch-address.hpp>
 #include <bitcoin/explorer/commands/watch-tx.hpp>
 #include <bitcoin/explorer/commands/wif-to-ec.hpp>
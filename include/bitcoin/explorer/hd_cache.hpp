@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_HD_CACHE_HPP
+#define BX_HD_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A file of HD (BIP32) public keys at intermediate derivation paths, so that
+ * a key deep in a hierarchy is derived from its nearest cached ancestor
+ * instead of from the root. Each entry is a line of the root identifier,
+ * the path from the root and the encoded public key. Private keys are never
+ * written, so hardened steps below the nearest cached ancestor still require
+ * the private root.
+ */
+class hd_cache
+{
+public:
+
+    /**
+     * Get the identifier of a root key, the hash of its point and chain code.
+     * @param[in]  root  The root public key.
+     * @return           The Base16 identifier.
+     */
+    BCX_API static std::string identify(const wallet::hd_public& root);
+
+    /**
+     * Load the cache from a file. A missing file is an empty cache and
+     * unreadable lines are ignored.
+     * @param[in]  file            The path to the cache file.
+     * @param[in]  public_version  The version of the cached public keys.
+     */
+    BCX_API hd_cache(const std::string& file, uint32_t public_version);
+
+    /**
+     * Find the deepest cached ancestor of a key from which all of the
+     * remaining steps of the path are public (not hardened).
+     * @param[out] out    The ancestor public key.
+     * @param[out] depth  The number of steps of the path to the ancestor.
+     * @param[in]  root   The identifier of the root key.
+     * @param[in]  path   The path of the key from the root.
+     * @return            True if there is such an ancestor.
+     */
+    BCX_API bool find(wallet::hd_public& out, size_t& depth,
+        const std::string& root, const std::vector<uint32_t>& path) const;
+
+    /**
+     * Add a key to the cache and append it to the file.
+     * @param[in]  root  The identifier of the root key.
+     * @param[in]  path  The path of the key from the root.
+     * @param[in]  key   The public key.
+     * @return           True if the key was written to the file.
+     */
+    BCX_API bool store(const std::string& root,
+        const std::vector<uint32_t>& path, const wallet::hd_public& key);
+
+private:
+    std::string file_;
+    uint32_t public_version_;
+    std::unordered_map<std::string, std::string> keys_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
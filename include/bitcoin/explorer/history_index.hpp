@@ -0,0 +1,138 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_HISTORY_INDEX_HPP
+#define BX_HISTORY_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The result of appending blocks to a chain index.
+ */
+enum class history_index_result
+{
+    okay,
+    invalid_block,
+    file_failure
+};
+
+/**
+ * A local index of the outputs and spends of payment addresses, built from
+ * block files, that answers history queries without a server.
+ *
+ * Each output to an address and each spend of such an output is a fixed-size
+ * record, keyed by the address hash. The records of each append are written
+ * as one run sorted by key, with a sparse fence index of the key of every
+ * 64th record, so that a query reads only a small range of each run. A run
+ * is merged with the runs that follow it once they hold as many records, so
+ * runs of similar size are merged together. Each run also holds the changes
+ * its blocks make to the unspent indexed outputs, sorted by point, so that
+ * new blocks may be appended by looking up only the outputs they spend. The
+ * index also holds the hashes of the indexed blocks in height order.
+ *
+ * Runs are named for the blocks they cover, and an append is committed by
+ * replacing the file of block hashes. The files of an append
+ * or a merge that is interrupted are therefore ignored, and removed by the
+ * next append.
+ */
+class BCX_API history_index
+{
+public:
+
+    /**
+     * Construct the index of a directory, which need not yet exist.
+     * @param[in]  directory  The path of the index directory.
+     */
+    explicit history_index(const std::string& directory);
+
+    /**
+     * Load the indexed chain and the fence indexes of the runs. A directory
+     * that does not exist is an empty index.
+     * @return  False if the index is not valid.
+     */
+    bool load();
+
+    /**
+     * The number of indexed blocks, one more than the top height.
+     */
+    size_t blocks() const;
+
+    /**
+     * Index the blocks that extend the indexed chain, following the longest
+     * branch from its top. Blocks that are already indexed or that are not
+     * connected to the top are ignored, so the same block files may be
+     * appended again as they grow. The index must first be loaded, as files
+     * of the index directory that it does not hold are removed.
+     * @param[out] indexed  The number of blocks indexed.
+     * @param[out] invalid  The position of the first record that is not a
+     *                      valid block, if any.
+     * @param[in]  records  The serialized blocks, in any order.
+     * @param[in]  threads  The number of threads, zero for one per core.
+     * @return              The result, nothing is committed on failure.
+     */
+    history_index_result append(size_t& indexed, size_t& invalid,
+        const std::vector<data_slice>& records, size_t threads=0);
+
+    /**
+     * Get the history of a payment address, as rendered by fetch-history.
+     * Outputs are keyed by the address hash, so an address matches the
+     * outputs of the other address types of the same hash.
+     * @param[out] out      The history rows, in order of the output height.
+     * @param[in]  address  The payment address.
+     * @return              False if the index cannot be read.
+     */
+    bool history(chain::history::list& out,
+        const wallet::payment_address& address) const;
+
+private:
+    struct run
+    {
+        uint32_t start;
+        uint32_t end;
+        size_t records;
+        std::vector<short_hash> fence;
+    };
+
+    std::string path(const std::string& name) const;
+    std::string run_path(const run& fenced,
+        const std::string& extension) const;
+    bool find_runs(std::vector<run>& out) const;
+    void remove_stale() const;
+    void merge_runs();
+
+    const std::string directory_;
+    std::vector<run> runs_;
+    hash_digest top_;
+    size_t blocks_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -27,12 +27,16 @@
 #pragma warning(push)
 #pragma warning(disable : 4996)
 #endif
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <iostream>
 #include <cstdint>
 #include <string>
 #include <system_error>
+#include <thread>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <boost/algorithm/string.hpp>
 #include <boost/bind.hpp>
@@ -97,6 +101,43 @@ void deserialize(std::vector<Value>& collection, const std::string& text,
     }
 }
 
+template <typename Value>
+bool deserialize_lines(std::vector<Value>& out, size_t& line,
+    const data_chunk& text)
+{
+    out.clear();
+    line = 0;
+
+    std::vector<data_slice> rows;
+    std::vector<size_t> lines;
+    split_lines(rows, lines, text);
+    out.reserve(rows.size());
+
+    for (size_t index = 0; index < rows.size(); ++index)
+    {
+        const std::string row(rows[index].begin(), rows[index].end());
+
+        try
+        {
+            Value value;
+            deserialize(value, row, false);
+            out.push_back(std::move(value));
+        }
+        catch (const po::error&)
+        {
+            line = lines[index];
+            return false;
+        }
+        catch (const boost::bad_lexical_cast&)
+        {
+            line = lines[index];
+            return false;
+        }
+    }
+
+    return true;
+}
+
 template <typename Item>
 bool deserialize_satoshi_item(Item& item, const data_chunk& data)
 {
@@ -139,6 +180,74 @@ void load_path(Value& parameter, const std::string& name,
     deserialize(parameter, file, !raw);
 }
 
+template <typename Handler>
+void parallel_for(size_t count, Handler handler, size_t threads)
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+
+    // Never create more threads than there are items to process.
+    threads = std::max(std::min(threads, count), size_t(1));
+
+    const auto block = count / threads;
+    const auto remainder = count % threads;
+
+    const auto process = [&handler](size_t begin, size_t end)
+    {
+        for (auto index = begin; index < end; ++index)
+            handler(index);
+    };
+
+    // The calling thread processes the first block.
+    size_t begin = 0;
+    auto end = block + (remainder > 0 ? 1 : 0);
+    const auto first_end = end;
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+
+    for (size_t thread = 1; thread < threads; ++thread)
+    {
+        begin = end;
+        end = begin + block + (thread < remainder ? 1 : 0);
+        workers.emplace_back(process, begin, end);
+    }
+
+    process(0, first_end);
+
+    for (auto& worker: workers)
+        worker.join();
+}
+
+template <typename Handler>
+void parallel_for_dynamic(size_t count, Handler handler, size_t threads)
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+
+    // Never create more threads than there are items to process.
+    threads = std::max(std::min(threads, count), size_t(1));
+
+    std::atomic<size_t> next(0);
+    const auto process = [&handler, &next, count]()
+    {
+        for (auto index = next++; index < count; index = next++)
+            handler(index);
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+
+    for (size_t thread = 1; thread < threads; ++thread)
+        workers.emplace_back(process);
+
+    // The calling thread also claims items.
+    process();
+
+    for (auto& worker: workers)
+        worker.join();
+}
+
 template <typename Value>
 std::string serialize(const Value& value, const std::string& fallback)
 {
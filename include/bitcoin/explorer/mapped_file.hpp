@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_MAPPED_FILE_HPP
+#define BX_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A read-only memory mapping of an open regular file, which allows large
+ * inputs to be parsed in place rather than copied through a stream. Mapping
+ * is not supported in Windows builds, in which case the file is not mapped.
+ */
+class BCX_API mapped_file
+{
+public:
+
+    /**
+     * Map the regular file open on the descriptor, from its current position
+     * to its end. The descriptor remains owned by the caller and may be
+     * closed once the file is mapped.
+     * @param[in]  descriptor  The file descriptor, such as that of STDIN.
+     */
+    explicit mapped_file(int descriptor);
+
+    /**
+     * Map the regular file at the path, in its entirety.
+     * @param[in]  path  The path of the file.
+     */
+    explicit mapped_file(const std::string& path);
+
+    /**
+     * Unmap the file.
+     */
+    ~mapped_file();
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    /**
+     * True if the file is mapped. Files that are not regular (such as pipes
+     * and terminals) and files with no remaining contents are not mapped.
+     */
+    bool mapped() const;
+
+    /**
+     * The mapped file contents, empty if not mapped.
+     */
+    data_slice data() const;
+
+private:
+    void map(int descriptor);
+
+    uint8_t* data_;
+    size_t size_;
+    size_t offset_;
+};
+
+/**
+ * The contents of a file, memory mapped where supported and otherwise read
+ * into memory, so that either way the contents can be parsed in place.
+ */
+class BCX_API file_contents
+{
+public:
+
+    /**
+     * Map or read the file.
+     * @param[in]  path  The path of the file.
+     */
+    explicit file_contents(const std::string& path);
+
+    file_contents(const file_contents&) = delete;
+    file_contents& operator=(const file_contents&) = delete;
+
+    /**
+     * True if the file could be read.
+     */
+    bool valid() const;
+
+    /**
+     * The file contents, empty if not valid.
+     */
+    data_slice data() const;
+
+private:
+    const mapped_file mapped_;
+    data_chunk buffer_;
+    bool valid_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_MERKLE_TREE_HPP
+#define BX_MERKLE_TREE_HPP
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A bitcoin merkle tree of transaction hashes. All levels of the tree are
+ * held in one contiguous buffer, and each level is computed from the one
+ * below it with its pairs of hashes hashed together in vector lanes. A level
+ * of an odd number of hashes is completed by a copy of its last hash.
+ */
+class BCX_API merkle_tree
+{
+public:
+
+    /**
+     * Build the tree of a set of transaction hashes.
+     * @param[in]  leaves  The transaction hashes, in block order.
+     */
+    merkle_tree(const hash_list& leaves);
+
+    /**
+     * The number of leaves of the tree.
+     */
+    size_t size() const;
+
+    /**
+     * The merkle root, null_hash if there are no leaves.
+     */
+    hash_digest root() const;
+
+    /**
+     * Get the branch that proves the inclusion of a leaf, the sibling of
+     * each node on the path from the leaf to the root.
+     * @param[out] out    The branch, from the leaves upward.
+     * @param[in]  index  The position of the leaf.
+     * @return            False if the position is out of range.
+     */
+    bool branch(hash_list& out, size_t index) const;
+
+    /**
+     * Compute the root implied by a branch of a leaf.
+     * @param[in]  leaf    The transaction hash.
+     * @param[in]  branch  The branch, from the leaves upward.
+     * @param[in]  index   The position of the leaf.
+     * @return             The merkle root.
+     */
+    static hash_digest branch_root(const hash_digest& leaf,
+        const hash_list& branch, size_t index);
+
+private:
+    hash_list nodes_;
+    std::vector<size_t> offsets_;
+    size_t size_;
+};
+
+/**
+ * Compute the hashes of a set of transactions, with the serialized
+ * transactions hashed together in vector lanes.
+ * @param[in]  transactions  The transactions.
+ * @return                   The transaction hashes, in order.
+ */
+BCX_API hash_list transaction_hashes(
+    const chain::transaction::list& transactions);
+
+/**
+ * Read the leaves of a merkle tree, as either Base16 transaction hashes, one
+ * per line, or the hashes of the transactions of a Base16 block.
+ * @param[out] out    The transaction hashes, in order.
+ * @param[out] line   The one-based number of the first line that is not a
+ *                    valid hash, if any, or zero if the block is not valid.
+ * @param[in]  text   The text to read.
+ * @param[in]  block  True if the text is a block.
+ * @return            True if the text is valid.
+ */
+BCX_API bool read_merkle_leaves(hash_list& out, size_t& line,
+    const data_chunk& text, bool block);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,126 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_MNEMONIC_INDEX_HPP
+#define BX_MNEMONIC_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A hashed index of the words of all BIP39 dictionaries, mapping each word
+ * to its position in each dictionary that contains it. This replaces the
+ * linear dictionary scans of mnemonic validation with a constant time lookup
+ * per word, independent of the number of dictionaries.
+ */
+class mnemonic_index
+{
+public:
+
+    /**
+     * Validate the checksum of the dictionary word indexes of a mnemonic
+     * (BIP39), without reference to any dictionary.
+     * @param[in]  indexes  The word indexes, each less than 2048.
+     * @return              True if the checksum is valid.
+     */
+    BCX_API static bool checksum(const std::vector<uint16_t>& indexes);
+
+    /**
+     * Get the index of all dictionaries in bc::wallet::language::all.
+     * The index is built once, on first use, and is safe to share.
+     * @return  The shared index.
+     */
+    BCX_API static const mnemonic_index& all();
+
+    /**
+     * Construct an index of the specified dictionaries.
+     * @param[in]  lexicons  The dictionaries to index.
+     */
+    BCX_API mnemonic_index(const wallet::dictionary_list& lexicons);
+
+    /**
+     * Get the position of each word in the dictionary.
+     * @param[out] out      The positions, in the order of the words.
+     * @param[in]  words    The words to find.
+     * @param[in]  lexicon  The indexed dictionary in which to find the words.
+     * @return              True if all words are in the dictionary.
+     */
+    BCX_API bool find(std::vector<uint16_t>& out,
+        const wallet::word_list& words,
+        const wallet::dictionary& lexicon) const;
+
+    /**
+     * Get the dictionaries that contain all of the words, in index order.
+     * @param[in]  words  The words to find.
+     * @return            The dictionaries, empty if none contains all words.
+     */
+    BCX_API wallet::dictionary_list languages(
+        const wallet::word_list& words) const;
+
+    /**
+     * Validate the mnemonic checksum in the dictionary (BIP39). Dictionaries
+     * that are not indexed are validated by libbitcoin.
+     * @param[in]  words    The mnemonic.
+     * @param[in]  lexicon  The dictionary of the mnemonic.
+     * @return              True if the mnemonic is valid in the dictionary.
+     */
+    BCX_API bool validate(const wallet::word_list& words,
+        const wallet::dictionary& lexicon) const;
+
+    /**
+     * Validate the mnemonic checksum in any of the dictionaries (BIP39).
+     * @param[in]  words     The mnemonic.
+     * @param[in]  lexicons  The candidate dictionaries of the mnemonic.
+     * @return               The first dictionary in which the mnemonic is
+     *                       valid, or nullptr if there is none.
+     */
+    BCX_API const wallet::dictionary* validate(const wallet::word_list& words,
+        const wallet::dictionary_list& lexicons) const;
+
+private:
+    // The position of a word in one of the indexed dictionaries.
+    struct position
+    {
+        uint8_t lexicon;
+        uint16_t index;
+    };
+
+    typedef std::vector<position> positions;
+
+    const positions* lookup(const std::string& word) const;
+    bool ordinal(uint8_t& out, const wallet::dictionary& lexicon) const;
+
+    wallet::dictionary_list lexicons_;
+    std::unordered_map<std::string, positions> words_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,92 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_MULTI_SHA256_HPP
+#define BX_MULTI_SHA256_HPP
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The number of messages hashed together by the batch hash functions.
+ */
+BC_CONSTEXPR size_t sha256_lanes = 8;
+
+/**
+ * Compute the SHA256 hash of each of a set of messages. Messages are
+ * grouped by length and each group of sha256_lanes messages is hashed
+ * together, one message per vector lane (AVX2 where available). Where the
+ * SHA extensions are available each message is instead hashed individually
+ * with those instructions.
+ * @param[in]  messages  The messages to hash.
+ * @return               The hashes, in the order of the messages.
+ */
+BCX_API std::vector<hash_digest> sha256_hash_batch(const data_stack& messages);
+
+/**
+ * Compute the SHA256 hash of the SHA256 hash of each of a set of messages,
+ * as bc::bitcoin_hash (the byte order is not reversed).
+ * @param[in]  messages  The messages to hash.
+ * @return               The hashes, in the order of the messages.
+ */
+BCX_API std::vector<hash_digest> bitcoin_hash_batch(
+    const data_stack& messages);
+
+/**
+ * Compute the SHA256 hash of the SHA256 hash of each of a set of messages
+ * in place, such as slices of a mapped file.
+ * @param[in]  messages  The messages to hash.
+ * @return               The hashes, in the order of the messages.
+ */
+BCX_API std::vector<hash_digest> bitcoin_hash_batch(
+    const std::vector<data_slice>& messages);
+
+/**
+ * Compute the SHA256 hash of the SHA256 hash of each adjacent pair of
+ * hashes, the parents of a level of a merkle tree. Groups of sha256_lanes
+ * pairs are hashed together, one pair per vector lane. The output may be
+ * the input, as each parent is written no further than the pair from which
+ * it is computed.
+ * @param[out] out    The parents, pairs in number.
+ * @param[in]  in     The hashes, twice pairs in number.
+ * @param[in]  pairs  The number of pairs.
+ */
+BCX_API void bitcoin_hash_pairs(hash_digest* out, const hash_digest* in,
+    size_t pairs);
+
+/**
+ * Compute the RIPEMD160 hash of the SHA256 hash of each of a set of
+ * messages, as bc::bitcoin_short_hash.
+ * @param[in]  messages  The messages to hash.
+ * @return               The hashes, in the order of the messages.
+ */
+BCX_API std::vector<short_hash> bitcoin_short_hash_batch(
+    const data_stack& messages);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_PBKDF2_HPP
+#define BX_PBKDF2_HPP
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The number of derivations computed together by pbkdf2_sha512_batch.
+ */
+BC_CONSTEXPR size_t pbkdf2_sha512_lanes = 4;
+
+/**
+ * Derive a 64 byte PBKDF2-HMAC-SHA512 key (RFC 2898).
+ * @param[in]  password    The password.
+ * @param[in]  salt        The salt.
+ * @param[in]  iterations  The number of iterations, at least one.
+ * @return                 The derived key.
+ */
+BCX_API long_hash pbkdf2_sha512(data_slice password, data_slice salt,
+    size_t iterations);
+
+/**
+ * Derive a 64 byte PBKDF2-HMAC-SHA512 key for each of a set of passwords
+ * with a common salt. Each group of pbkdf2_sha512_lanes passwords is
+ * iterated together, one password per vector lane (AVX2 where available),
+ * and any remainder is derived individually.
+ * @param[in]  passwords   The passwords.
+ * @param[in]  salt        The salt common to all passwords.
+ * @param[in]  iterations  The number of iterations, at least one.
+ * @return                 The derived keys, in the order of the passwords.
+ */
+BCX_API std::vector<long_hash> pbkdf2_sha512_batch(
+    const data_stack& passwords, data_slice salt, size_t iterations);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -32,6 +32,7 @@
 #include <bitcoin/explorer/config/point.hpp>
 #include <bitcoin/explorer/config/transaction.hpp>
 #include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/tx_ancestry.hpp>
 
 /* NOTE: don't declare 'using namespace foo' in headers. */
 
@@ -110,6 +111,28 @@ BCX_API pt::ptree prop_tree(const header& header);
  */
 BCX_API pt::ptree prop_tree(const std::vector<header>& headers);
 
+/**
+ * Generate a property list for a block. The transactions are hashed and
+ * rendered concurrently.
+ * @param[in]  block    The block.
+ * @param[in]  json     Use json array formatting.
+ * @param[in]  threads  The number of threads, zero implies one per core.
+ * @return              A property list.
+ */
+BCX_API pt::ptree prop_list(const chain::block& block, bool json,
+    size_t threads=1);
+
+/**
+ * Generate a property tree for a block. The transactions are hashed and
+ * rendered concurrently.
+ * @param[in]  block    The block.
+ * @param[in]  json     Use json array formatting.
+ * @param[in]  threads  The number of threads, zero implies one per core.
+ * @return              A property tree.
+ */
+BCX_API pt::ptree prop_tree(const chain::block& block, bool json,
+    size_t threads=1);
+
 /**
 * Generate a property list for a history row.
 * @param[in]  row  The history row.
@@ -252,6 +275,14 @@ BCX_API pt::ptree prop_tree(const chain::points_info& points_info, bool json);
  */
 BCX_API pt::ptree prop_list(const transaction& transaction, bool json);
 
+/**
+ * Generate a property list for a transaction.
+ * @param[in]  tx    The transaction.
+ * @param[in]  json  Use json array formatting.
+ * @return           A property list.
+ */
+BCX_API pt::ptree prop_list(const tx_type& tx, bool json);
+
 /**
  * Generate a property tree for a transaction.
  * @param[in]  transaction  The transaction.
@@ -385,6 +416,23 @@ BCX_API pt::ptree prop_list(const bc::hash_digest& hash, size_t height,
 BCX_API pt::ptree prop_tree(const bc::hash_digest& hash, size_t height,
     size_t index);
 
+/**
+ * Create a property list for a transaction of an ancestry.
+ * @param[in]  ancestor  The transaction and its parents.
+ * @param[in]  json      Use json array formatting.
+ * @returns              A new property list containing the transaction.
+ */
+BCX_API pt::ptree prop_list(const ancestor& ancestor, bool json);
+
+/**
+ * Create a property tree for the tx-ancestors command.
+ * @param[in]  ancestors  The transaction and its ancestors.
+ * @param[in]  json       Use json array formatting.
+ * @returns               A new property tree containing the list.
+ */
+BCX_API pt::ptree prop_tree(const std::vector<ancestor>& ancestors,
+    bool json);
+
 /**
  * Create a property tree for the settings command.
  * @param[in]  settings   The list of settings.
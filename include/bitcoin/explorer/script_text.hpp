@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_SCRIPT_TEXT_HPP
+#define BX_SCRIPT_TEXT_HPP
+
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The standard output script templates.
+ */
+enum class standard_script
+{
+    non_standard,
+    pay_key_hash,
+    pay_script_hash,
+    pay_multisig,
+    null_data
+};
+
+/**
+ * Match a serialized script to a standard template, without parsing it.
+ * Multisig is one to sixteen of up to sixteen keys, each a minimal push of a
+ * compressed or uncompressed key. Null data is return followed by a single
+ * push of at most 80 bytes.
+ * @param[in]  script  The serialized script.
+ * @return             The template, non_standard if none.
+ */
+BCX_API standard_script match_standard_script(data_slice script);
+
+/**
+ * The name of a standard script template, as that of its script pattern.
+ * @param[in]  type  The template.
+ * @return           The name, such as 'pay_key_hash'.
+ */
+BCX_API std::string standard_script_name(standard_script type);
+
+/**
+ * Append the plain text tokens of a serialized script, as rendered by
+ * script-decode. Operations are read and written in place from tables of the
+ * opcode names, and standard templates are written without reading their
+ * operations.
+ * @param[out] out     The text to append to.
+ * @param[in]  script  The serialized script.
+ */
+BCX_API void append_script_text(std::string& out, data_slice script);
+
+/**
+ * Append the serialization of plain text script tokens, as encoded by
+ * script-encode. Opcode names and data pushes are read from tables, and other
+ * tokens, such as numbers and quoted text, are parsed as operations.
+ * @param[out] out   The data to append to, unchanged on failure.
+ * @param[in]  text  The script tokens, separated by whitespace.
+ * @return           False if a token is not valid.
+ */
+BCX_API bool append_script_data(data_chunk& out, data_slice text);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,88 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_SHA256_HPP
+#define BX_SHA256_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The SHA256 initial hash state.
+ */
+BCX_API extern const std::array<uint32_t, 8> sha256_initial;
+
+/**
+ * The SHA256 round constants.
+ */
+BCX_API extern const std::array<uint32_t, 64> sha256_constants;
+
+/**
+ * Incremental SHA256 hash state. The state may be copied at any point, so a
+ * message prefix shared by many messages (a midstate) is hashed only once.
+ */
+class sha256_context
+{
+public:
+
+    /**
+     * Construct an instance of the sha256_context class in the initial state.
+     */
+    BCX_API sha256_context();
+
+    /**
+     * Hash the next part of the message.
+     * @param[in]  data  The message bytes to hash.
+     * @param[in]  size  The number of message bytes to hash.
+     */
+    BCX_API void write(const uint8_t* data, size_t size);
+
+    /**
+     * Hash the next part of the message.
+     * @param[in]  data  The message bytes to hash.
+     */
+    BCX_API void write(data_slice data);
+
+    /**
+     * Pad the message and get its hash. The state is not modified, so the
+     * message may be extended after this call.
+     * @return  The SHA256 hash of all message bytes written.
+     */
+    BCX_API hash_digest finalize() const;
+
+private:
+    void transform(const uint8_t* block);
+
+    std::array<uint32_t, 8> state_;
+    std::array<uint8_t, 64> buffer_;
+    uint64_t size_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_SIGHASH_CONTEXT_HPP
+#define BX_SIGHASH_CONTEXT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/sha256.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Signature hash state for the inputs of a single transaction. The serialized
+ * components shared by the signature hashes of all inputs (prevouts,
+ * sequences and outputs) are cached for each sighash type on construction,
+ * along with the hash midstate preceding each input. Signing or validating an
+ * input therefore neither copies nor reserializes the transaction. The
+ * instance is not modified after construction and may be shared by threads.
+ */
+class sighash_context
+{
+public:
+
+    /**
+     * Construct an instance of the sighash_context class.
+     * @param[in]  tx  The transaction, which is not referenced after return.
+     */
+    BCX_API sighash_context(const tx_type& tx);
+
+    /**
+     * Get the signature hash of an input, equivalent to that produced by
+     * chain::script::generate_signature_hash for the same transaction.
+     * @param[in]  index         The index of the input to hash.
+     * @param[in]  contract      The previous output script of the input.
+     * @param[in]  sighash_type  The sighash type of the signature.
+     * @return                   The signature hash.
+     */
+    BCX_API hash_digest signature_hash(uint32_t index,
+        const chain::script& contract, uint8_t sighash_type) const;
+
+    /**
+     * Create an endorsement (DER signature and sighash type) for an input.
+     * @param[out] out           The endorsement.
+     * @param[in]  secret        The private key to sign with.
+     * @param[in]  contract      The previous output script of the input.
+     * @param[in]  index         The index of the input to sign.
+     * @param[in]  sighash_type  The sighash type of the signature.
+     * @return                   True if successful.
+     */
+    BCX_API bool create_endorsement(endorsement& out, const ec_secret& secret,
+        const chain::script& contract, uint32_t index,
+        uint8_t sighash_type) const;
+
+    /**
+     * Validate an input signature against a public key.
+     * @param[in]  signature     The parsed signature.
+     * @param[in]  sighash_type  The sighash type of the signature.
+     * @param[in]  public_key    The serialized public key.
+     * @param[in]  contract      The previous output script of the input.
+     * @param[in]  index         The index of the input to validate.
+     * @return                   True if the signature is valid.
+     */
+    BCX_API bool check_signature(const ec_signature& signature,
+        uint8_t sighash_type, data_slice public_key,
+        const chain::script& contract, uint32_t index) const;
+
+    /**
+     * The number of inputs in the transaction.
+     */
+    BCX_API size_t inputs() const;
+
+private:
+    uint32_t version_;
+    uint32_t locktime_;
+    size_t inputs_;
+    size_t outputs_;
+
+    // Inputs with empty scripts, with and without their own sequences.
+    data_chunk inputs_sequenced_;
+    data_chunk inputs_unsequenced_;
+
+    // Counted outputs and the offset of each output within them.
+    data_chunk outputs_all_;
+    std::vector<size_t> output_offsets_;
+
+    // Hash midstates of the inputs that precede each input, by sequencing.
+    std::vector<sha256_context> prefixes_sequenced_;
+    std::vector<sha256_context> prefixes_unsequenced_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
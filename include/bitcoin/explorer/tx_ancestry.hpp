@@ -0,0 +1,153 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_TX_ANCESTRY_HPP
+#define BX_TX_ANCESTRY_HPP
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <unordered_set>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * A transaction of an ancestry, with the hashes of its parents.
+ */
+struct BCX_API ancestor
+{
+    /**
+     * The transaction hash.
+     */
+    hash_digest hash;
+
+    /**
+     * The number of generations from the starting transaction, at which the
+     * transaction was first reached.
+     */
+    size_t depth;
+
+    /**
+     * True if the transaction is in a block, which ends its branch.
+     */
+    bool confirmed;
+
+    /**
+     * The height of the block of a confirmed transaction.
+     */
+    size_t height;
+
+    /**
+     * The distinct previous output hashes of an unconfirmed transaction.
+     */
+    hash_list parents;
+};
+
+/**
+ * A walk of the unconfirmed ancestors of a transaction.
+ *
+ * Each transaction is first looked up in the block index. A confirmed
+ * transaction ends its branch, otherwise the transaction is fetched and its
+ * parents are queued, up to the depth limit. Queries are issued as soon as
+ * their hashes are known, up to the window of concurrent queries, and each
+ * hash is queried once however many children it has.
+ *
+ * The fetchers may complete their handlers before returning or later, but
+ * all handlers must be invoked on one thread.
+ */
+class BCX_API tx_ancestry
+{
+public:
+    typedef std::function<void(const code&, size_t)> index_handler;
+    typedef std::function<void(const code&, const chain::transaction&)>
+        transaction_handler;
+    typedef std::function<void(const hash_digest&, index_handler)>
+        index_fetcher;
+    typedef std::function<void(const hash_digest&, transaction_handler)>
+        transaction_fetcher;
+
+    /**
+     * Construct an ancestry walk.
+     * @param[in]  fetch_index  Get the block height of a transaction, with
+     *                          error::not_found if it is not confirmed.
+     * @param[in]  fetch_tx     Get an unconfirmed transaction.
+     * @param[in]  window       The maximum number of queries in flight.
+     * @param[in]  depth        The maximum number of generations to walk.
+     */
+    tx_ancestry(index_fetcher fetch_index, transaction_fetcher fetch_tx,
+        size_t window, size_t depth);
+
+    /**
+     * Start the walk from a transaction, which is the first ancestor.
+     * @param[in]  hash  The hash of the transaction.
+     */
+    void start(const hash_digest& hash);
+
+    /**
+     * True if no queries are queued or in flight.
+     */
+    bool complete() const;
+
+    /**
+     * The first query failure, which stops the walk.
+     */
+    const code& error() const;
+
+    /**
+     * The transactions of the walk, in the order that they were reached.
+     */
+    const std::vector<ancestor>& ancestors() const;
+
+private:
+    struct hash_hasher
+    {
+        size_t operator()(const hash_digest& hash) const;
+    };
+
+    void enqueue(const hash_digest& hash, size_t depth);
+    void issue();
+    void query(size_t position);
+    void handle_index(size_t position, const code& ec, size_t height);
+    void handle_transaction(size_t position, const code& ec,
+        const chain::transaction& tx);
+    void fail(const code& ec);
+
+    const index_fetcher fetch_index_;
+    const transaction_fetcher fetch_tx_;
+    const size_t window_;
+    const size_t depth_;
+
+    std::vector<ancestor> ancestors_;
+    std::unordered_set<hash_digest, hash_hasher> seen_;
+    std::deque<size_t> queue_;
+    size_t pending_;
+    bool issuing_;
+    code error_;
+};
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
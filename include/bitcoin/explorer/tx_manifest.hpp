@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_TX_MANIFEST_HPP
+#define BX_TX_MANIFEST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * Append the inputs and outputs of a transaction manifest to a transaction.
+ * Each line of the manifest is an input or an output, either as comma
+ * separated values or as a flat JSON object:
+ *
+ *   input,TXHASH,INDEX[,SEQUENCE]
+ *   output,TARGET,SATOSHI
+ *   {"hash": "TXHASH", "index": INDEX[, "sequence": SEQUENCE]}
+ *   {"target": "TARGET", "amount": SATOSHI}
+ *
+ * TARGET is a payment address or a Base16 script. Stealth addresses are not
+ * supported in a manifest. Empty lines and lines that begin with '#' are
+ * ignored. The manifest is parsed in place, the inputs and outputs of the
+ * transaction are reserved in advance, and parsed values are appended
+ * directly to the transaction.
+ * @param[out] tx              The transaction to append to.
+ * @param[out] invalid         The one-based number of the first line that is
+ *                             not valid, if any.
+ * @param[in]  manifest        The manifest text.
+ * @param[in]  script_version  The pay-to-script-hash address version.
+ * @return                     True if all lines are valid.
+ */
+BCX_API bool read_tx_manifest(chain::transaction& tx, size_t& invalid,
+    data_slice manifest, uint8_t script_version);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
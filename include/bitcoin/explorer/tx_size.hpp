@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BX_TX_SIZE_HPP
+#define BX_TX_SIZE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/config/output.hpp>
+
+/* NOTE: don't declare 'using namespace foo' in headers. */
+
+namespace libbitcoin {
+namespace explorer {
+
+/**
+ * The script that an input is expected to have once signed.
+ */
+enum class input_script
+{
+    pay_key_hash,
+    pay_key_hash_uncompressed,
+    pay_public_key,
+    pay_script_hash_multisig,
+    pay_witness_key_hash,
+    pay_script_hash_witness_key_hash
+};
+
+/**
+ * The expected script of an input, with the number of signatures and of
+ * compressed public keys of a multisig script.
+ */
+struct BCX_API input_script_type
+{
+    input_script script;
+    uint8_t signatures;
+    uint8_t keys;
+};
+
+/**
+ * The serialized size of a transaction, including any witnesses, with its
+ * weight and virtual size.
+ */
+struct BCX_API tx_size
+{
+    size_t size;
+    size_t weight;
+    size_t virtual_size;
+};
+
+/**
+ * Parse an input script type token, one of 'p2pkh', 'p2pkh-uncompressed',
+ * 'p2pk', 'p2wpkh', 'p2sh-p2wpkh' or 'p2sh-multisig:M:N' (for M signatures
+ * of N keys).
+ * @param[out] out    The input script type.
+ * @param[in]  token  The token.
+ * @return            True if the token is valid.
+ */
+BCX_API bool parse_input_script_type(input_script_type& out,
+    const std::string& token);
+
+/**
+ * Append the script sizes of the outputs of an output option, a stealth
+ * output being preceded by its null data output.
+ * @param[out] out             The script sizes to append to.
+ * @param[in]  output          The output.
+ * @param[in]  script_version  The pay-to-script-hash address version.
+ */
+BCX_API void append_script_sizes(std::vector<size_t>& out,
+    const config::output& output, uint8_t script_version);
+
+/**
+ * Estimate the size of a transaction once its inputs are signed, without
+ * serializing it. Inputs and outputs are summed from the sizes of their
+ * scripts, and each signature is presumed to be of the maximal size, so the
+ * size is an upper bound that is exact but for signature lengths.
+ * @param[in]  inputs        The expected script types of the inputs.
+ * @param[in]  script_sizes  The script sizes of the outputs.
+ * @return                   The estimated size.
+ */
+BCX_API tx_size estimate_tx_size(const std::vector<input_script_type>& inputs,
+    const std::vector<size_t>& script_sizes);
+
+} // namespace explorer
+} // namespace libbitcoin
+
+#endif
@@ -56,6 +56,13 @@ typedef std::vector<name_value_pair> name_value_pairs;
  */
 class command;
 
+/**
+ * Forward declaration to break header cycle.
+ */
+namespace config {
+    class transaction;
+}
+
 /**
  * Convert a text string to the specified type.
  * @param      <Value>  The converted type.
@@ -129,6 +136,19 @@ template <typename Value>
 void load_input(Value& parameter, const std::string& name,
     po::variables_map& variables, std::istream& input, bool raw);
 
+/**
+ * If the transaction is not yet loaded, load from stdin as fallback. If the
+ * binary option is specified the transaction is read in its wire encoding,
+ * otherwise as Base16.
+ * @param[in]  name       The parameter name.
+ * @param[in]  variables  The loaded variables.
+ * @param[in]  input      The input stream for loading the parameter.
+ * @param[in]  raw        True if the input is raw (should not be trimmed).
+ */
+BCX_API void load_input(config::transaction& parameter,
+    const std::string& name, po::variables_map& variables,
+    std::istream& input, bool raw);
+
 /**
  * Load file contents as parameter fallback. Obtain the path from the parameter
  * in the variables map.
@@ -141,6 +161,42 @@ template <typename Value>
 void load_path(Value& parameter, const std::string& name,
     po::variables_map& variables, bool raw);
 
+/**
+ * Invoke a handler once for each index in the range [0, count). The range is
+ * partitioned into contiguous blocks, one per thread, and the call returns
+ * once all handlers have completed. The handler must not throw.
+ * @param      <Handler>  The handler type, void(size_t index).
+ * @param[in]  count      The number of indexes to process.
+ * @param[in]  handler    The handler to invoke for each index.
+ * @param[in]  threads    The number of threads, zero implies one per core.
+ */
+template <typename Handler>
+void parallel_for(size_t count, Handler handler, size_t threads=0);
+
+/**
+ * Invoke a handler once for each index in the range [0, count). Each thread
+ * claims the next unprocessed index as it becomes idle, which balances work
+ * of uneven cost across threads. The call returns once all handlers have
+ * completed. The handler must not throw.
+ * @param      <Handler>  The handler type, void(size_t index).
+ * @param[in]  count      The number of indexes to process.
+ * @param[in]  handler    The handler to invoke for each index.
+ * @param[in]  threads    The number of threads, zero implies one per core.
+ */
+template <typename Handler>
+void parallel_for_dynamic(size_t count, Handler handler, size_t threads=0);
+
+/**
+ * Get the number of threads for work in which each thread requires a fixed
+ * amount of working memory, such as scrypt. The result is limited by the
+ * requested threads (zero implies one per core) and by the physical memory
+ * currently available, and is never less than one.
+ * @param[in]  threads  The requested number of threads, zero for one per core.
+ * @param[in]  memory   The working memory required by each thread in bytes.
+ * @return              The number of threads.
+ */
+BCX_API size_t memory_bounded_threads(size_t threads, uint64_t memory);
+
 /**
  * Conveniently convert an instance of the specified type to string.
  * @param      <Value>   The type to serialize.
@@ -174,6 +230,92 @@ template <typename Instance>
 void write_file(std::ostream& output, const std::string& path,
     const Instance& instance, bool terminate=true);
 
+/**
+ * Decode Base16 text of either case into a buffer, reading each character
+ * value from a table.
+ * @param[out] out   The buffer, contents are unspecified on failure.
+ * @param[in]  size  The size of the buffer.
+ * @param[in]  text  The Base16 text, of twice the buffer size.
+ * @return           False if the text is not valid Base16 of that size.
+ */
+BCX_API bool decode_base16_into(uint8_t* out, size_t size, data_slice text);
+
+/**
+ * Append the data of Base16 text of either case.
+ * @param[out] out   The data to append to, unchanged on failure.
+ * @param[in]  text  The Base16 text.
+ * @return           False if the text is not valid Base16.
+ */
+BCX_API bool append_base16_data(data_chunk& out, data_slice text);
+
+/**
+ * Append the lower case Base16 encoding of data.
+ * @param[out] out   The text to append to.
+ * @param[in]  data  The data.
+ */
+BCX_API void append_base16_text(std::string& out, data_slice data);
+
+/**
+ * Remove surrounding whitespace from text in place.
+ * @param[in]  text  The text.
+ * @return           The text without surrounding whitespace, a slice of it.
+ */
+BCX_API data_slice trim_slice(data_slice text);
+
+/**
+ * Split text into lines in place, ignoring blank lines.
+ * @param[out] out    The lines that are not blank, each a slice of the text.
+ * @param[out] lines  The one-based number of each line.
+ * @param[in]  text   The text to split.
+ * @param[in]  trim   Remove surrounding whitespace, otherwise remove only
+ *                    the line terminator, a new line and optional return.
+ */
+BCX_API void split_lines(std::vector<data_slice>& out,
+    std::vector<size_t>& lines, data_slice text, bool trim=true);
+
+/**
+ * Decode each line of text as Base16 data, ignoring surrounding whitespace
+ * and blank lines.
+ * @param[out] out   The decoded data, one item per line that is not blank.
+ * @param[out] line  The one-based number of the first line that is not
+ *                   valid Base16, if any.
+ * @param[in]  text  The text to decode.
+ * @return           True if all lines that are not blank are valid.
+ */
+BCX_API bool decode_base16_lines(data_stack& out, size_t& line,
+    const data_chunk& text);
+
+/**
+ * Deserialize each line of text as a value, ignoring surrounding whitespace
+ * and blank lines.
+ * @param      <Value>  The value type, which must be deserializable.
+ * @param[out] out      The values, one item per line that is not blank.
+ * @param[out] line     The one-based number of the first line that is not
+ *                      a valid value, if any.
+ * @param[in]  text     The text to deserialize.
+ * @return              True if all lines that are not blank are valid.
+ */
+template <typename Value>
+bool deserialize_lines(std::vector<Value>& out, size_t& line,
+    const data_chunk& text);
+
+/**
+ * Parse an HD (BIP32) derivation path, as indexes separated by '/', each
+ * followed by an apostrophe if hardened, optionally preceded by 'm'.
+ * @param[out] out   The child positions, hardened positions offset.
+ * @param[in]  path  The path, such as m/44'/0'/0'/0/0.
+ * @return           True if the path is valid.
+ */
+BCX_API bool parse_hd_path(std::vector<uint32_t>& out,
+    const std::string& path);
+
+/**
+ * Encode an HD (BIP32) derivation path in the form read by parse_hd_path.
+ * @param[in]  path  The child positions, hardened positions offset.
+ * @return           The path, such as m/44'/0'/0'/0/0.
+ */
+BCX_API std::string encode_hd_path(const std::vector<uint32_t>& path);
+
 /**
  * Get the connection settings for the configured network.
  * @param    command  The command.
@@ -158,12 +158,13 @@ public:
 .   pluralized_name = pluralize(name, is_vector)
 .   getter = "get_" + "$(pluralized_name:lower,c)" + "_argument()"
 .#   bool_vector = if_else(is_vector, xml_true, xml_false)
-.   if (is_xml_true(argument.file))
+.   if (is_xml_true(argument.file) | is_xml_true(argument.stdin))
         const auto raw = requires_raw_input();
+.   endif
+.   if (is_xml_true(argument.file))
         load_path($(getter), "$(name)", variables, raw);
 .   endif
 .   if (is_xml_true(argument.stdin))
-        const auto raw = requires_raw_input();
         load_input($(getter), "$(name)", variables, input, raw);
 .   endif
 .endfor
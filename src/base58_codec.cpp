@@ -0,0 +1,288 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/base58_codec.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+static const char alphabet[] =
+    "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+constexpr uint32_t radix = 58;
+constexpr char zero_digit = '1';
+
+// Base58 limbs are five digits, 58^5 < 2^30, so a limb shifted by a 32 bit
+// word fits in 64 bits.
+constexpr size_t limb_digits = 5;
+constexpr uint32_t limb_radix = 656356768;
+
+// Values of up to this many bytes are converted in fixed size buffers.
+constexpr size_t small_size = 128;
+constexpr size_t small_digits = 175;
+
+// The limbs required for a value, with 58^5 > 2^29 and 2^32 > 58^5.
+constexpr size_t base58_limbs(size_t bytes)
+{
+    return (bytes * 8) / 29 + 1;
+}
+
+constexpr size_t binary_limbs(size_t digits)
+{
+    return (digits * limb_digits) / 27 + 1;
+}
+
+// Address and extended key sizes, and their Base58 lengths.
+constexpr size_t address_size = 25;
+constexpr size_t hd_key_size = 82;
+constexpr size_t address_digits = 34;
+constexpr size_t hd_key_digits = 111;
+
+static std::array<int8_t, 256> make_digit_table()
+{
+    std::array<int8_t, 256> table;
+    table.fill(-1);
+    for (size_t digit = 0; digit < radix; ++digit)
+        table[static_cast<uint8_t>(alphabet[digit])] =
+            static_cast<int8_t>(digit);
+
+    return table;
+}
+
+static const auto digit_table = make_digit_table();
+
+// Convert big endian bytes to Base58 limbs, a 32 bit word at a time.
+template <typename Limbs>
+static std::string encode(Limbs& limbs, const uint8_t* data, size_t size)
+{
+    size_t zeros = 0;
+    while (zeros < size && data[zeros] == 0)
+        ++zeros;
+
+    size_t used = 0;
+    for (auto position = zeros; position < size;)
+    {
+        // The first word is partial, so that the rest are whole.
+        const auto remaining = (size - position) % 4;
+        const auto bytes = remaining == 0 ? 4 : remaining;
+
+        uint64_t carry = 0;
+        for (size_t byte = 0; byte < bytes; ++byte)
+            carry = (carry << 8) | data[position++];
+
+        const auto shift = 8 * bytes;
+        for (size_t limb = 0; limb < used; ++limb)
+        {
+            const auto value = (uint64_t(limbs[limb]) << shift) + carry;
+            limbs[limb] = static_cast<uint32_t>(value % limb_radix);
+            carry = value / limb_radix;
+        }
+
+        for (; carry != 0; carry /= limb_radix)
+            limbs[used++] = static_cast<uint32_t>(carry % limb_radix);
+    }
+
+    std::string out(zeros, zero_digit);
+    if (used == 0)
+        return out;
+
+    // The most significant limb is written without leading zero digits.
+    char digits[limb_digits];
+    auto value = limbs[used - 1];
+    auto digit = limb_digits;
+    for (; value != 0; value /= radix)
+        digits[--digit] = alphabet[value % radix];
+
+    out.append(digits + digit, digits + limb_digits);
+
+    for (auto limb = used - 1; limb-- > 0;)
+    {
+        value = limbs[limb];
+        for (digit = limb_digits; digit-- > 0; value /= radix)
+            digits[digit] = alphabet[value % radix];
+
+        out.append(digits, digits + limb_digits);
+    }
+
+    return out;
+}
+
+// Convert Base58 digits to 32 bit limbs, five digits at a time.
+template <typename Limbs>
+static bool decode(data_chunk& out, Limbs& limbs, const std::string& text)
+{
+    const auto size = text.size();
+
+    size_t ones = 0;
+    while (ones < size && text[ones] == zero_digit)
+        ++ones;
+
+    size_t used = 0;
+    for (auto position = ones; position < size;)
+    {
+        // The first group is partial, so that the rest are whole.
+        const auto remaining = (size - position) % limb_digits;
+        const auto digits = remaining == 0 ? limb_digits : remaining;
+
+        uint64_t carry = 0;
+        uint64_t multiplier = 1;
+        for (size_t digit = 0; digit < digits; ++digit)
+        {
+            const auto value = digit_table[static_cast<uint8_t>(
+                text[position++])];
+
+            if (value < 0)
+                return false;
+
+            carry = carry * radix + value;
+            multiplier *= radix;
+        }
+
+        for (size_t limb = 0; limb < used; ++limb)
+        {
+            const auto value = limbs[limb] * multiplier + carry;
+            limbs[limb] = static_cast<uint32_t>(value);
+            carry = value >> 32;
+        }
+
+        for (; carry != 0; carry >>= 32)
+            limbs[used++] = static_cast<uint32_t>(carry);
+    }
+
+    out.assign(ones, 0);
+    if (used == 0)
+        return true;
+
+    // The most significant limb is written without leading zero bytes.
+    const auto top = limbs[used - 1];
+    auto shift = 32;
+    while (shift > 0 && (top >> (shift - 8)) == 0)
+        shift -= 8;
+
+    out.reserve(ones + 4 * used);
+    for (; shift > 0; shift -= 8)
+        out.push_back(static_cast<uint8_t>(top >> (shift - 8)));
+
+    for (auto limb = used - 1; limb-- > 0;)
+        for (shift = 32; shift > 0; shift -= 8)
+            out.push_back(static_cast<uint8_t>(limbs[limb] >> (shift - 8)));
+
+    return true;
+}
+
+// The common sizes are compiled with constant sizes, allowing the loops to
+// be unrolled.
+template <size_t Size>
+static std::string encode_fixed(const uint8_t* data)
+{
+    std::array<uint32_t, base58_limbs(Size)> limbs;
+    return encode(limbs, data, Size);
+}
+
+template <size_t Digits>
+static bool decode_fixed(data_chunk& out, const std::string& text)
+{
+    std::array<uint32_t, binary_limbs(Digits)> limbs;
+    return decode(out, limbs, text);
+}
+
+std::string to_base58(data_slice data)
+{
+    const auto size = data.size();
+
+    if (size == address_size)
+        return encode_fixed<address_size>(data.data());
+
+    if (size == hd_key_size)
+        return encode_fixed<hd_key_size>(data.data());
+
+    if (size <= small_size)
+    {
+        std::array<uint32_t, base58_limbs(small_size)> limbs;
+        return encode(limbs, data.data(), size);
+    }
+
+    std::vector<uint32_t> limbs(base58_limbs(size));
+    return encode(limbs, data.data(), size);
+}
+
+bool from_base58(data_chunk& out, const std::string& text)
+{
+    const auto size = text.size();
+
+    if (size == address_digits)
+        return decode_fixed<address_digits>(out, text);
+
+    if (size == hd_key_digits)
+        return decode_fixed<hd_key_digits>(out, text);
+
+    if (size <= small_digits)
+    {
+        std::array<uint32_t, binary_limbs(small_digits)> limbs;
+        return decode(out, limbs, text);
+    }
+
+    std::vector<uint32_t> limbs(binary_limbs(size));
+    return decode(out, limbs, text);
+}
+
+std::vector<std::string> to_base58_batch(const data_stack& values,
+    size_t threads)
+{
+    std::vector<std::string> out(values.size());
+
+    const auto encode_value = [&](size_t index)
+    {
+        out[index] = to_base58(values[index]);
+    };
+
+    parallel_for(values.size(), encode_value, threads);
+    return out;
+}
+
+bool from_base58_batch(data_stack& out, size_t& invalid,
+    const std::vector<std::string>& texts, size_t threads)
+{
+    const auto count = texts.size();
+    std::vector<uint8_t> valid(count, 0);
+    out.resize(count);
+
+    const auto decode_text = [&](size_t index)
+    {
+        valid[index] = from_base58(out[index], texts[index]);
+    };
+
+    parallel_for(count, decode_text, threads);
+
+    const auto it = std::find(valid.begin(), valid.end(), 0);
+    invalid = std::distance(valid.begin(), it);
+    return it == valid.end();
+}
+
+} // namespace explorer
+} // namespace libbitcoin
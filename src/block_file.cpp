@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/block_file.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <bitcoin/bitcoin.hpp>
+
+using namespace boost::iostreams;
+
+namespace libbitcoin {
+namespace explorer {
+
+// The magic and the block size, each four bytes.
+constexpr size_t record_prefix_size = 2 * sizeof(uint32_t);
+
+bool read_block_records(std::vector<data_slice>& out, data_slice file,
+    uint32_t magic)
+{
+    out.clear();
+    const auto pattern = to_little_endian(magic);
+    const auto end = file.end();
+    auto position = file.begin();
+
+    while (true)
+    {
+        position = std::search(position, end, pattern.begin(),
+            pattern.end());
+
+        const auto remaining = static_cast<size_t>(std::distance(position,
+            end));
+
+        // A magic without room for its size begins a truncated record.
+        if (remaining < record_prefix_size)
+            return remaining == 0;
+
+        const auto size = from_little_endian_unsafe<uint32_t>(
+            position + sizeof(uint32_t));
+
+        const auto block = position + record_prefix_size;
+        if (remaining - record_prefix_size < size)
+            return false;
+
+        out.emplace_back(block, block + size);
+        position = block + size;
+    }
+}
+
+bool parse_block_record(chain::block& out, data_slice record)
+{
+    const auto begin = reinterpret_cast<const char*>(record.begin());
+    stream<array_source> source(begin, record.size());
+    istream_reader reader(source);
+    return out.from_data(reader) && reader.is_exhausted();
+}
+
+bool parse_block_header(chain::header& out, data_slice record)
+{
+    const auto begin = reinterpret_cast<const char*>(record.begin());
+    stream<array_source> source(begin, record.size());
+    istream_reader reader(source);
+    return out.from_data(reader);
+}
+
+} // namespace explorer
+} // namespace libbitcoin
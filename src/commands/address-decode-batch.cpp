@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/address-decode-batch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base58_codec.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/multi_sha256.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+// A payment address is a version byte, a short hash and a checksum.
+constexpr size_t address_payload_size = 1 + short_hash_size;
+constexpr size_t address_size = address_payload_size + checksum_size;
+
+console_result address_decode_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto threads = get_threads_option();
+    const data_chunk& text = get_payment_addresses_argument();
+
+    // Blank lines are skipped, the line of each address is retained.
+    std::vector<data_slice> rows;
+    std::vector<size_t> lines;
+    split_lines(rows, lines, text);
+
+    std::vector<std::string> addresses;
+    addresses.reserve(rows.size());
+    for (const auto& row: rows)
+        addresses.emplace_back(row.begin(), row.end());
+
+    size_t invalid;
+    data_stack decoded;
+    if (!from_base58_batch(decoded, invalid, addresses, threads))
+    {
+        error << format(BX_ADDRESS_DECODE_BATCH_INVALID_ADDRESS) %
+            lines[invalid] << std::endl;
+        return console_result::failure;
+    }
+
+    const auto count = decoded.size();
+    data_stack payloads(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto& address = decoded[index];
+        if (address.size() != address_size)
+        {
+            error << format(BX_ADDRESS_DECODE_BATCH_INVALID_ADDRESS) %
+                lines[index] << std::endl;
+            return console_result::failure;
+        }
+
+        payloads[index].assign(address.begin(),
+            address.begin() + address_payload_size);
+    }
+
+    const auto checksums = bitcoin_hash_batch(payloads);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        const auto& address = decoded[index];
+        if (!std::equal(address.begin() + address_payload_size,
+            address.end(), checksums[index].begin()))
+        {
+            error << format(BX_ADDRESS_DECODE_BATCH_INVALID_ADDRESS) %
+                lines[index] << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    for (const auto& payload: payloads)
+        output << static_cast<uint32_t>(payload.front()) << " " <<
+            encode_base16(data_chunk(payload.begin() + 1, payload.end())) <<
+            std::endl;
+
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
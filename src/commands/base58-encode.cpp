@@ -21,6 +21,7 @@
 
 #include <iostream>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base58_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 
 namespace libbitcoin {
@@ -33,7 +34,7 @@ console_result base58_encode::invoke(std::ostream& output, std::ostream& error)
     // Bound parameters.
     const auto& base16 = get_base16_argument();
     
-    output << base58(base16) << std::endl;
+    output << to_base58(base16) << std::endl;
     return console_result::okay;
 }
 
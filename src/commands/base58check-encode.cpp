@@ -21,6 +21,7 @@
 
 #include <iostream>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base58_codec.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/config/wrapper.hpp>
 
@@ -39,9 +40,8 @@ console_result base58check_encode::invoke(std::ostream& output,
 
     const wrapper wrapped(version, payload);
     const auto encoded_wrapper = wrapped.to_data();
-    const base58 base58check(encoded_wrapper);
 
-    output << base58check << std::endl;
+    output << to_base58(encoded_wrapper) << std::endl;
     return console_result::okay;
 }
 
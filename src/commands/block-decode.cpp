@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/block-decode.hpp>
+
+#include <iostream>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::explorer::config;
+
+console_result block_decode::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto binary = get_binary_option();
+    const auto& encoding = get_format_option();
+    const auto threads = get_threads_option();
+    const data_chunk& data = get_block_argument();
+
+    chain::block block;
+
+    if (binary)
+    {
+        if (!block.from_data(data))
+        {
+            error << BX_BLOCK_DECODE_INVALID_BLOCK << std::endl;
+            return console_result::failure;
+        }
+    }
+    else
+    {
+        // The text is decoded in place, without a trimmed copy.
+        data_chunk decoded;
+        if (!append_base16_data(decoded, trim_slice(data)) ||
+            !block.from_data(decoded))
+        {
+            error << BX_BLOCK_DECODE_INVALID_BLOCK << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    // This enables json-style array formatting.
+    const auto json = encoding == encoding_engine::json;
+
+    write_stream(output, prop_tree(block, json, threads), encoding);
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
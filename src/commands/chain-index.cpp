@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/chain-index.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/history_index.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+console_result chain_index::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto& directory = get_index_option();
+    const auto magic = get_magic_option();
+    const auto threads = get_threads_option();
+    const auto& files = get_files_argument();
+
+    history_index index(directory);
+    if (!index.load())
+    {
+        error << format(BX_CHAIN_INDEX_INVALID_INDEX) % directory <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    // The files remain mapped until the blocks are indexed, and the file of
+    // each block is retained for reporting.
+    std::list<file_contents> contents;
+    std::vector<data_slice> records;
+    std::vector<size_t> origins;
+
+    for (size_t file = 0; file < files.size(); ++file)
+    {
+        const auto& path = files[file];
+        contents.emplace_back(path);
+        if (!contents.back().valid())
+        {
+            error << format(BX_CHAIN_INDEX_FILE_NOT_FOUND) % path << std::endl;
+            return console_result::failure;
+        }
+
+        std::vector<data_slice> file_records;
+        if (!read_block_records(file_records, contents.back().data(), magic))
+        {
+            error << format(BX_CHAIN_INDEX_TRUNCATED) % path << std::endl;
+            return console_result::failure;
+        }
+
+        records.insert(records.end(), file_records.begin(),
+            file_records.end());
+        origins.resize(records.size(), file);
+    }
+
+    size_t indexed;
+    size_t invalid;
+    switch (index.append(indexed, invalid, records, threads))
+    {
+        case history_index_result::invalid_block:
+        {
+            // The offset is that of the record, which begins with the magic
+            // and the block size.
+            const auto file = std::next(contents.begin(), origins[invalid]);
+            const auto offset = std::distance(file->data().begin(),
+                records[invalid].begin()) - 2 * sizeof(uint32_t);
+
+            error << format(BX_CHAIN_INDEX_INVALID_BLOCK) %
+                files[origins[invalid]] % offset << std::endl;
+            return console_result::failure;
+        }
+        case history_index_result::file_failure:
+            error << format(BX_CHAIN_INDEX_WRITE_FAILURE) % directory <<
+                std::endl;
+            return console_result::failure;
+        default:
+            break;
+    }
+
+    output << format(BX_CHAIN_INDEX_INDEXED) % indexed % index.blocks() <<
+        std::endl;
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
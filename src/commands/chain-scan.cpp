@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/chain-scan.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::config;
+using namespace bc::wallet;
+
+// The addresses keyed by payload hash and the serialized scripts, so that
+// only matches are encoded.
+struct scan_targets
+{
+    std::map<short_hash, payment_address> addresses;
+    std::set<data_chunk> scripts;
+};
+
+// Get the matched address of a script, as prop_list does for tx inputs.
+static bool match_address(std::string& out, const scan_targets& targets,
+    const chain::script& script)
+{
+    if (targets.addresses.empty())
+        return false;
+
+    const auto address = payment_address::extract(script);
+    if (!address)
+        return false;
+
+    const auto it = targets.addresses.find(address.hash());
+    if (it == targets.addresses.end())
+        return false;
+
+    out = it->second.encoded();
+    return true;
+}
+
+// Get the matched Base16 script of an output script.
+static bool match_script(std::string& out, const scan_targets& targets,
+    const chain::script& script)
+{
+    if (targets.scripts.empty())
+        return false;
+
+    const auto data = script.to_data(false);
+    if (targets.scripts.find(data) == targets.scripts.end())
+        return false;
+
+    out = encode_base16(data);
+    return true;
+}
+
+// Write the matching outputs and inputs of a block, in transaction order.
+static void scan_block(std::ostream& output, const chain::block& block,
+    const scan_targets& targets)
+{
+    std::string target;
+
+    for (const auto& tx: block.transactions())
+    {
+        const auto& outputs = tx.outputs();
+        for (uint32_t index = 0; index < outputs.size(); ++index)
+        {
+            const auto& script = outputs[index].script();
+            if (!match_address(target, targets, script) &&
+                !match_script(target, targets, script))
+                continue;
+
+            output << "output " << hash256(block.header().hash()) << " " <<
+                hash256(tx.hash()) << ":" << index << " " <<
+                outputs[index].value() << " " << target << std::endl;
+        }
+
+        // The previous output script is not in the input, so inputs are
+        // matched by the address of their signature only.
+        const auto& inputs = tx.inputs();
+        for (uint32_t index = 0; index < inputs.size(); ++index)
+        {
+            if (!match_address(target, targets, inputs[index].script()))
+                continue;
+
+            const auto& point = inputs[index].previous_output();
+            output << "input " << hash256(block.header().hash()) << " " <<
+                hash256(tx.hash()) << ":" << index << " " <<
+                hash256(point.hash()) << ":" << point.index() << " " <<
+                target << std::endl;
+        }
+    }
+}
+
+console_result chain_scan::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto magic = get_magic_option();
+    const auto threads = get_threads_option();
+    const auto& addresses = get_addresses_option();
+    const auto& scripts = get_scripts_option();
+    const auto& files = get_files_argument();
+
+    if (addresses.empty() && scripts.empty())
+    {
+        error << BX_CHAIN_SCAN_NO_TARGETS << std::endl;
+        return console_result::failure;
+    }
+
+    scan_targets targets;
+    for (const auto& address: addresses)
+        targets.addresses.emplace(address.hash(), address);
+
+    for (const auto& script: scripts)
+        targets.scripts.insert(script.to_data());
+
+    // The blocks of each file are parsed and matched concurrently, and the
+    // matches are written in file order once the file is complete.
+    for (const auto& path: files)
+    {
+        const file_contents file(path);
+        if (!file.valid())
+        {
+            error << format(BX_CHAIN_SCAN_FILE_NOT_FOUND) % path << std::endl;
+            return console_result::failure;
+        }
+
+        const auto contents = file.data();
+
+        std::vector<data_slice> records;
+        const auto complete = read_block_records(records, contents, magic);
+
+        // Blocks vary widely in size, so each thread claims the next block.
+        std::vector<std::string> matches(records.size());
+        std::vector<uint8_t> valid(records.size(), 0);
+
+        const auto scan = [&](size_t index)
+        {
+            chain::block block;
+            if (!parse_block_record(block, records[index]))
+                return;
+
+            std::ostringstream stream;
+            scan_block(stream, block, targets);
+            matches[index] = stream.str();
+            valid[index] = 1;
+        };
+
+        parallel_for_dynamic(records.size(), scan, threads);
+
+        for (size_t index = 0; index < records.size(); ++index)
+        {
+            if (valid[index] == 0)
+            {
+                // The offset is that of the record, which begins with the
+                // magic and the block size.
+                const auto offset = std::distance(contents.begin(),
+                    records[index].begin()) - 2 * sizeof(uint32_t);
+
+                error << format(BX_CHAIN_SCAN_INVALID_BLOCK) % path % offset
+                    << std::endl;
+                return console_result::failure;
+            }
+
+            output << matches[index];
+        }
+
+        if (!complete)
+        {
+            error << format(BX_CHAIN_SCAN_TRUNCATED) % path << std::endl;
+            return console_result::failure;
+        }
+    }
+
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
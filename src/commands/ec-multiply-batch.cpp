@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/ec-multiply-batch.hpp>
+
+#include <iostream>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::wallet;
+
+console_result ec_multiply_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto threads = get_threads_option();
+    const auto& point = get_point_argument();
+    const data_chunk& text = get_secrets_argument();
+
+    size_t line;
+    std::vector<config::ec_private> keys;
+    if (!deserialize_lines(keys, line, text))
+    {
+        error << format(BX_EC_MULTIPLY_BATCH_INVALID_SECRET) % line <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    // The secrets are multiplied by libsecp256k1 in constant time. The
+    // secrets are valid, so the multiplication cannot fail.
+    std::vector<ec_compressed> products(keys.size(), point.point());
+    const auto multiply = [&](size_t index)
+    {
+        const ec_secret& secret = keys[index];
+        bc::ec_multiply(products[index], secret);
+    };
+
+    parallel_for(keys.size(), multiply, threads);
+
+    // Serialize to the original compression state.
+    for (const auto& product: products)
+        output << ec_public(product, point.compressed()) << std::endl;
+
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/ec-to-address-batch.hpp>
+
+#include <iostream>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/multi_sha256.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::wallet;
+
+console_result ec_to_address_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto version = get_version_option();
+    const data_chunk& text = get_ec_public_keys_argument();
+
+    size_t line;
+    std::vector<ec_public> keys;
+    if (!deserialize_lines(keys, line, text))
+    {
+        error << format(BX_EC_TO_ADDRESS_BATCH_INVALID_KEY) % line <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    // Serialize each key in its original compression state.
+    data_stack encoded(keys.size());
+    for (size_t index = 0; index < keys.size(); ++index)
+        keys[index].to_data(encoded[index]);
+
+    const auto hashes = bitcoin_short_hash_batch(encoded);
+
+    for (const auto& hash: hashes)
+        output << payment_address(hash, version) << std::endl;
+
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/ec-to-public-batch.hpp>
+
+#include <iostream>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::wallet;
+
+console_result ec_to_public_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto threads = get_threads_option();
+    const auto uncompressed = get_uncompressed_option();
+    const data_chunk& text = get_ec_private_keys_argument();
+
+    size_t line;
+    std::vector<config::ec_private> keys;
+    if (!deserialize_lines(keys, line, text))
+    {
+        error << format(BX_EC_TO_PUBLIC_BATCH_INVALID_KEY) % line <<
+            std::endl;
+        return console_result::failure;
+    }
+
+    // The keys are secrets, so each is derived by libsecp256k1 in constant
+    // time. The keys are valid, so the derivation cannot fail.
+    std::vector<ec_compressed> points(keys.size());
+    const auto derive = [&](size_t index)
+    {
+        const ec_secret& secret = keys[index];
+        secret_to_public(points[index], secret);
+    };
+
+    parallel_for(keys.size(), derive, threads);
+
+    // Serialize to the requested compression state.
+    for (const auto& point: points)
+        output << ec_public(point, !uncompressed) << std::endl;
+
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
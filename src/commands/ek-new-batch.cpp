@@ -0,0 +1,156 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/ek-new-batch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::wallet;
+
+// A seed and the key pair created from it, populated concurrently.
+struct key_record
+{
+    size_t line;
+    bool parsed;
+    bool created;
+    ek_seed seed;
+    encrypted_private secret;
+    ec_compressed point;
+};
+
+static bool parse_seed(ek_seed& out, data_slice text)
+{
+    data_chunk seed;
+    if (!append_base16_data(seed, text) || seed.size() < ek_seed_size)
+        return false;
+
+    std::copy(seed.begin(), seed.begin() + ek_seed_size, out.begin());
+    return true;
+}
+
+static std::vector<key_record> parse_seeds(const data_chunk& data)
+{
+    std::vector<data_slice> rows;
+    std::vector<size_t> lines;
+    split_lines(rows, lines, data);
+
+    std::vector<key_record> records(rows.size());
+    for (size_t index = 0; index < rows.size(); ++index)
+    {
+        auto& record = records[index];
+        record.line = lines[index];
+        record.parsed = parse_seed(record.seed, rows[index]);
+        record.created = false;
+    }
+
+    return records;
+}
+
+console_result ek_new_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto threads = get_threads_option();
+    const auto uncompressed = get_uncompressed_option();
+    const uint8_t version = get_version_option();
+    const encrypted_token& token = get_token_argument();
+    const data_chunk& data = get_seeds_argument();
+
+    auto records = parse_seeds(data);
+
+    // Report all unusable seeds before doing any of the expensive work.
+    auto result = console_result::okay;
+    for (const auto& record: records)
+    {
+        if (!record.parsed)
+        {
+            error << format(BX_EK_NEW_BATCH_INVALID_SEED) % record.line <<
+                std::endl;
+            result = console_result::failure;
+        }
+    }
+
+    if (result != console_result::okay)
+        return result;
+
+    const auto compressed = !uncompressed;
+
+    // Each key pair requires a point multiplication and a scrypt derivation,
+    // independent across seeds. The token is parsed again by each creation,
+    // which is negligible beside the derivation.
+    const auto create = [&](size_t index)
+    {
+        auto& record = records[index];
+        record.created = create_key_pair(record.secret, record.point, token,
+            record.seed, version, compressed);
+    };
+
+    // The first key pair is created alone, so that a token that cannot be
+    // used is reported once, before the rest of the batch is derived.
+    if (!records.empty())
+    {
+        create(0);
+        if (records.front().created)
+        {
+            const auto rest = [&](size_t offset)
+            {
+                create(offset + 1);
+            };
+
+            parallel_for(records.size() - 1, rest, threads);
+        }
+    }
+
+    const auto failed = std::find_if(records.begin(), records.end(),
+        [](const key_record& record)
+        {
+            return !record.created;
+        });
+
+    if (failed != records.end())
+    {
+        error << BX_EK_NEW_BATCH_INVALID_TOKEN << std::endl;
+        return console_result::failure;
+    }
+
+    // Results are written in seed order, regardless of completion order.
+    for (const auto& record: records)
+    {
+        const payment_address address({ record.point, compressed }, version);
+        output << ek_private(record.secret) << " " << address << std::endl;
+    }
+
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
@@ -0,0 +1,146 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/ek-to-ec-batch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::wallet;
+
+// Jobs per thread in each window, bounding the results held before writing.
+constexpr size_t jobs_per_thread = 4;
+
+// An encrypted key and its decryption, populated concurrently.
+struct decrypt_record
+{
+    size_t line;
+    std::string text;
+    ek_private key;
+    bool decrypted;
+    ec_secret secret;
+};
+
+static std::vector<decrypt_record> parse_keys(const data_chunk& data)
+{
+    std::vector<data_slice> rows;
+    std::vector<size_t> lines;
+    split_lines(rows, lines, data);
+
+    std::vector<decrypt_record> records(rows.size());
+    for (size_t index = 0; index < rows.size(); ++index)
+    {
+        auto& record = records[index];
+        record.line = lines[index];
+        record.text.assign(rows[index].begin(), rows[index].end());
+        record.key = ek_private(record.text);
+        record.decrypted = false;
+    }
+
+    return records;
+}
+
+console_result ek_to_ec_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+#ifdef WITH_ICU
+    // Bound parameters.
+    const auto threads = get_threads_option();
+    const auto& passphrase = get_passphrase_argument();
+    const data_chunk& data = get_ek_private_keys_argument();
+
+    auto records = parse_keys(data);
+
+    // Report all unusable keys before doing any of the expensive work.
+    auto result = console_result::okay;
+    for (const auto& record: records)
+    {
+        if (!record.key)
+        {
+            error << format(BX_EK_TO_EC_BATCH_INVALID_KEY) % record.line <<
+                std::endl;
+            result = console_result::failure;
+        }
+    }
+
+    if (result != console_result::okay)
+        return result;
+
+    // Each decryption holds an scrypt working buffer for its duration, so
+    // concurrency is limited by available memory as well as by processors.
+    const auto pool = memory_bounded_threads(threads, bip38_scrypt_memory);
+    const auto window = pool * jobs_per_thread;
+
+    for (size_t begin = 0; begin < records.size(); begin += window)
+    {
+        const auto end = std::min(begin + window, records.size());
+
+        const auto decrypt_key = [&](size_t offset)
+        {
+            bool compressed;
+            uint8_t version;
+            auto& record = records[begin + offset];
+            record.decrypted = decrypt(record.secret, version, compressed,
+                record.key, passphrase);
+        };
+
+        parallel_for(end - begin, decrypt_key, pool);
+
+        // Results are streamed in key order as each window completes.
+        for (auto index = begin; index < end; ++index)
+        {
+            const auto& record = records[index];
+            if (record.decrypted)
+            {
+                output << record.text << " " <<
+                    config::ec_private(record.secret) << std::endl;
+            }
+            else
+            {
+                error << format(BX_EK_TO_EC_BATCH_INVALID_PASSPHRASE) %
+                    record.line << std::endl;
+                result = console_result::failure;
+            }
+        }
+
+        output.flush();
+    }
+
+    return result;
+#else
+    error << BX_EK_TO_EC_BATCH_REQUIRES_ICU << std::endl;
+    return console_result::failure;
+#endif
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
@@ -21,11 +21,13 @@
 #include <bitcoin/explorer/commands/fetch-balance.hpp>
 
 #include <iostream>
+#include <boost/format.hpp>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/client.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/history_index.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
 
 namespace libbitcoin {
@@ -39,9 +41,28 @@ console_result fetch_balance::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto& encoding = get_format_option();
+    const auto& directory = get_index_option();
+    const auto offline = get_offline_option();
     const auto& address = get_payment_address_argument();
     const auto connection = get_connection(*this);
 
+    if (offline)
+    {
+        history::list rows;
+        history_index index(directory);
+        if (!index.load() || index.blocks() == 0 ||
+            !index.history(rows, address))
+        {
+            error << format(BX_FETCH_BALANCE_INVALID_INDEX) % directory <<
+                std::endl;
+            return console_result::failure;
+        }
+
+        callback_state state(error, output, encoding);
+        state.output(prop_tree(rows, address));
+        return state.get_result();
+    }
+
     obelisk_client client(connection);
 
     if (!client.connect(connection))
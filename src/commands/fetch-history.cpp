@@ -21,10 +21,12 @@
 #include <bitcoin/explorer/commands/fetch-history.hpp>
 
 #include <iostream>
+#include <boost/format.hpp>
 #include <bitcoin/client.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/history_index.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
 
 namespace libbitcoin {
@@ -45,9 +47,31 @@ console_result fetch_history::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
     const auto& encoding = get_format_option();
+    const auto& directory = get_index_option();
+    const auto offline = get_offline_option();
     const auto& address = get_payment_address_argument();
     const auto connection = get_connection(*this);
 
+    // This enables json-style array formatting.
+    const auto json = encoding == encoding_engine::json;
+
+    if (offline)
+    {
+        history::list rows;
+        history_index index(directory);
+        if (!index.load() || index.blocks() == 0 ||
+            !index.history(rows, address))
+        {
+            error << format(BX_FETCH_HISTORY_INVALID_INDEX) % directory <<
+                std::endl;
+            return console_result::failure;
+        }
+
+        callback_state state(error, output, encoding);
+        state.output(prop_tree(rows, json));
+        return state.get_result();
+    }
+
     obelisk_client client(connection);
 
     if (!client.connect(connection))
@@ -58,9 +82,6 @@ console_result fetch_history::invoke(std::ostream& output, std::ostream& error)
 
     callback_state state(error, output, encoding);
 
-    // This enables json-style array formatting.
-    const auto json = encoding == encoding_engine::json;
-
     auto on_done = [&state, &address, json](const history::list& rows)
     {
         state.output(prop_tree(rows, json));
@@ -21,10 +21,12 @@
 #include <bitcoin/explorer/commands/fetch-utxo.hpp>
 
 #include <iostream>
+#include <boost/format.hpp>
 #include <bitcoin/client.hpp>
 #include <bitcoin/explorer/callback_state.hpp>
 #include <bitcoin/explorer/define.hpp>
 #include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/history_index.hpp>
 #include <bitcoin/explorer/prop_tree.hpp>
 #include <bitcoin/explorer/config/algorithm.hpp>
 
@@ -39,10 +41,43 @@ console_result fetch_utxo::invoke(std::ostream& output, std::ostream& error)
     // Bound parameters.
     const auto& encoding = get_format_option();
     const auto algorithm = get_algorithm_option();
+    const auto& directory = get_index_option();
+    const auto offline = get_offline_option();
     const auto satoshi = get_satoshi_argument();
     const auto& address = get_payment_address_argument();
     const auto connection = get_connection(*this);
 
+    // This enables json-style array formatting.
+    const auto json = encoding == encoding_engine::json;
+
+    if (offline)
+    {
+        bc::chain::history::list rows;
+        history_index index(directory);
+        if (!index.load() || index.blocks() == 0 ||
+            !index.history(rows, address))
+        {
+            error << format(BX_FETCH_UTXO_INVALID_INDEX) % directory <<
+                std::endl;
+            return console_result::failure;
+        }
+
+        // The unspent outputs are selected as the client selects them from
+        // the server history.
+        bc::chain::output_info::list unspent;
+        for (const auto& row: rows)
+            if (row.spend.hash() == null_hash)
+                unspent.push_back({ row.output, row.value });
+
+        bc::chain::points_info selected_utxos;
+        bc::wallet::select_outputs::select(selected_utxos, unspent, satoshi,
+            algorithm);
+
+        callback_state state(error, output, encoding);
+        state.output(prop_tree(selected_utxos, json));
+        return state.get_result();
+    }
+
     obelisk_client client(connection);
 
     if (!client.connect(connection))
@@ -53,9 +88,6 @@ console_result fetch_utxo::invoke(std::ostream& output, std::ostream& error)
 
     callback_state state(error, output, encoding);
 
-    // This enables json-style array formatting.
-    const auto json = encoding == encoding_engine::json;
-
     auto on_done = [&state, json](const bc::chain::points_info& selected_utxos)
     {
         state.output(prop_tree(selected_utxos, json));
@@ -0,0 +1,136 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/hash-batch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/multi_sha256.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::config;
+
+// A hash algorithm of the single-value commands, applied to a batch.
+struct batch_algorithm
+{
+    const char* name;
+    data_stack (*hash)(const data_stack& messages);
+};
+
+template <typename Hash>
+static data_stack to_stack(const std::vector<Hash>& hashes)
+{
+    data_stack out;
+    out.reserve(hashes.size());
+
+    for (const auto& hash: hashes)
+        out.push_back(to_chunk(hash));
+
+    return out;
+}
+
+static data_stack hash_bitcoin160(const data_stack& messages)
+{
+    return to_stack(bitcoin_short_hash_batch(messages));
+}
+
+// The byte order is reversed, as by bitcoin256.
+static data_stack hash_bitcoin256(const data_stack& messages)
+{
+    auto out = to_stack(bitcoin_hash_batch(messages));
+
+    for (auto& hash: out)
+        std::reverse(hash.begin(), hash.end());
+
+    return out;
+}
+
+// There is no SHA256 component, so each message is hashed in turn.
+static data_stack hash_sha160(const data_stack& messages)
+{
+    data_stack out;
+    out.reserve(messages.size());
+
+    for (const auto& message: messages)
+        out.push_back(to_chunk(sha1_hash(message)));
+
+    return out;
+}
+
+static data_stack hash_sha256(const data_stack& messages)
+{
+    return to_stack(sha256_hash_batch(messages));
+}
+
+static const std::array<batch_algorithm, 4> algorithms
+{
+    {
+        { "bitcoin160", hash_bitcoin160 },
+        { "bitcoin256", hash_bitcoin256 },
+        { "sha160", hash_sha160 },
+        { "sha256", hash_sha256 }
+    }
+};
+
+console_result hash_batch::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto& name = get_algorithm_option();
+    const data_chunk& text = get_base16s_argument();
+
+    const auto algorithm = std::find_if(algorithms.begin(), algorithms.end(),
+        [&name](const batch_algorithm& item)
+        {
+            return name == item.name;
+        });
+
+    if (algorithm == algorithms.end())
+    {
+        error << format(BX_HASH_BATCH_INVALID_ALGORITHM) % name << std::endl;
+        return console_result::failure;
+    }
+
+    size_t line;
+    data_stack messages;
+    if (!decode_base16_lines(messages, line, text))
+    {
+        error << format(BX_HASH_BATCH_INVALID_LINE) % line << std::endl;
+        return console_result::failure;
+    }
+
+    const auto hashes = algorithm->hash(messages);
+
+    for (const auto& hash: hashes)
+        output << base16(hash) << std::endl;
+
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
@@ -19,10 +19,12 @@
  */
 #include <bitcoin/explorer/commands/hd-private.hpp>
 
+#include <cstdint>
 #include <iostream>
+#include <vector>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
-
+#include <bitcoin/explorer/utility.hpp>
 
 namespace libbitcoin {
 namespace explorer {
@@ -33,11 +35,24 @@ console_result hd_private::invoke(std::ostream& output, std::ostream& error)
     // Bound parameters.
     const auto hard = get_hard_option();
     const auto index = get_index_option();
+    const auto& path_text = get_path_option();
     const auto& private_key = get_hd_private_key_argument();
     
-    static constexpr auto first = bc::wallet::hd_first_hardened_key;
-    const auto position = hard ? first + index : index;
-    const auto child_private_key = private_key.derive_private(position);
+    std::vector<uint32_t> path;
+    if (path_text.empty())
+    {
+        static constexpr auto first = bc::wallet::hd_first_hardened_key;
+        path.push_back(hard ? first + index : index);
+    }
+    else if (!parse_hd_path(path, path_text) || path.empty())
+    {
+        error << BX_HD_PRIVATE_INVALID_PATH << std::endl;
+        return console_result::failure;
+    }
+
+    auto child_private_key = private_key;
+    for (const auto position: path)
+        child_private_key = child_private_key.derive_private(position);
 
     if (!child_private_key)
     {
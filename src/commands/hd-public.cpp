@@ -19,20 +19,95 @@
  */
 #include <bitcoin/explorer/commands/hd-public.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <string>
+#include <vector>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
-
+#include <bitcoin/explorer/hd_cache.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 namespace libbitcoin {
 namespace explorer {
 namespace commands {
+using namespace bc::wallet;
+
+static bool is_hardened(uint32_t position)
+{
+    return position >= hd_first_hardened_key;
+}
+
+// Derive the public key at steps [begin, end) of the path, through the last
+// hardened step from the private key and from the public key thereafter.
+static hd_public derive_path(const hd_private& private_key,
+    const hd_public& public_key, const std::vector<uint32_t>& path,
+    size_t begin, size_t end)
+{
+    auto hardened_end = begin;
+    for (auto step = begin; step < end; ++step)
+        if (is_hardened(path[step]))
+            hardened_end = step + 1;
+
+    auto key = public_key;
+    if (hardened_end > begin)
+    {
+        if (!private_key)
+            return {};
+
+        auto child = private_key;
+        for (auto step = begin; step < hardened_end && child; ++step)
+            child = child.derive_private(path[step]);
+
+        key = child.to_public();
+    }
+
+    for (auto step = hardened_end; step < end && key; ++step)
+        key = key.derive_public(path[step]);
+
+    return key;
+}
+
+// Derive the key at the path from its deepest cached ancestor, and cache the
+// ancestor from which the last step is public (or the key itself if not).
+static hd_public derive_cached(hd_cache& cache, bool& stored,
+    const hd_private& private_key, const hd_public& public_key,
+    const std::vector<uint32_t>& path)
+{
+    stored = true;
+    const auto root = hd_cache::identify(public_key);
+    const auto target = is_hardened(path.back()) ? path.size() :
+        path.size() - 1;
+
+    size_t depth;
+    hd_public ancestor;
+    const auto found = cache.find(ancestor, depth, root, path);
+    if (found && depth >= target)
+        return derive_path({}, ancestor, path, depth, path.size());
+
+    // Without a cached ancestor the derivation starts from the root.
+    const auto& start = found ? ancestor : public_key;
+    const auto begin = found ? depth : 0;
+
+    const auto parent = derive_path(private_key, start, path, begin, target);
+    if (!parent)
+        return {};
+
+    if (target > 0)
+        stored = cache.store(root, std::vector<uint32_t>(path.begin(),
+            path.begin() + target), parent);
+
+    return derive_path({}, parent, path, target, path.size());
+}
 
 console_result hd_public::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
+    const auto& cache_file = get_cache_option();
     const auto hard = get_hard_option();
     const auto index = get_index_option();
+    const auto& path_text = get_path_option();
     const auto private_version = get_secret_version_option();
     const auto public_version = get_public_version_option();
     const auto& key = get_hd_key_argument();
@@ -49,44 +124,84 @@ console_result hd_public::invoke(std::ostream& output, std::ostream& error)
         error << BX_HD_PUBLIC_HARD_OPTION_CONFLICT << std::endl;
         return console_result::failure;
     }
-    
+
+    std::vector<uint32_t> path;
+    if (path_text.empty())
+    {
+        static constexpr auto first = hd_first_hardened_key;
+        path.push_back(hard ? first + index : index);
+    }
+    else if (!parse_hd_path(path, path_text) || path.empty())
+    {
+        error << BX_HD_PUBLIC_INVALID_PATH << std::endl;
+        return console_result::failure;
+    }
+
+    hd_private private_key;
+    hd_public public_key;
+
     if (key_version == private_version)
     {
-        const auto prefixes = bc::wallet::hd_private::to_prefixes(
-            key.version(), public_version);
+        const auto prefixes = hd_private::to_prefixes(key.version(),
+            public_version);
 
         // Derive the public key from new private key and the public version.
-        const bc::wallet::hd_private private_key(key, prefixes);
-        if (private_key)
-        {
-            static constexpr auto first = bc::wallet::hd_first_hardened_key;
-            const auto position = hard ? first + index : index;
+        private_key = hd_private(key, prefixes);
+        public_key = private_key.to_public();
+    }
+    else
+    {
+        public_key = hd_public(key, public_version);
+    }
+
+    if (!public_key)
+    {
+        output << "ERROR_KEY" << std::endl;
+        return console_result::okay;
+    }
 
-            const auto child_public_key = private_key.derive_public(position);
-            if (child_public_key)
+    hd_public child_public_key;
+    if (cache_file.empty() || path_text.empty())
+    {
+        if (!private_key && !path_text.empty())
+        {
+            for (const auto position: path)
             {
-                output << child_public_key << std::endl;
-                return console_result::okay;
+                if (is_hardened(position))
+                {
+                    error << BX_HD_PUBLIC_HARD_PATH_CONFLICT << std::endl;
+                    return console_result::failure;
+                }
             }
         }
+
+        child_public_key = derive_path(private_key, public_key, path, 0,
+            path.size());
     }
     else
     {
-        // Derive the public key from new private key and the public version.
-        const bc::wallet::hd_public public_key(key, public_version);
-        if (public_key)
+        bool stored;
+        hd_cache cache(cache_file, public_version);
+        child_public_key = derive_cached(cache, stored, private_key,
+            public_key, path);
+
+        if (!stored)
+            error << BX_HD_PUBLIC_CACHE_NOT_WRITTEN << std::endl;
+
+        if (!child_public_key && !private_key)
         {
-            const auto child_public_key = public_key.derive_public(index);
-            if (child_public_key)
-            {
-                output << child_public_key << std::endl;
-                return console_result::okay;
-            }
+            error << BX_HD_PUBLIC_HARD_PATH_CONFLICT << std::endl;
+            return console_result::failure;
         }
     }
 
+    if (!child_public_key)
+    {
+        output << "ERROR_KEY" << std::endl;
+        return console_result::okay;
+    }
 
-    output << "ERROR_KEY" << std::endl;
+    output << child_public_key << std::endl;
     return console_result::okay;
 }
 
@@ -22,6 +22,7 @@
 #include <iostream>
 #include <cstdint>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/sighash_context.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
 namespace libbitcoin {
@@ -52,8 +53,10 @@ console_result input_sign::invoke(std::ostream& output, std::ostream& error)
     if (anyone_can_pay)
         hash_type |= machine::sighash_algorithm::anyone_can_pay;
 
+    const sighash_context sighash(tx);
+
     endorsement endorse;
-    if (!script::create_endorsement(endorse, private_key, contract, tx, index,
+    if (!sighash.create_endorsement(endorse, private_key, contract, index,
         hash_type))
     {
         error << BX_INPUT_SIGN_FAILED << std::endl;
@@ -22,6 +22,7 @@
 #include <iostream>
 #include <cstdint>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/sighash_context.hpp>
 
 namespace libbitcoin {
 namespace explorer {
@@ -47,11 +48,12 @@ console_result input_validate::invoke(std::ostream& output,
 
     data_chunk point;
     ec_signature signature;
+    const sighash_context sighash(tx);
 
     if (endorse.empty() || !public_key.to_data(point) ||
         !parse_signature(signature, { endorse.begin(), endorse.end() - 1 },
             strict) ||
-        !script::check_signature(signature, endorse.back(), point, contract, tx,
+        !sighash.check_signature(signature, endorse.back(), point, contract,
             index))
     {
         // We do not return a failure here, as this is a validity test.
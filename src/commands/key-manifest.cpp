@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/key-manifest.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base58_codec.hpp>
+#include <bitcoin/explorer/config/ec_private.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/multi_sha256.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+// The WIF suffix that associates the key with the compressed public key.
+constexpr uint8_t wif_compressed_sentinel = 0x01;
+
+// Base58Check encode each payload, with the checksums computed together.
+static std::vector<std::string> encode_base58_checks(
+    const data_stack& payloads, size_t threads)
+{
+    const auto checksums = bitcoin_hash_batch(payloads);
+
+    data_stack checked(payloads);
+    for (size_t index = 0; index < payloads.size(); ++index)
+    {
+        const auto& checksum = checksums[index];
+        checked[index].insert(checked[index].end(), checksum.begin(),
+            checksum.begin() + checksum_size);
+    }
+
+    return to_base58_batch(checked, threads);
+}
+
+console_result key_manifest::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto threads = get_threads_option();
+    const auto uncompressed = get_uncompressed_option();
+    const uint8_t version = get_version_option();
+    const uint8_t wif_version = get_wif_version_option();
+    const data_chunk& text = get_ec_private_keys_argument();
+
+    size_t line;
+    std::vector<config::ec_private> keys;
+    if (!deserialize_lines(keys, line, text))
+    {
+        error << format(BX_KEY_MANIFEST_INVALID_KEY) % line << std::endl;
+        return console_result::failure;
+    }
+
+    const auto count = keys.size();
+    const std::vector<ec_secret> secrets(keys.begin(), keys.end());
+
+    // The keys are secrets, so each is derived by libsecp256k1 in constant
+    // time. The keys are valid, so the derivation cannot fail.
+    data_stack public_keys(count);
+    const auto derive = [&](size_t index)
+    {
+        if (uncompressed)
+        {
+            ec_uncompressed point;
+            secret_to_public(point, secrets[index]);
+            public_keys[index] = to_chunk(point);
+        }
+        else
+        {
+            ec_compressed point;
+            secret_to_public(point, secrets[index]);
+            public_keys[index] = to_chunk(point);
+        }
+    };
+
+    parallel_for(count, derive, threads);
+
+    // Each stage is performed over the whole batch, without re-encoding.
+    data_stack wif_payloads(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        auto& payload = wif_payloads[index];
+        payload.push_back(wif_version);
+        extend_data(payload, secrets[index]);
+
+        if (!uncompressed)
+            payload.push_back(wif_compressed_sentinel);
+    }
+
+    const auto hashes = bitcoin_short_hash_batch(public_keys);
+
+    data_stack address_payloads(count);
+    for (size_t index = 0; index < count; ++index)
+    {
+        auto& payload = address_payloads[index];
+        payload.push_back(version);
+        extend_data(payload, hashes[index]);
+    }
+
+    const auto wifs = encode_base58_checks(wif_payloads, threads);
+    const auto addresses = encode_base58_checks(address_payloads,
+        threads);
+
+    for (size_t index = 0; index < count; ++index)
+        output << wifs[index] << " " << encode_base16(public_keys[index]) <<
+            " " << addresses[index] << std::endl;
+
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
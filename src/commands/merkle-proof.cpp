@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/merkle-proof.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/merkle_tree.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::config;
+
+console_result merkle_proof::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto block = get_block_option();
+    const hash_digest& hash = get_hash_argument();
+    const data_chunk& text = get_hashes_argument();
+
+    size_t line;
+    hash_list leaves;
+    if (!read_merkle_leaves(leaves, line, text, block))
+    {
+        if (block)
+            error << BX_MERKLE_PROOF_INVALID_BLOCK << std::endl;
+        else
+            error << format(BX_MERKLE_PROOF_INVALID_HASH) % line << std::endl;
+
+        return console_result::failure;
+    }
+
+    const auto it = std::find(leaves.begin(), leaves.end(), hash);
+    if (it == leaves.end())
+    {
+        error << BX_MERKLE_PROOF_NOT_FOUND << std::endl;
+        return console_result::failure;
+    }
+
+    const size_t index = std::distance(leaves.begin(), it);
+
+    hash_list branch;
+    merkle_tree(leaves).branch(branch, index);
+
+    output << index << std::endl;
+    for (const auto& sibling: branch)
+        output << hash256(sibling) << std::endl;
+
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/merkle-verify.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <boost/lexical_cast.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/merkle_tree.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::config;
+
+// The proof is the position of the transaction then the branch hashes,
+// separated by whitespace.
+static bool read_proof(uint32_t& index, hash_list& branch,
+    const data_chunk& text)
+{
+    std::istringstream input(std::string(text.begin(), text.end()));
+
+    std::string token;
+    if (!(input >> token))
+        return false;
+
+    try
+    {
+        index = boost::lexical_cast<uint32_t>(token);
+    }
+    catch (const boost::bad_lexical_cast&)
+    {
+        return false;
+    }
+
+    branch.clear();
+    while (input >> token)
+    {
+        hash_digest sibling;
+        if (!decode_hash(sibling, token))
+            return false;
+
+        branch.push_back(sibling);
+    }
+
+    // The position must be within the tree of the branch.
+    return branch.size() >= 32 || (index >> branch.size()) == 0;
+}
+
+console_result merkle_verify::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const chain::header& header = get_header_argument();
+    const hash_digest& hash = get_hash_argument();
+    const data_chunk& text = get_proof_argument();
+
+    uint32_t index;
+    hash_list branch;
+    if (!read_proof(index, branch, text))
+    {
+        error << BX_MERKLE_VERIFY_INVALID_PROOF << std::endl;
+        return console_result::failure;
+    }
+
+    if (merkle_tree::branch_root(hash, branch, index) != header.merkle())
+    {
+        // We do not return a failure here, as this is a validity test.
+        output << BX_MERKLE_VERIFY_INVALID << std::endl;
+        return console_result::invalid;
+    }
+
+    output << BX_MERKLE_VERIFY_VALID << std::endl;
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/message-validate-batch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::wallet;
+
+// A signed message record, parsed before validation.
+struct message_record
+{
+    size_t line;
+    bool parsed;
+    payment_address address;
+    message_signature signature;
+    data_chunk message;
+};
+
+// Parse 'address signature message', where the message is the line remainder
+// and may be empty, in which case its separator may also be omitted.
+static bool parse_record(message_record& record, const std::string& text)
+{
+    const auto first = text.find(' ');
+    if (first == std::string::npos)
+        return false;
+
+    const auto found = text.find(' ', first + 1);
+    const auto second = found == std::string::npos ? text.size() : found;
+
+    record.address = payment_address(text.substr(0, first));
+    if (!record.address)
+        return false;
+
+    data_chunk decoded;
+    const auto encoded = text.substr(first + 1, second - first - 1);
+    if (!decode_base64(decoded, encoded) ||
+        decoded.size() != record.signature.size())
+        return false;
+
+    std::copy(decoded.begin(), decoded.end(), record.signature.begin());
+
+    if (second != text.size())
+        record.message.assign(text.begin() + second + 1, text.end());
+
+    return true;
+}
+
+static std::vector<message_record> parse_records(const data_chunk& data)
+{
+    // The message bytes are kept exactly, so only line terminators are removed.
+    std::vector<data_slice> rows;
+    std::vector<size_t> lines;
+    split_lines(rows, lines, data, false);
+
+    std::vector<message_record> records(rows.size());
+    for (size_t index = 0; index < rows.size(); ++index)
+    {
+        auto& record = records[index];
+        const std::string row(rows[index].begin(), rows[index].end());
+        record.line = lines[index];
+        record.parsed = parse_record(record, row);
+    }
+
+    return records;
+}
+
+console_result message_validate_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto threads = get_threads_option();
+    const data_chunk& data = get_records_argument();
+
+    const auto records = parse_records(data);
+    std::vector<uint8_t> valid(records.size(), 0);
+
+    // The message hash and public key recovery of each record are
+    // independent, so records are validated concurrently.
+    const auto validate = [&](size_t index)
+    {
+        const auto& record = records[index];
+        valid[index] = record.parsed && verify_message(record.message,
+            record.address, record.signature);
+    };
+
+    parallel_for(records.size(), validate, threads);
+
+    auto result = console_result::okay;
+    for (size_t index = 0; index < records.size(); ++index)
+    {
+        if (valid[index])
+            continue;
+
+        // We do not return a failure here, as this is a validity test.
+        const auto& record = records[index];
+        result = console_result::invalid;
+
+        if (!record.parsed)
+            output << format(BX_MESSAGE_VALIDATE_BATCH_INVALID_RECORD) %
+                record.line << std::endl;
+        else
+            output << format(BX_MESSAGE_VALIDATE_BATCH_INVALID_SIGNATURE) %
+                record.line % record.address.encoded() << std::endl;
+    }
+
+    return result;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
@@ -0,0 +1,462 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/mnemonic-recover.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mnemonic_index.hpp>
+#include <bitcoin/explorer/pbkdf2.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::config;
+using namespace bc::wallet;
+
+// BIP39 seed derivation parameters.
+static const std::string salt_prefix = "mnemonic";
+constexpr size_t seed_iterations = 2048;
+
+// Word placeholders.
+static const std::string unknown_word = "?";
+constexpr char prefix_marker = '*';
+
+// Candidates are reserved by the threads in chunks, in candidate order.
+constexpr uint64_t chunk_size = 4096;
+
+// Progress is reported at most once per interval.
+static const auto progress_interval = std::chrono::seconds(5);
+
+typedef std::chrono::steady_clock search_clock;
+
+// The candidate dictionary indexes of each word of the mnemonic.
+typedef std::vector<std::vector<uint16_t>> candidate_list;
+
+static bool is_placeholder(const std::string& word)
+{
+    return word == unknown_word ||
+        (!word.empty() && word.back() == prefix_marker);
+}
+
+// A word that is in none of the dictionaries is presumed misspelled.
+static bool is_recognized(const std::string& word,
+    const dictionary_list& lexicons)
+{
+    const auto& index = mnemonic_index::all();
+    const auto containing = index.languages({ word });
+
+    for (const auto lexicon: containing)
+        if (std::find(lexicons.begin(), lexicons.end(), lexicon) !=
+            lexicons.end())
+            return true;
+
+    return false;
+}
+
+static candidate_list to_candidates(const word_list& words,
+    const dictionary& lexicon)
+{
+    const auto& index = mnemonic_index::all();
+    candidate_list out(words.size());
+
+    for (size_t position = 0; position < words.size(); ++position)
+    {
+        const auto& word = words[position];
+        auto& candidates = out[position];
+        std::vector<uint16_t> found;
+
+        if (!is_placeholder(word) && index.find(found, { word }, lexicon))
+        {
+            candidates = found;
+            continue;
+        }
+
+        // The prefix is empty for an unknown or misspelled word.
+        const auto prefix = !word.empty() && word.back() == prefix_marker ?
+            word.substr(0, word.size() - 1) : std::string();
+
+        for (size_t entry = 0; entry < lexicon.size(); ++entry)
+            if (std::string(lexicon[entry]).compare(0, prefix.size(),
+                prefix) == 0)
+                candidates.push_back(static_cast<uint16_t>(entry));
+    }
+
+    return out;
+}
+
+static uint64_t to_rate(uint64_t count, double seconds)
+{
+    return seconds > 0 ? static_cast<uint64_t>(count / seconds) : count;
+}
+
+// Get the number of candidate mnemonics, false if not countable.
+static bool count_candidates(uint64_t& out, const candidate_list& candidates)
+{
+    out = 1;
+    for (const auto& words: candidates)
+    {
+        if (!words.empty() &&
+            out > std::numeric_limits<uint64_t>::max() / words.size())
+            return false;
+
+        out *= words.size();
+    }
+
+    return true;
+}
+
+// State shared by the search threads for the candidates of one dictionary.
+class mnemonic_recover_state
+{
+public:
+    mnemonic_recover_state(const candidate_list& candidates,
+        const dictionary& lexicon, const data_chunk& salt,
+        const std::vector<uint32_t>& path, const payment_address& address,
+        const hd_public& key, uint64_t total, std::ostream& error)
+      : candidates_(candidates), lexicon_(lexicon), salt_(salt),
+        path_(path), address_(address), key_(key), total_(total),
+        error_(error), start_(search_clock::now()), reported_(start_),
+        reserved_(0), checked_(0), derived_(0),
+        found_chunk_(std::numeric_limits<uint64_t>::max()),
+        found_(std::numeric_limits<uint64_t>::max())
+    {
+    }
+
+    void search()
+    {
+        const auto width = pbkdf2_sha512_lanes;
+        std::vector<uint16_t> indexes(candidates_.size());
+        std::vector<uint64_t> numbers;
+        data_stack sentences;
+
+        while (true)
+        {
+            const auto chunk = reserved_++;
+            const auto begin = chunk * chunk_size;
+            if (begin >= total_ || chunk > found_chunk_)
+                return;
+
+            const auto end = std::min(begin + chunk_size, total_);
+            for (auto number = begin; number < end; ++number)
+            {
+                // A match in a preceding chunk ends the search.
+                if (chunk > found_chunk_)
+                    return;
+
+                // Most candidates are rejected by the checksum alone.
+                to_indexes(indexes, number);
+                if (!mnemonic_index::checksum(indexes))
+                    continue;
+
+                numbers.push_back(number);
+                sentences.push_back(to_chunk(join(to_words(indexes))));
+
+                if (sentences.size() == width)
+                    derive(numbers, sentences);
+            }
+
+            derive(numbers, sentences);
+            checked_ += end - begin;
+            report();
+        }
+    }
+
+    bool found() const
+    {
+        return found_ != std::numeric_limits<uint64_t>::max();
+    }
+
+    word_list words() const
+    {
+        std::vector<uint16_t> indexes(candidates_.size());
+        to_indexes(indexes, found_);
+        return to_words(indexes);
+    }
+
+    uint64_t checked() const
+    {
+        return checked_;
+    }
+
+    uint64_t derived() const
+    {
+        return derived_;
+    }
+
+    double seconds() const
+    {
+        const auto elapsed = search_clock::now() - start_;
+        return std::chrono::duration<double>(elapsed).count();
+    }
+
+    uint64_t rate() const
+    {
+        return to_rate(derived_, seconds());
+    }
+
+private:
+    // The candidate number is a mixed radix value, the last word varying
+    // fastest.
+    void to_indexes(std::vector<uint16_t>& out, uint64_t number) const
+    {
+        for (auto position = candidates_.size(); position > 0; --position)
+        {
+            const auto& words = candidates_[position - 1];
+            out[position - 1] = words[number % words.size()];
+            number /= words.size();
+        }
+    }
+
+    word_list to_words(const std::vector<uint16_t>& indexes) const
+    {
+        word_list out;
+        out.reserve(indexes.size());
+        for (const auto index: indexes)
+            out.push_back(lexicon_[index]);
+
+        return out;
+    }
+
+    void derive(std::vector<uint64_t>& numbers, data_stack& sentences)
+    {
+        if (sentences.empty())
+            return;
+
+        const auto seeds = pbkdf2_sha512_batch(sentences, salt_,
+            seed_iterations);
+
+        for (size_t index = 0; index < seeds.size(); ++index)
+            if (matches(seeds[index]))
+                set_found(numbers[index]);
+
+        derived_ += seeds.size();
+        numbers.clear();
+        sentences.clear();
+    }
+
+    bool matches(const long_hash& seed) const
+    {
+        auto key = hd_private(to_chunk(seed));
+        for (const auto index: path_)
+        {
+            if (!key)
+                return false;
+
+            key = key.derive_private(index);
+        }
+
+        if (!key)
+            return false;
+
+        const auto public_key = key.to_public();
+
+        if (key_)
+            return public_key.point() == key_.point() &&
+                public_key.chain_code() == key_.chain_code();
+
+        return bitcoin_short_hash(public_key.point()) == address_.hash();
+    }
+
+    void set_found(uint64_t number)
+    {
+        std::lock_guard<std::mutex> lock(found_mutex_);
+
+        // Prefer the lowest candidate of concurrent matches, so the chunks
+        // preceding that of a match are always completed.
+        if (number < found_)
+        {
+            found_ = number;
+            found_chunk_ = number / chunk_size;
+        }
+    }
+
+    void report()
+    {
+        std::unique_lock<std::mutex> lock(report_mutex_, std::try_to_lock);
+        if (!lock.owns_lock())
+            return;
+
+        const auto now = search_clock::now();
+        if (now - reported_ < progress_interval)
+            return;
+
+        reported_ = now;
+        error_ << format(BX_MNEMONIC_RECOVER_PROGRESS) % checked_.load() %
+            total_ % derived_.load() % rate() << std::endl;
+    }
+
+    const candidate_list& candidates_;
+    const dictionary& lexicon_;
+    const data_chunk& salt_;
+    const std::vector<uint32_t>& path_;
+    const payment_address& address_;
+    const hd_public& key_;
+    const uint64_t total_;
+    std::ostream& error_;
+    const search_clock::time_point start_;
+    search_clock::time_point reported_;
+    std::atomic<uint64_t> reserved_;
+    std::atomic<uint64_t> checked_;
+    std::atomic<uint64_t> derived_;
+    std::atomic<uint64_t> found_chunk_;
+    uint64_t found_;
+    std::mutex found_mutex_;
+    std::mutex report_mutex_;
+};
+
+console_result mnemonic_recover::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto& address = get_address_option();
+    const auto& key = get_key_option();
+    const dictionary_list& language = get_language_option();
+    const auto& passphrase = get_passphrase_option();
+    const auto& path_text = get_path_option();
+    const auto threads = get_threads_option();
+    const auto& words = get_words_argument();
+
+    if (words.empty() || (words.size() % mnemonic_word_multiple) != 0)
+    {
+        error << BX_MNEMONIC_RECOVER_LENGTH_INVALID_SENTENCE << std::endl;
+        return console_result::failure;
+    }
+
+    if (!address == !key)
+    {
+        error << BX_MNEMONIC_RECOVER_TARGET_REQUIRED << std::endl;
+        return console_result::failure;
+    }
+
+    std::vector<uint32_t> path;
+    if (!parse_hd_path(path, path_text))
+    {
+        error << BX_MNEMONIC_RECOVER_INVALID_PATH << std::endl;
+        return console_result::failure;
+    }
+
+#ifdef WITH_ICU
+    const auto salt = to_chunk(to_normal_nfkd_form(salt_prefix + passphrase));
+#else
+    if (!passphrase.empty())
+    {
+        error << BX_MNEMONIC_RECOVER_PASSPHRASE_UNSUPPORTED << std::endl;
+        return console_result::failure;
+    }
+
+    // The passphrase requires ICU normalization.
+    const auto salt = to_chunk(salt_prefix);
+#endif
+
+    // The dictionaries are those containing all of the recognized words.
+    word_list known;
+    for (const auto& word: words)
+        if (!is_placeholder(word) && is_recognized(word, language))
+            known.push_back(word);
+
+    const auto containing = mnemonic_index::all().languages(known);
+    dictionary_list lexicons;
+    for (const auto lexicon: language)
+        if (std::find(containing.begin(), containing.end(), lexicon) !=
+            containing.end())
+            lexicons.push_back(lexicon);
+
+    if (lexicons.empty())
+    {
+        error << BX_MNEMONIC_RECOVER_INVALID_IN_LANGUAGES << std::endl;
+        return console_result::failure;
+    }
+
+    std::vector<candidate_list> candidates;
+    std::vector<uint64_t> totals;
+    for (const auto lexicon: lexicons)
+    {
+        uint64_t total;
+        candidates.push_back(to_candidates(words, *lexicon));
+        if (!count_candidates(total, candidates.back()))
+        {
+            error << BX_MNEMONIC_RECOVER_TOO_MANY_CANDIDATES << std::endl;
+            return console_result::failure;
+        }
+
+        totals.push_back(total);
+    }
+
+    const auto thread_count = threads == 0 ?
+        std::max(std::thread::hardware_concurrency(), 1u) : threads;
+
+    uint64_t checked = 0;
+    uint64_t derived = 0;
+    double seconds = 0;
+    word_list recovered;
+
+    // The dictionaries are searched in turn, in the order specified.
+    for (size_t ordinal = 0; ordinal < lexicons.size(); ++ordinal)
+    {
+        mnemonic_recover_state state(candidates[ordinal], *lexicons[ordinal],
+            salt, path, address, key, totals[ordinal], error);
+
+        const auto search = [&state](size_t)
+        {
+            state.search();
+        };
+
+        parallel_for(thread_count, search, thread_count);
+
+        checked += state.checked();
+        derived += state.derived();
+        seconds += state.seconds();
+
+        if (state.found())
+        {
+            recovered = state.words();
+            break;
+        }
+    }
+
+    error << format(BX_MNEMONIC_RECOVER_RATE) % checked % derived % seconds %
+        to_rate(derived, seconds) << std::endl;
+
+    if (recovered.empty())
+    {
+        error << BX_MNEMONIC_RECOVER_NOT_FOUND << std::endl;
+        return console_result::failure;
+    }
+
+    output << join(recovered) << std::endl;
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
@@ -0,0 +1,160 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/mnemonic-to-seed-batch.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/algorithm/string.hpp>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mnemonic_index.hpp>
+#include <bitcoin/explorer/pbkdf2.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::config;
+using namespace bc::wallet;
+
+// BIP39 seed derivation parameters.
+static const std::string salt_prefix = "mnemonic";
+constexpr size_t seed_iterations = 2048;
+
+// A mnemonic parsed from one line of the input.
+struct mnemonic_record
+{
+    size_t line;
+    word_list words;
+};
+
+static std::vector<mnemonic_record> parse_mnemonics(const data_chunk& data)
+{
+    std::vector<data_slice> rows;
+    std::vector<size_t> lines;
+    split_lines(rows, lines, data);
+
+    std::vector<mnemonic_record> records(rows.size());
+    for (size_t index = 0; index < rows.size(); ++index)
+    {
+        auto& record = records[index];
+        const std::string row(rows[index].begin(), rows[index].end());
+        record.line = lines[index];
+        boost::split(record.words, row, boost::is_space(),
+            boost::token_compress_on);
+    }
+
+    return records;
+}
+
+console_result mnemonic_to_seed_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const dictionary_list& language = get_language_option();
+    const auto& passphrase = get_passphrase_option();
+    const auto threads = get_threads_option();
+    const data_chunk& data = get_sentences_argument();
+
+#ifdef WITH_ICU
+    const auto salt = to_chunk(to_normal_nfkd_form(salt_prefix + passphrase));
+#else
+    if (!passphrase.empty())
+    {
+        error << BX_MNEMONIC_TO_SEED_BATCH_PASSPHRASE_UNSUPPORTED << std::endl;
+        return console_result::failure;
+    }
+
+    // The passphrase requires ICU normalization.
+    const auto salt = to_chunk(salt_prefix);
+#endif
+
+    const auto records = parse_mnemonics(data);
+
+    // Report all unusable mnemonics before doing any of the expensive work.
+    const auto& index = mnemonic_index::all();
+    auto result = console_result::okay;
+    for (const auto& record: records)
+    {
+        if ((record.words.size() % mnemonic_word_multiple) != 0)
+        {
+            error << format(BX_MNEMONIC_TO_SEED_BATCH_LENGTH_INVALID_SENTENCE) %
+                record.line << std::endl;
+            result = console_result::failure;
+            continue;
+        }
+
+        if (index.validate(record.words, language) != nullptr)
+            continue;
+
+        if (language.size() == 1)
+        {
+            // This is fatal because a dictionary was specified explicitly.
+            error << format(BX_MNEMONIC_TO_SEED_BATCH_INVALID_IN_LANGUAGE) %
+                record.line << std::endl;
+            result = console_result::failure;
+        }
+        else
+        {
+            error << format(BX_MNEMONIC_TO_SEED_BATCH_INVALID_IN_LANGUAGES) %
+                record.line << std::endl;
+        }
+    }
+
+    if (result != console_result::okay)
+        return result;
+
+    // Any word set divisible by 3 works regardless of language validation.
+    data_stack sentences;
+    sentences.reserve(records.size());
+    for (const auto& record: records)
+        sentences.push_back(to_chunk(join(record.words)));
+
+    // Each group of sentences is derived together, one per vector lane.
+    const auto width = pbkdf2_sha512_lanes;
+    const auto groups = (sentences.size() + width - 1) / width;
+    std::vector<long_hash> seeds(sentences.size());
+
+    const auto derive = [&](size_t group)
+    {
+        const auto begin = group * width;
+        const auto end = std::min(begin + width, sentences.size());
+        const data_stack passwords(sentences.begin() + begin,
+            sentences.begin() + end);
+        const auto keys = pbkdf2_sha512_batch(passwords, salt,
+            seed_iterations);
+        std::copy(keys.begin(), keys.end(), seeds.begin() + begin);
+    };
+
+    parallel_for(groups, derive, threads);
+
+    for (const auto& seed: seeds)
+        output << base16(seed) << std::endl;
+
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
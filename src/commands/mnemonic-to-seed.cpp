@@ -22,6 +22,7 @@
 #include <iostream>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mnemonic_index.hpp>
 
 namespace libbitcoin {
 namespace explorer {
@@ -45,7 +46,8 @@ console_result mnemonic_to_seed::invoke(std::ostream& output,
         return console_result::failure;
     }
 
-    const auto valid = validate_mnemonic(words, language);
+    const auto valid = mnemonic_index::all().validate(words, language) !=
+        nullptr;
 
     if (!valid && language.size() == 1)
     {
@@ -0,0 +1,90 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/explorer/commands/script-decode-batch.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/script_text.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+// The buffered text is written once it reaches this size.
+constexpr size_t write_size = 1024 * 1024;
+
+console_result script_decode_batch::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto pattern = get_pattern_option();
+    const data_chunk& text = get_base16s_argument();
+
+    std::vector<data_slice> rows;
+    std::vector<size_t> lines;
+    split_lines(rows, lines, text);
+
+    // The script and the text buffers are reused across lines.
+    data_chunk script;
+    std::string buffer;
+    buffer.reserve(write_size + 1024);
+
+    for (size_t index = 0; index < rows.size(); ++index)
+    {
+        script.clear();
+        if (!append_base16_data(script, rows[index]))
+        {
+            // The scripts of the preceding lines are written.
+            output << buffer << std::flush;
+            error << format(BX_SCRIPT_DECODE_BATCH_INVALID_LINE) %
+                lines[index] << std::endl;
+            return console_result::failure;
+        }
+
+        if (pattern)
+        {
+            buffer += standard_script_name(match_standard_script(script));
+            buffer += ' ';
+        }
+
+        append_script_text(buffer, script);
+        buffer += '\n';
+
+        if (buffer.size() >= write_size)
+        {
+            output << buffer;
+            buffer.clear();
+        }
+    }
+
+    output << buffer << std::flush;
+    return console_result::okay;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
@@ -0,0 +1,109 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/explorer/commands/tx-ancestors.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <bitcoin/client.hpp>
+#include <bitcoin/explorer/callback_state.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/display.hpp>
+#include <bitcoin/explorer/prop_tree.hpp>
+#include <bitcoin/explorer/tx_ancestry.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::client;
+using namespace bc::explorer::config;
+
+console_result tx_ancestors::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto depth = get_depth_option();
+    const auto& encoding = get_format_option();
+    const auto window = get_window_option();
+    const auto& hash = get_hash_argument();
+    const auto connection = get_connection(*this);
+
+    obelisk_client client(connection);
+
+    if (!client.connect(connection))
+    {
+        display_connection_failure(error, connection.server);
+        return console_result::failure;
+    }
+
+    callback_state state(error, output, encoding);
+
+    // This enables json-style array formatting.
+    const auto json = encoding == encoding_engine::json;
+
+    // The handlers are invoked by client.wait on this thread.
+    const auto fetch_index = [&client](const hash_digest& hash,
+        tx_ancestry::index_handler handler)
+    {
+        auto on_done = [handler](size_t height, size_t)
+        {
+            handler(error::success, height);
+        };
+
+        auto on_error = [handler](const code& error)
+        {
+            handler(error, 0);
+        };
+
+        client.blockchain_fetch_transaction_index(on_error, on_done, hash);
+    };
+
+    // Unconfirmed transactions are fetched from the transaction pool.
+    const auto fetch_tx = [&client](const hash_digest& hash,
+        tx_ancestry::transaction_handler handler)
+    {
+        auto on_done = [handler](const chain::transaction& tx)
+        {
+            handler(error::success, tx);
+        };
+
+        auto on_error = [handler](const code& error)
+        {
+            handler(error, {});
+        };
+
+        client.transaction_pool_fetch_transaction(on_error, on_done, hash);
+    };
+
+    tx_ancestry ancestry(fetch_index, fetch_tx, window, depth);
+    ancestry.start(hash);
+    client.wait();
+
+    if (ancestry.error())
+        state.succeeded(ancestry.error());
+    else
+        state.output(prop_tree(ancestry.ancestors(), json));
+
+    return state.get_result();
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
@@ -19,10 +19,17 @@
  */
 #include <bitcoin/explorer/commands/tx-encode.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <string>
 #include <vector>
+#include <boost/format.hpp>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/tx_manifest.hpp>
+#include <bitcoin/explorer/tx_size.hpp>
 #include <bitcoin/explorer/config/transaction.hpp>
 
 namespace libbitcoin {
@@ -81,10 +88,15 @@ console_result tx_encode::invoke(std::ostream& output, std::ostream& error)
     const auto script_version = get_script_version_option();
     const auto& inputs = get_inputs_option();
     const auto& outputs = get_outputs_option();
+    const auto& manifest = get_manifest_option();
+    const auto estimate = get_estimate_option();
+    const auto fee_rate = get_fee_rate_option();
 
     tx_type tx;
     tx.set_version(tx_version);
     tx.set_locktime(locktime);
+    tx.inputs().reserve(inputs.size());
+    tx.outputs().reserve(outputs.size());
 
     for (const tx_input_type& input: inputs)
         tx.inputs().push_back(input);
@@ -98,12 +110,48 @@ console_result tx_encode::invoke(std::ostream& output, std::ostream& error)
         }
     }
 
+    if (!manifest.empty())
+    {
+        // The manifest is parsed in place, mapped where supported.
+        const file_contents contents(manifest);
+        if (!contents.valid())
+        {
+            error << format(BX_TX_ENCODE_MANIFEST_NOT_FOUND) % manifest
+                << std::endl;
+            return console_result::failure;
+        }
+
+        size_t line;
+        if (!read_tx_manifest(tx, line, contents.data(), script_version))
+        {
+            error << format(BX_TX_ENCODE_INVALID_MANIFEST) % manifest % line
+                << std::endl;
+            return console_result::failure;
+        }
+    }
+
     if (tx.is_locktime_conflict())
     {
         error << BX_TX_ENCODE_LOCKTIME_CONFLICT << std::endl;
         return console_result::failure;
     }
 
+    if (estimate)
+    {
+        const std::vector<input_script_type> types(tx.inputs().size(),
+            { input_script::pay_key_hash, 1, 1 });
+
+        std::vector<size_t> script_sizes;
+        script_sizes.reserve(tx.outputs().size());
+        for (const auto& tx_output: tx.outputs())
+            script_sizes.push_back(tx_output.script().serialized_size(false));
+
+        const auto size = estimate_tx_size(types, script_sizes).size;
+        output << format(BX_TX_ENCODE_ESTIMATE) % size % (size * fee_rate)
+            << std::endl;
+        return console_result::okay;
+    }
+
     output << transaction(tx) << std::endl;
     return console_result::okay;
 }
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/explorer/commands/tx-estimate.hpp>
+
+#include <cstddef>
+#include <iostream>
+#include <vector>
+#include <boost/format.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/tx_size.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+console_result tx_estimate::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto fee_rate = get_fee_rate_option();
+    const auto& encoding = get_format_option();
+    const auto& script_types = get_script_types_option();
+    const auto script_version = get_script_version_option();
+    const auto& inputs = get_inputs_option();
+    const auto& outputs = get_outputs_option();
+
+    const auto count = inputs.size();
+
+    if (script_types.size() > 1 && script_types.size() != count)
+    {
+        error << BX_TX_ESTIMATE_TYPE_COUNT_MISMATCH << std::endl;
+        return console_result::failure;
+    }
+
+    // A single type applies to all inputs, and inputs default to p2pkh.
+    std::vector<input_script_type> types(count,
+        { input_script::pay_key_hash, 1, 1 });
+
+    for (size_t index = 0; index < script_types.size(); ++index)
+    {
+        input_script_type type;
+        if (!parse_input_script_type(type, script_types[index]))
+        {
+            error << format(BX_TX_ESTIMATE_INVALID_TYPE) %
+                script_types[index] << std::endl;
+            return console_result::failure;
+        }
+
+        if (script_types.size() == 1)
+            types.assign(count, type);
+        else
+            types[index] = type;
+    }
+
+    std::vector<size_t> script_sizes;
+    script_sizes.reserve(outputs.size());
+    for (const auto& output: outputs)
+        append_script_sizes(script_sizes, output, script_version);
+
+    const auto size = estimate_tx_size(types, script_sizes);
+
+    pt::ptree tree;
+    tree.put("estimate.size", size.size);
+    tree.put("estimate.virtual_size", size.virtual_size);
+    tree.put("estimate.weight", size.weight);
+    tree.put("estimate.fee", size.virtual_size * fee_rate);
+
+    write_stream(output, tree, encoding);
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin
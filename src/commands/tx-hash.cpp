@@ -0,0 +1,238 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/explorer/commands/tx-hash.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/cuckoo_filter.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/multi_sha256.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+
+// The number of transactions checked and hashed together on one thread.
+constexpr size_t chunk_size = 4096;
+
+// Advance past a number of bytes, false if fewer remain.
+static bool skip(const uint8_t*& position, const uint8_t* end, uint64_t size)
+{
+    if (static_cast<uint64_t>(end - position) < size)
+        return false;
+
+    position += size;
+    return true;
+}
+
+// Read a variable length integer, false if it is truncated.
+static bool read_variable(uint64_t& out, const uint8_t*& position,
+    const uint8_t* end)
+{
+    if (position == end)
+        return false;
+
+    const auto prefix = *position++;
+    const size_t size = prefix < 0xfd ? 0 : prefix == 0xfd ? 2 :
+        prefix == 0xfe ? 4 : 8;
+
+    if (size == 0)
+    {
+        out = prefix;
+        return true;
+    }
+
+    if (static_cast<size_t>(end - position) < size)
+        return false;
+
+    out = 0;
+    for (size_t byte = 0; byte < size; ++byte)
+        out |= static_cast<uint64_t>(position[byte]) << (8 * byte);
+
+    position += size;
+    return true;
+}
+
+// Walk the fields of a transaction without parsing it, so that each record
+// is known to be exactly one transaction before it is hashed. A record with
+// no inputs is rejected, as is the witness serialization, whose hash is not
+// the transaction hash.
+static bool is_transaction(data_slice record)
+{
+    auto position = record.begin();
+    const auto end = record.end();
+    uint64_t inputs, outputs, size;
+
+    if (!skip(position, end, sizeof(uint32_t)) ||
+        !read_variable(inputs, position, end) || inputs == 0)
+        return false;
+
+    for (uint64_t input = 0; input < inputs; ++input)
+        if (!skip(position, end, hash_size + sizeof(uint32_t)) ||
+            !read_variable(size, position, end) ||
+            !skip(position, end, size) ||
+            !skip(position, end, sizeof(uint32_t)))
+            return false;
+
+    if (!read_variable(outputs, position, end))
+        return false;
+
+    for (uint64_t output = 0; output < outputs; ++output)
+        if (!skip(position, end, sizeof(uint64_t)) ||
+            !read_variable(size, position, end) ||
+            !skip(position, end, size))
+            return false;
+
+    return skip(position, end, sizeof(uint32_t)) && position == end;
+}
+
+// Split binary transactions, each preceded by its four byte size. A record
+// that is truncated is returned as an empty slice, which is not valid.
+static std::vector<data_slice> read_records(data_slice data)
+{
+    std::vector<data_slice> out;
+    auto position = data.begin();
+    const auto end = data.end();
+
+    while (position != end)
+    {
+        const auto remaining = static_cast<size_t>(end - position);
+        if (remaining < sizeof(uint32_t))
+        {
+            out.push_back({ end, end });
+            break;
+        }
+
+        const auto size = from_little_endian_unsafe<uint32_t>(position);
+        const auto record = position + sizeof(uint32_t);
+        if (remaining - sizeof(uint32_t) < size)
+        {
+            out.push_back({ end, end });
+            break;
+        }
+
+        out.push_back({ record, record + size });
+        position = record + size;
+    }
+
+    return out;
+}
+
+console_result tx_hash::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto binary = get_binary_option();
+    const auto threads = get_threads_option();
+    const auto unique = get_unique_option();
+    const data_chunk& data = get_transactions_argument();
+
+    // The one-based position of each transaction, by record or by line.
+    data_stack decoded;
+    std::vector<data_slice> records;
+    std::vector<size_t> positions;
+
+    if (binary)
+    {
+        records = read_records(data);
+        positions.resize(records.size());
+        std::iota(positions.begin(), positions.end(), 1);
+    }
+    else
+    {
+        std::vector<data_slice> rows;
+        split_lines(rows, positions, data);
+        decoded.resize(rows.size());
+
+        for (size_t index = 0; index < rows.size(); ++index)
+        {
+            if (!append_base16_data(decoded[index], rows[index]))
+            {
+                error << format(BX_TX_HASH_INVALID_LINE) % positions[index] <<
+                    std::endl;
+                return console_result::failure;
+            }
+        }
+
+        records.assign(decoded.begin(), decoded.end());
+    }
+
+    // Each chunk is checked and then hashed in lanes on one thread.
+    const auto count = records.size();
+    const auto chunks = (count + chunk_size - 1) / chunk_size;
+    std::vector<hash_digest> hashes(count);
+    std::vector<uint8_t> valid(count);
+
+    const auto hash_chunk = [&](size_t chunk)
+    {
+        const auto first = chunk * chunk_size;
+        const auto last = std::min(count, first + chunk_size);
+
+        for (auto index = first; index < last; ++index)
+            valid[index] = is_transaction(records[index]) ? 1 : 0;
+
+        const auto chunk_hashes = bitcoin_hash_batch(
+            std::vector<data_slice>(records.begin() + first,
+                records.begin() + last));
+
+        std::copy(chunk_hashes.begin(), chunk_hashes.end(),
+            hashes.begin() + first);
+    };
+
+    parallel_for(chunks, hash_chunk, threads);
+
+    const auto invalid = std::find(valid.begin(), valid.end(), 0);
+    if (invalid != valid.end())
+    {
+        const auto index = std::distance(valid.begin(), invalid);
+        error << format(binary ? BX_TX_HASH_INVALID_RECORD :
+            BX_TX_HASH_INVALID_TRANSACTION) % positions[index] << std::endl;
+        return console_result::failure;
+    }
+
+    // The hashes are written together, as a line at a time is slow.
+    cuckoo_filter filter(unique ? count : 0);
+    std::string text;
+    text.reserve(count * (2 * hash_size + 1));
+
+    for (const auto& hash: hashes)
+    {
+        if (unique && !filter.insert(hash))
+            continue;
+
+        text += encode_hash(hash);
+        text += '\n';
+    }
+
+    output << text << std::flush;
+    return console_result::okay;
+}
+
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
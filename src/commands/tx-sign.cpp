@@ -20,28 +20,172 @@
 
 #include <bitcoin/explorer/commands/tx-sign.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <vector>
 #include <boost/format.hpp>
 #include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/config/transaction.hpp>
 #include <bitcoin/explorer/define.hpp>
-
+#include <bitcoin/explorer/sighash_context.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 namespace libbitcoin {
 namespace explorer {
 namespace commands {
+using namespace bc::chain;
+
+// The result of signing a single input, populated concurrently.
+enum class sign_result
+{
+    okay,
+    unsupported,
+    mismatch,
+    failed
+};
+
+// A single key or script applies to all inputs, otherwise one per input.
+template <typename Item>
+static const Item& select_item(const std::vector<Item>& items, size_t index)
+{
+    return items.size() == 1 ? items.front() : items[index];
+}
+
+// Sign one input and create its input script, without modifying the tx.
+static sign_result sign_input(script& out, const sighash_context& sighash,
+    uint32_t index, const ec_secret& secret, const script& contract,
+    uint8_t hash_type)
+{
+    ec_compressed compressed;
+    ec_uncompressed uncompressed;
+    if (!secret_to_public(compressed, secret) ||
+        !decompress(uncompressed, compressed))
+        return sign_result::failed;
+
+    // The previous output may be locked to either serialization of the key,
+    // and a pay-key-hash input script must carry the one that was hashed.
+    const auto compressed_key = to_chunk(compressed);
+    const auto uncompressed_key = to_chunk(uncompressed);
+    data_chunk key;
+
+    const auto& ops = contract.operations();
+    const auto pattern = contract.pattern();
+
+    if (pattern == machine::script_pattern::pay_key_hash)
+    {
+        // The third operation of the pattern is the public key hash.
+        const auto& hash = ops[2].data();
+        if (hash == to_chunk(bitcoin_short_hash(compressed_key)))
+            key = compressed_key;
+        else if (hash == to_chunk(bitcoin_short_hash(uncompressed_key)))
+            key = uncompressed_key;
+        else
+            return sign_result::mismatch;
+    }
+    else if (pattern == machine::script_pattern::pay_public_key)
+    {
+        // The first operation of the pattern is the public key.
+        const auto& point = ops[0].data();
+        if (point != compressed_key && point != uncompressed_key)
+            return sign_result::mismatch;
+    }
+    else
+    {
+        return sign_result::unsupported;
+    }
+
+    endorsement endorse;
+    if (!sighash.create_endorsement(endorse, secret, contract, index,
+        hash_type))
+        return sign_result::failed;
+
+    machine::operation::list input_ops;
+    input_ops.emplace_back(endorse);
+
+    if (pattern == machine::script_pattern::pay_key_hash)
+        input_ops.emplace_back(key);
+
+    out = script(input_ops);
+    return sign_result::okay;
+}
 
 console_result tx_sign::invoke(std::ostream& output, std::ostream& error)
 {
     // Bound parameters.
-    //const auto& transactions = get_transactions_argument();
+    const auto anyone_can_pay = get_anyone_option();
+    const auto sign_type = get_sign_type_option();
+    const auto threads = get_threads_option();
+    const auto& keys = get_keys_option();
+    const auto& prevouts = get_prevouts_option();
+    const tx_type& tx = get_transaction_argument();
+
+    const auto count = tx.inputs().size();
+
+    if (keys.empty() || (keys.size() != 1 && keys.size() != count))
+    {
+        error << BX_TX_SIGN_KEY_COUNT_MISMATCH << std::endl;
+        return console_result::failure;
+    }
+
+    if (prevouts.empty() || (prevouts.size() != 1 && prevouts.size() != count))
+    {
+        error << BX_TX_SIGN_PREVOUT_COUNT_MISMATCH << std::endl;
+        return console_result::failure;
+    }
+
+    uint8_t hash_type = (machine::sighash_algorithm)sign_type;
+    if (anyone_can_pay)
+        hash_type |= machine::sighash_algorithm::anyone_can_pay;
+
+    // Each input is signed against the unmodified tx, so the signing is
+    // independent across inputs and the results are applied afterward.
+    // The sighash context is shared, so the tx is serialized only once.
+    const sighash_context sighash(tx);
+    std::vector<script> scripts(count);
+    std::vector<sign_result> results(count);
+
+    const auto sign = [&](size_t index)
+    {
+        const ec_secret& secret = select_item(keys, index);
+        const script& contract = select_item(prevouts, index);
+        const auto input_index = static_cast<uint32_t>(index);
+        results[index] = sign_input(scripts[index], sighash, input_index,
+            secret, contract, hash_type);
+    };
+
+    parallel_for(count, sign, threads);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        switch (results[index])
+        {
+            case sign_result::unsupported:
+                error << format(BX_TX_SIGN_UNSUPPORTED_PREVOUT) % index
+                    << std::endl;
+                return console_result::failure;
+            case sign_result::mismatch:
+                error << format(BX_TX_SIGN_KEY_MISMATCH) % index << std::endl;
+                return console_result::failure;
+            case sign_result::failed:
+                error << format(BX_TX_SIGN_FAILED) % index << std::endl;
+                return console_result::failure;
+            default:
+                break;
+        }
+    }
+
+    // Clone so we keep arguments const.
+    auto tx_copy = config::transaction(tx);
+    auto& tx_out = tx_copy.data();
 
-    //for (const tx_type& tx: transactions)
-    //    /* sign */;
+    for (size_t index = 0; index < count; ++index)
+        tx_out.inputs()[index].set_script(scripts[index]);
 
-    error << BX_TX_SIGN_NOT_IMPLEMENTED << std::endl;
-    return console_result::failure;
+    output << tx_copy << std::endl;
+    return console_result::okay;
 }
 
-} //namespace commands 
-} //namespace explorer 
-} //namespace libbitcoin 
+} //namespace commands
+} //namespace explorer
+} //namespace libbitcoin
@@ -0,0 +1,186 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <bitcoin/explorer/commands/tx-verify.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/format.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/config/transaction.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::chain;
+using namespace bc::machine;
+
+// A single script or value applies to all inputs, otherwise one per input.
+template <typename Item>
+static const Item& select_item(const std::vector<Item>& items, size_t index)
+{
+    return items.size() == 1 ? items.front() : items[index];
+}
+
+// Accumulate the fork flags of the named rules, false if one is not known.
+static bool parse_rules(uint32_t& out, std::string& unknown,
+    const std::vector<std::string>& rules)
+{
+    if (rules.empty())
+    {
+        out = rule_fork::all_rules;
+        return true;
+    }
+
+    out = rule_fork::no_rules;
+    for (const auto& rule: rules)
+    {
+        if (rule == "bip16")
+            out |= rule_fork::bip16_rule;
+        else if (rule == "bip65")
+            out |= rule_fork::bip65_rule;
+        else if (rule == "bip66")
+            out |= rule_fork::bip66_rule;
+        else
+        {
+            unknown = rule;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static size_t count_operations(const script& value)
+{
+    const auto& ops = value.operations();
+    return std::count_if(ops.begin(), ops.end(), [](const operation& op)
+    {
+        return operation::is_counted(op.code());
+    });
+}
+
+// The counted operations of the evaluated scripts, which include the script
+// embedded in the input script when spending a pay-to-script-hash output.
+static size_t count_operations(const script& input_script,
+    const script& prevout, uint32_t forks)
+{
+    auto count = count_operations(input_script) + count_operations(prevout);
+    const auto& ops = input_script.operations();
+
+    if ((forks & rule_fork::bip16_rule) == 0 || ops.empty() ||
+        prevout.pattern() != script_pattern::pay_script_hash)
+        return count;
+
+    script embedded;
+    if (embedded.from_data(ops.back().data(), false))
+        count += count_operations(embedded);
+
+    return count;
+}
+
+console_result tx_verify::invoke(std::ostream& output, std::ostream& error)
+{
+    // Bound parameters.
+    const auto threads = get_threads_option();
+    const auto& amounts = get_amounts_option();
+    const auto& prevouts = get_prevouts_option();
+    const auto& rules = get_rules_option();
+    const tx_type& tx = get_transaction_argument();
+
+    const auto count = tx.inputs().size();
+
+    if (prevouts.empty() || (prevouts.size() != 1 && prevouts.size() != count))
+    {
+        error << BX_TX_VERIFY_PREVOUT_COUNT_MISMATCH << std::endl;
+        return console_result::failure;
+    }
+
+    if (amounts.size() > 1 && amounts.size() != count)
+    {
+        error << BX_TX_VERIFY_AMOUNT_COUNT_MISMATCH << std::endl;
+        return console_result::failure;
+    }
+
+    uint32_t forks;
+    std::string unknown;
+    if (!parse_rules(forks, unknown, rules))
+    {
+        error << format(BX_TX_VERIFY_UNKNOWN_RULE) % unknown << std::endl;
+        return console_result::failure;
+    }
+
+    // The script machine obtains each previous output from its input, so a
+    // copy of the tx is populated before the inputs are verified.
+    auto tx_copy = tx;
+    for (size_t index = 0; index < count; ++index)
+    {
+        const chain::script& prevout = select_item(prevouts, index);
+        const auto amount = amounts.empty() ? 0 : select_item(amounts, index);
+        auto& point = tx_copy.inputs()[index].previous_output();
+        point.validation.cache = chain::output(amount, prevout);
+    }
+
+    // Each input is verified against the same tx, so verification is
+    // independent across inputs.
+    std::vector<code> results(count);
+    std::vector<size_t> operations(count);
+
+    const auto verify = [&](size_t index)
+    {
+        const auto input_index = static_cast<uint32_t>(index);
+        const auto& input = tx_copy.inputs()[index];
+        const auto& prevout = input.previous_output().validation.cache;
+        results[index] = script::verify(tx_copy, input_index, forks);
+        operations[index] = count_operations(input.script(),
+            prevout.script(), forks);
+    };
+
+    parallel_for(count, verify, threads);
+
+    auto valid = true;
+    for (size_t index = 0; index < count; ++index)
+    {
+        if (results[index])
+        {
+            valid = false;
+            output << format(BX_TX_VERIFY_INVALID) % index %
+                operations[index] << std::endl;
+        }
+        else
+        {
+            output << format(BX_TX_VERIFY_VALID) % index %
+                operations[index] << std::endl;
+        }
+    }
+
+    // We do not return a failure here, as this is a validity test.
+    return valid ? console_result::okay : console_result::invalid;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin
@@ -0,0 +1,489 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/commands/vanity-search.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/format.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/ec_arithmetic.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+// The BX_VANITY_SEARCH_INVALID_KEY condition is not covered by test.
+// This is because is not known what seed will produce an invalid key.
+namespace libbitcoin {
+namespace explorer {
+namespace commands {
+using namespace bc::wallet;
+
+// Each batch of keys is normalized with a single field inversion.
+constexpr size_t batch_size = 1024;
+
+// Threads walk disjoint ranges of keys, each starting at a stride multiple.
+constexpr uint64_t thread_stride = uint64_t(1) << 40;
+
+// The version byte, hash and checksum of a payment address.
+constexpr size_t address_size = 1 + short_hash_size + 4;
+constexpr size_t maximum_digits = 35;
+
+static const std::string base58_alphabet =
+    "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+// A 256 bit unsigned integer, in little endian limbs, for prefix bounds.
+typedef std::array<uint32_t, 8> number;
+
+// The version byte followed by the hash, in address order.
+typedef byte_array<1 + short_hash_size> address_key;
+
+// An inclusive range of address keys with a common Base58 prefix.
+struct key_range
+{
+    address_key low;
+    address_key high;
+};
+
+static number to_number(uint64_t value)
+{
+    number out{};
+    out[0] = static_cast<uint32_t>(value);
+    out[1] = static_cast<uint32_t>(value >> 32);
+    return out;
+}
+
+static number multiply_add(const number& value, uint32_t factor,
+    uint32_t addend)
+{
+    number out;
+    uint64_t carry = addend;
+    for (size_t limb = 0; limb < value.size(); ++limb)
+    {
+        const auto sum = uint64_t(value[limb]) * factor + carry;
+        out[limb] = static_cast<uint32_t>(sum);
+        carry = sum >> 32;
+    }
+
+    return out;
+}
+
+static number power(uint32_t base, size_t exponent)
+{
+    auto out = to_number(1);
+    for (size_t count = 0; count < exponent; ++count)
+        out = multiply_add(out, base, 0);
+
+    return out;
+}
+
+static bool less(const number& left, const number& right)
+{
+    return std::lexicographical_compare(left.rbegin(), left.rend(),
+        right.rbegin(), right.rend());
+}
+
+// Convert [low, high) on the address to an inclusive range of its keys.
+static key_range to_key_range(const number& low, number high)
+{
+    // Decrement high, which is always greater than low.
+    for (size_t limb = 0; limb < high.size() && high[limb]-- == 0; ++limb);
+
+    key_range out;
+    for (size_t byte = 0; byte < out.low.size(); ++byte)
+    {
+        // Skip the four checksum bytes, the least significant of the address.
+        const auto position = address_size - 1 - byte;
+        const auto limb = position / 4;
+        const auto shift = 8 * (position % 4);
+        out.low[byte] = static_cast<uint8_t>(low[limb] >> shift);
+        out.high[byte] = static_cast<uint8_t>(high[limb] >> shift);
+    }
+
+    return out;
+}
+
+// Compute the ranges of address keys whose Base58 encodings may begin with
+// the prefix. Matches near the ends of a range also depend upon the checksum,
+// so each match within a range must be confirmed by encoding.
+static std::vector<key_range> prefix_ranges(const std::string& prefix,
+    uint8_t version)
+{
+    std::vector<key_range> ranges;
+
+    // Each leading '1' represents a leading zero byte of the address.
+    const auto ones = prefix.find_first_not_of('1');
+    const auto zeros = ones == std::string::npos ? prefix.size() : ones;
+    const auto rest = prefix.substr(zeros);
+
+    if (zeros >= address_size)
+        return ranges;
+
+    auto rest_value = to_number(0);
+    for (const auto character: rest)
+    {
+        const auto digit = base58_alphabet.find(character);
+        if (digit == std::string::npos)
+            return ranges;
+
+        rest_value = multiply_add(rest_value, 58, static_cast<uint32_t>(digit));
+    }
+
+    // The address begins with the version byte.
+    const auto byte_scale = power(256, address_size - 1);
+    auto low = multiply_add(byte_scale, version, 0);
+    auto high = multiply_add(byte_scale, version + 1, 0);
+
+    // The address has exactly (or at least, if no rest) the leading zeros.
+    const auto zeros_high = power(256, address_size - zeros);
+    if (less(zeros_high, high))
+        high = zeros_high;
+
+    if (!rest.empty())
+    {
+        const auto zeros_low = power(256, address_size - zeros - 1);
+        if (less(low, zeros_low))
+            low = zeros_low;
+    }
+
+    if (!less(low, high))
+        return ranges;
+
+    if (rest.empty())
+    {
+        ranges.push_back(to_key_range(low, high));
+        return ranges;
+    }
+
+    // The rest is the leading digits of an address of each possible length.
+    auto rest_next = multiply_add(rest_value, 1, 1);
+    for (auto digits = rest.size(); digits <= maximum_digits; ++digits)
+    {
+        const auto scale = power(58, digits - rest.size());
+        auto digits_low = to_number(0);
+        auto digits_high = to_number(0);
+
+        for (size_t limb = 0; limb < scale.size(); ++limb)
+        {
+            // Multiply by the scale, which is never larger than 58^35.
+            const auto partial_low = multiply_add(scale, rest_value[limb], 0);
+            const auto partial_high = multiply_add(scale, rest_next[limb], 0);
+            uint64_t carry_low = 0;
+            uint64_t carry_high = 0;
+
+            for (auto target = limb; target < digits_low.size(); ++target)
+            {
+                const auto source = target - limb;
+                const auto sum_low = uint64_t(digits_low[target]) +
+                    partial_low[source] + carry_low;
+                const auto sum_high = uint64_t(digits_high[target]) +
+                    partial_high[source] + carry_high;
+                digits_low[target] = static_cast<uint32_t>(sum_low);
+                digits_high[target] = static_cast<uint32_t>(sum_high);
+                carry_low = sum_low >> 32;
+                carry_high = sum_high >> 32;
+            }
+        }
+
+        const auto range_low = less(digits_low, low) ? low : digits_low;
+        const auto range_high = less(high, digits_high) ? high : digits_high;
+
+        if (less(range_low, range_high))
+            ranges.push_back(to_key_range(range_low, range_high));
+    }
+
+    return ranges;
+}
+
+static bool in_ranges(const std::vector<key_range>& ranges,
+    const address_key& key)
+{
+    for (const auto& range: ranges)
+        if (!(key < range.low) && !(range.high < key))
+            return true;
+
+    return false;
+}
+
+static ec_secret to_secret(uint64_t value)
+{
+    ec_secret out = null_hash;
+    for (size_t byte = 0; byte < sizeof(value); ++byte)
+        out[out.size() - 1 - byte] = static_cast<uint8_t>(value >> (8 * byte));
+
+    return out;
+}
+
+// The key of the seed plus the offset, modulo the curve order.
+static bool derive_secret(ec_secret& out, const ec_secret& secret,
+    uint64_t offset)
+{
+    out = secret;
+    return offset == 0 || ec_add(out, to_secret(offset));
+}
+
+static bool to_point(affine_point& out, const ec_secret& secret)
+{
+    ec_uncompressed point;
+    return secret_to_public(point, secret) && out.from_uncompressed(point);
+}
+
+static bool derive_point(affine_point& out, const ec_secret& secret,
+    uint64_t offset)
+{
+    ec_secret derived;
+    return derive_secret(derived, secret, offset) && to_point(out, derived);
+}
+
+// State shared by the search threads.
+class vanity_search_state
+{
+public:
+    vanity_search_state(const ec_secret& secret, const std::string& prefix,
+        uint8_t version, uint64_t limit)
+      : secret_(secret), prefix_(prefix), version_(version), limit_(limit),
+        ranges_(prefix_ranges(prefix, version)), reserved_(0), searched_(0),
+        found_(false), offset_(0)
+    {
+    }
+
+    bool valid() const
+    {
+        return !ranges_.empty();
+    }
+
+    // The multiples 1G through nG of the generator, added to each batch base.
+    bool initialize()
+    {
+        multiples_.resize(batch_size);
+        for (size_t index = 0; index < batch_size; ++index)
+            if (!to_point(multiples_[index], to_secret(index + 1)))
+                return false;
+
+        return true;
+    }
+
+    void search(size_t thread)
+    {
+        auto offset = thread * thread_stride;
+        affine_point point;
+        affine_points sums;
+
+        if (!derive_point(point, secret_, offset))
+            return;
+
+        while (!found_)
+        {
+            const auto count = reserve();
+            if (count == 0)
+                return;
+
+            // Sums are the keys following the base, and the next base.
+            if (!batch_add(sums, point, multiples_))
+                add_by_derivation(sums, offset);
+
+            for (size_t index = 0; index < count; ++index)
+            {
+                const auto& key = index == 0 ? point : sums[index - 1];
+                if (matches(key))
+                {
+                    set_found(offset + index);
+                    break;
+                }
+            }
+
+            searched_ += count;
+            point = sums.back();
+            offset += batch_size;
+        }
+    }
+
+    bool found() const
+    {
+        return found_;
+    }
+
+    uint64_t offset() const
+    {
+        return offset_;
+    }
+
+    uint64_t searched() const
+    {
+        return searched_;
+    }
+
+private:
+    // Reserve up to a batch of keys against the limit.
+    size_t reserve()
+    {
+        const auto start = reserved_.fetch_add(batch_size);
+        if (limit_ == 0)
+            return batch_size;
+
+        if (start >= limit_)
+            return 0;
+
+        return static_cast<size_t>(std::min<uint64_t>(batch_size,
+            limit_ - start));
+    }
+
+    // Degenerate batch addition (astronomically unlikely) falls back to
+    // scalar multiplication.
+    void add_by_derivation(affine_points& sums, uint64_t offset) const
+    {
+        sums.resize(batch_size);
+        for (size_t index = 0; index < batch_size; ++index)
+            derive_point(sums[index], secret_, offset + index + 1);
+    }
+
+    bool matches(const affine_point& point) const
+    {
+        address_key key;
+        key[0] = version_;
+        const auto hash = bitcoin_short_hash(point.to_compressed());
+        std::copy(hash.begin(), hash.end(), key.begin() + 1);
+
+        if (!in_ranges(ranges_, key))
+            return false;
+
+        const auto address = payment_address(hash, version_).encoded();
+        return address.compare(0, prefix_.size(), prefix_) == 0;
+    }
+
+    void set_found(uint64_t offset)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        // Prefer the lowest offset of concurrent matches.
+        if (!found_ || offset < offset_)
+            offset_ = offset;
+
+        found_ = true;
+    }
+
+    const ec_secret secret_;
+    const std::string prefix_;
+    const uint8_t version_;
+    const uint64_t limit_;
+    const std::vector<key_range> ranges_;
+    affine_points multiples_;
+    std::atomic<uint64_t> reserved_;
+    std::atomic<uint64_t> searched_;
+    std::atomic<bool> found_;
+    uint64_t offset_;
+    std::mutex mutex_;
+};
+
+console_result vanity_search::invoke(std::ostream& output,
+    std::ostream& error)
+{
+    // Bound parameters.
+    const auto& encoding = get_format_option();
+    const auto limit = get_limit_option();
+    const auto threads = get_threads_option();
+    const uint8_t version = get_version_option();
+    const auto& prefix = get_prefix_argument();
+    const data_chunk& seed = get_seed_argument();
+
+    if (seed.size() < minimum_seed_size)
+    {
+        error << BX_VANITY_SEARCH_SHORT_SEED << std::endl;
+        return console_result::failure;
+    }
+
+    const auto secret = new_key(seed);
+    if (secret == null_hash)
+    {
+        error << BX_VANITY_SEARCH_INVALID_KEY << std::endl;
+        return console_result::failure;
+    }
+
+    vanity_search_state state(secret, prefix, version, limit);
+    if (!state.valid())
+    {
+        error << BX_VANITY_SEARCH_INVALID_PREFIX << std::endl;
+        return console_result::failure;
+    }
+
+    if (!state.initialize())
+    {
+        error << BX_VANITY_SEARCH_INVALID_KEY << std::endl;
+        return console_result::failure;
+    }
+
+    const auto thread_count = threads == 0 ?
+        std::max(std::thread::hardware_concurrency(), 1u) : threads;
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto search = [&state](size_t thread)
+    {
+        state.search(thread);
+    };
+
+    // One handler per thread, each walking its own range of keys.
+    parallel_for(thread_count, search, thread_count);
+
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const auto seconds = std::chrono::duration<double>(elapsed).count();
+    const auto searched = state.searched();
+    const auto rate = seconds > 0 ? static_cast<uint64_t>(searched / seconds) :
+        searched;
+
+    error << format(BX_VANITY_SEARCH_RATE) % searched % seconds % rate <<
+        std::endl;
+
+    if (!state.found())
+    {
+        error << BX_VANITY_SEARCH_NOT_FOUND << std::endl;
+        return console_result::failure;
+    }
+
+    ec_secret found;
+    ec_compressed point;
+    if (!derive_secret(found, secret, state.offset()) ||
+        !secret_to_public(point, found))
+    {
+        error << BX_VANITY_SEARCH_INVALID_KEY << std::endl;
+        return console_result::failure;
+    }
+
+    const payment_address address(ec_public(point), version);
+
+    pt::ptree tree;
+    tree.put("key.address", address.encoded());
+    tree.put("key.offset", state.offset());
+    tree.put("key.private_key", encode_base16(found));
+
+    write_stream(output, tree, encoding);
+    return console_result::okay;
+}
+
+} //namespace commands 
+} //namespace explorer 
+} //namespace libbitcoin 
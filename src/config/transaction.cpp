@@ -19,12 +19,19 @@
  */
 #include <bitcoin/explorer/config/transaction.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
 #include <iostream>
+#include <iterator>
 #include <sstream>
 #include <string>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/stream.hpp>
 #include <boost/program_options.hpp>
 #include <bitcoin/bitcoin.hpp>
 #include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
 #include <bitcoin/explorer/utility.hpp>
 
 using namespace po;
@@ -64,13 +71,42 @@ transaction::operator const tx_type&() const
     return value_;
 }
 
+bool transaction::from_data(data_slice data)
+{
+    using namespace boost::iostreams;
+    const auto begin = reinterpret_cast<const char*>(data.data());
+    stream<array_source> source(begin, data.size());
+    istream_reader reader(source);
+    return value_.from_data(reader);
+}
+
+bool transaction::from_binary(std::istream& input)
+{
+    if (&input == &std::cin)
+    {
+        const mapped_file file(fileno(stdin));
+        if (file.mapped())
+            return from_data(file.data());
+    }
+
+    const data_chunk data((std::istreambuf_iterator<char>(input)),
+        std::istreambuf_iterator<char>());
+
+    return from_data(data);
+}
+
 std::istream& operator>>(std::istream& input, transaction& argument)
 {
     std::string hexcode;
     input >> hexcode;
 
     // tx base16 is a private encoding in bx, used to pass between commands.
-    if (!deserialize_satoshi_item(argument.value_, base16(hexcode)))
+    // It is decoded into a single buffer, from which the tx is parsed.
+    const auto text = reinterpret_cast<const uint8_t*>(hexcode.data());
+    const data_slice slice(text, text + hexcode.size());
+
+    data_chunk data;
+    if (!append_base16_data(data, slice) || !argument.from_data(data))
     {
         BOOST_THROW_EXCEPTION(invalid_option_value(hexcode));
     }
@@ -0,0 +1,143 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/cuckoo_filter.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+// The number of evictions before an entry is set aside in the overflow.
+constexpr size_t maximum_evictions = 500;
+
+// The empty slot, so that no fingerprint is zero.
+constexpr uint32_t empty_slot = 0;
+
+static size_t bucket_count(size_t capacity)
+{
+    // At least two slots per hash, a power of two so that indexes are masked.
+    size_t count = 1;
+    while (4 * count < 2 * capacity)
+        count <<= 1;
+
+    return count;
+}
+
+static uint32_t to_fingerprint(const hash_digest& hash)
+{
+    const auto fingerprint = from_little_endian_unsafe<uint32_t>(
+        hash.begin());
+    return fingerprint == empty_slot ? 1 : fingerprint;
+}
+
+static size_t to_index(const hash_digest& hash, size_t mask)
+{
+    // The bytes of the index are independent of those of the fingerprint.
+    const auto value = from_little_endian_unsafe<uint64_t>(hash.begin() +
+        sizeof(uint64_t));
+    return static_cast<size_t>(value) & mask;
+}
+
+cuckoo_filter::cuckoo_filter(size_t capacity)
+  : mask_(bucket_count(capacity) - 1),
+    buckets_(mask_ + 1, bucket{ { empty_slot } }),
+    size_(0),
+    evict_(0)
+{
+}
+
+size_t cuckoo_filter::size() const
+{
+    return size_;
+}
+
+bool cuckoo_filter::contains(const hash_digest& hash) const
+{
+    const auto fingerprint = to_fingerprint(hash);
+    const auto index = to_index(hash, mask_);
+    return contains(index, fingerprint) ||
+        contains(alternate(index, fingerprint), fingerprint);
+}
+
+bool cuckoo_filter::insert(const hash_digest& hash)
+{
+    const auto fingerprint = to_fingerprint(hash);
+    auto index = to_index(hash, mask_);
+    const auto other = alternate(index, fingerprint);
+
+    if (contains(index, fingerprint) || contains(other, fingerprint))
+        return false;
+
+    ++size_;
+
+    if (place(index, fingerprint) || place(other, fingerprint))
+        return true;
+
+    // Evict a resident of a full bucket to its other bucket, repeatedly.
+    auto held = fingerprint;
+    for (size_t eviction = 0; eviction < maximum_evictions; ++eviction)
+    {
+        auto& slot = buckets_[index][evict_++ % 4];
+        std::swap(slot, held);
+        index = alternate(index, held);
+
+        if (place(index, held))
+            return true;
+    }
+
+    // The table is over full, the entry remains exact in the overflow.
+    overflow_.emplace_back(index, held);
+    return true;
+}
+
+size_t cuckoo_filter::alternate(size_t index, uint32_t fingerprint) const
+{
+    // The exclusive or is its own inverse, so either bucket maps to the
+    // other. The fingerprint is mixed so that nearby values spread out.
+    const auto mixed = static_cast<size_t>(fingerprint * 0x5bd1e995u);
+    return (index ^ mixed) & mask_;
+}
+
+bool cuckoo_filter::contains(size_t index, uint32_t fingerprint) const
+{
+    const auto& slots = buckets_[index];
+    if (std::find(slots.begin(), slots.end(), fingerprint) != slots.end())
+        return true;
+
+    return !overflow_.empty() && std::find(overflow_.begin(), overflow_.end(),
+        entry{ index, fingerprint }) != overflow_.end();
+}
+
+bool cuckoo_filter::place(size_t index, uint32_t fingerprint)
+{
+    auto& slots = buckets_[index];
+    const auto slot = std::find(slots.begin(), slots.end(), empty_slot);
+    if (slot == slots.end())
+        return false;
+
+    *slot = fingerprint;
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
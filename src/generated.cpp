@@ -38,6 +38,7 @@ using namespace commands;
 void broadcast(const function<void(shared_ptr<command>)> func)
 {
     func(make_shared<address_decode>());
+    func(make_shared<address_decode_batch>());
     func(make_shared<address_embed>());
     func(make_shared<address_encode>());
     func(make_shared<base16_decode>());
@@ -50,25 +51,34 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<base64_encode>());
     func(make_shared<bitcoin160>());
     func(make_shared<bitcoin256>());
+    func(make_shared<block_decode>());
     func(make_shared<btc_to_satoshi>());
     func(make_shared<cert_new>());
     func(make_shared<cert_public>());
+    func(make_shared<chain_index>());
+    func(make_shared<chain_scan>());
     func(make_shared<ec_add>());
     func(make_shared<ec_add_secrets>());
     func(make_shared<ec_multiply>());
+    func(make_shared<ec_multiply_batch>());
     func(make_shared<ec_multiply_secrets>());
     func(make_shared<ec_new>());
     func(make_shared<ec_to_address>());
+    func(make_shared<ec_to_address_batch>());
     func(make_shared<ec_to_ek>());
+    func(make_shared<ec_to_ek_batch>());
     func(make_shared<ec_to_public>());
+    func(make_shared<ec_to_public_batch>());
     func(make_shared<ec_to_wif>());
     func(make_shared<ek_address>());
     func(make_shared<ek_new>());
+    func(make_shared<ek_new_batch>());
     func(make_shared<ek_public>());
     func(make_shared<ek_public_to_address>());
     func(make_shared<ek_public_to_ec>());
     func(make_shared<ek_to_address>());
     func(make_shared<ek_to_ec>());
+    func(make_shared<ek_to_ec_batch>());
     func(make_shared<fetch_balance>());
     func(make_shared<fetch_header>());
     func(make_shared<fetch_height>());
@@ -78,6 +88,7 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<fetch_tx>());
     func(make_shared<fetch_tx_index>());
     func(make_shared<fetch_utxo>());
+    func(make_shared<hash_batch>());
     func(make_shared<hd_new>());
     func(make_shared<hd_private>());
     func(make_shared<hd_public>());
@@ -89,17 +100,26 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<input_set>());
     func(make_shared<input_sign>());
     func(make_shared<input_validate>());
+    func(make_shared<key_manifest>());
+    func(make_shared<merkle_proof>());
+    func(make_shared<merkle_root>());
+    func(make_shared<merkle_verify>());
     func(make_shared<message_sign>());
     func(make_shared<message_validate>());
+    func(make_shared<message_validate_batch>());
     func(make_shared<mnemonic_decode>());
     func(make_shared<mnemonic_encode>());
     func(make_shared<mnemonic_new>());
+    func(make_shared<mnemonic_recover>());
     func(make_shared<mnemonic_to_seed>());
+    func(make_shared<mnemonic_to_seed_batch>());
     func(make_shared<qrcode>());
     func(make_shared<ripemd160>());
     func(make_shared<satoshi_to_btc>());
     func(make_shared<script_decode>());
+    func(make_shared<script_decode_batch>());
     func(make_shared<script_encode>());
+    func(make_shared<script_encode_batch>());
     func(make_shared<script_to_address>());
     func(make_shared<seed>());
     func(make_shared<send_tx>());
@@ -115,12 +135,17 @@ void broadcast(const function<void(shared_ptr<command>)> func)
     func(make_shared<stealth_secret>());
     func(make_shared<stealth_shared>());
     func(make_shared<token_new>());
+    func(make_shared<tx_ancestors>());
     func(make_shared<tx_decode>());
     func(make_shared<tx_encode>());
+    func(make_shared<tx_estimate>());
+    func(make_shared<tx_hash>());
     func(make_shared<tx_sign>());
+    func(make_shared<tx_verify>());
     func(make_shared<uri_decode>());
     func(make_shared<uri_encode>());
     func(make_shared<validate_tx>());
+    func(make_shared<vanity_search>());
     func(make_shared<watch_address>());
     func(make_shared<watch_tx>());
     func(make_shared<wif_to_ec>());
@@ -133,6 +158,8 @@ shared_ptr<command> find(const string& symbol)
 {
     if (symbol == address_decode::symbol())
         return make_shared<address_decode>();
+    if (symbol == address_decode_batch::symbol())
+        return make_shared<address_decode_batch>();
     if (symbol == address_embed::symbol())
         return make_shared<address_embed>();
     if (symbol == address_encode::symbol())
@@ -157,34 +184,50 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<bitcoin160>();
     if (symbol == bitcoin256::symbol())
         return make_shared<bitcoin256>();
+    if (symbol == block_decode::symbol())
+        return make_shared<block_decode>();
     if (symbol == btc_to_satoshi::symbol())
         return make_shared<btc_to_satoshi>();
     if (symbol == cert_new::symbol())
         return make_shared<cert_new>();
     if (symbol == cert_public::symbol())
         return make_shared<cert_public>();
+    if (symbol == chain_index::symbol())
+        return make_shared<chain_index>();
+    if (symbol == chain_scan::symbol())
+        return make_shared<chain_scan>();
     if (symbol == ec_add::symbol())
         return make_shared<ec_add>();
     if (symbol == ec_add_secrets::symbol())
         return make_shared<ec_add_secrets>();
     if (symbol == ec_multiply::symbol())
         return make_shared<ec_multiply>();
+    if (symbol == ec_multiply_batch::symbol())
+        return make_shared<ec_multiply_batch>();
     if (symbol == ec_multiply_secrets::symbol())
         return make_shared<ec_multiply_secrets>();
     if (symbol == ec_new::symbol())
         return make_shared<ec_new>();
     if (symbol == ec_to_address::symbol())
         return make_shared<ec_to_address>();
+    if (symbol == ec_to_address_batch::symbol())
+        return make_shared<ec_to_address_batch>();
     if (symbol == ec_to_ek::symbol())
         return make_shared<ec_to_ek>();
+    if (symbol == ec_to_ek_batch::symbol())
+        return make_shared<ec_to_ek_batch>();
     if (symbol == ec_to_public::symbol())
         return make_shared<ec_to_public>();
+    if (symbol == ec_to_public_batch::symbol())
+        return make_shared<ec_to_public_batch>();
     if (symbol == ec_to_wif::symbol())
         return make_shared<ec_to_wif>();
     if (symbol == ek_address::symbol())
         return make_shared<ek_address>();
     if (symbol == ek_new::symbol())
         return make_shared<ek_new>();
+    if (symbol == ek_new_batch::symbol())
+        return make_shared<ek_new_batch>();
     if (symbol == ek_public::symbol())
         return make_shared<ek_public>();
     if (symbol == ek_public_to_address::symbol())
@@ -195,6 +238,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<ek_to_address>();
     if (symbol == ek_to_ec::symbol())
         return make_shared<ek_to_ec>();
+    if (symbol == ek_to_ec_batch::symbol())
+        return make_shared<ek_to_ec_batch>();
     if (symbol == fetch_balance::symbol())
         return make_shared<fetch_balance>();
     if (symbol == fetch_header::symbol())
@@ -213,6 +258,8 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<fetch_tx_index>();
     if (symbol == fetch_utxo::symbol())
         return make_shared<fetch_utxo>();
+    if (symbol == hash_batch::symbol())
+        return make_shared<hash_batch>();
     if (symbol == hd_new::symbol())
         return make_shared<hd_new>();
     if (symbol == hd_private::symbol())
@@ -235,18 +282,32 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<input_sign>();
     if (symbol == input_validate::symbol())
         return make_shared<input_validate>();
+    if (symbol == key_manifest::symbol())
+        return make_shared<key_manifest>();
+    if (symbol == merkle_proof::symbol())
+        return make_shared<merkle_proof>();
+    if (symbol == merkle_root::symbol())
+        return make_shared<merkle_root>();
+    if (symbol == merkle_verify::symbol())
+        return make_shared<merkle_verify>();
     if (symbol == message_sign::symbol())
         return make_shared<message_sign>();
     if (symbol == message_validate::symbol())
         return make_shared<message_validate>();
+    if (symbol == message_validate_batch::symbol())
+        return make_shared<message_validate_batch>();
     if (symbol == mnemonic_decode::symbol())
         return make_shared<mnemonic_decode>();
     if (symbol == mnemonic_encode::symbol())
         return make_shared<mnemonic_encode>();
     if (symbol == mnemonic_new::symbol())
         return make_shared<mnemonic_new>();
+    if (symbol == mnemonic_recover::symbol())
+        return make_shared<mnemonic_recover>();
     if (symbol == mnemonic_to_seed::symbol())
         return make_shared<mnemonic_to_seed>();
+    if (symbol == mnemonic_to_seed_batch::symbol())
+        return make_shared<mnemonic_to_seed_batch>();
     if (symbol == qrcode::symbol())
         return make_shared<qrcode>();
     if (symbol == ripemd160::symbol())
@@ -255,8 +316,12 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<satoshi_to_btc>();
     if (symbol == script_decode::symbol())
         return make_shared<script_decode>();
+    if (symbol == script_decode_batch::symbol())
+        return make_shared<script_decode_batch>();
     if (symbol == script_encode::symbol())
         return make_shared<script_encode>();
+    if (symbol == script_encode_batch::symbol())
+        return make_shared<script_encode_batch>();
     if (symbol == script_to_address::symbol())
         return make_shared<script_to_address>();
     if (symbol == seed::symbol())
@@ -287,18 +352,28 @@ shared_ptr<command> find(const string& symbol)
         return make_shared<stealth_shared>();
     if (symbol == token_new::symbol())
         return make_shared<token_new>();
+    if (symbol == tx_ancestors::symbol())
+        return make_shared<tx_ancestors>();
     if (symbol == tx_decode::symbol())
         return make_shared<tx_decode>();
     if (symbol == tx_encode::symbol())
         return make_shared<tx_encode>();
+    if (symbol == tx_estimate::symbol())
+        return make_shared<tx_estimate>();
+    if (symbol == tx_hash::symbol())
+        return make_shared<tx_hash>();
     if (symbol == tx_sign::symbol())
         return make_shared<tx_sign>();
+    if (symbol == tx_verify::symbol())
+        return make_shared<tx_verify>();
     if (symbol == uri_decode::symbol())
         return make_shared<uri_decode>();
     if (symbol == uri_encode::symbol())
         return make_shared<uri_encode>();
     if (symbol == validate_tx::symbol())
         return make_shared<validate_tx>();
+    if (symbol == vanity_search::symbol())
+        return make_shared<vanity_search>();
     if (symbol == watch_address::symbol())
         return make_shared<watch_address>();
     if (symbol == watch_tx::symbol())
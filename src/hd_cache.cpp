@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/hd_cache.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <boost/algorithm/string.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+using namespace bc::wallet;
+
+// An entry is the root identifier, the path and the encoded key.
+constexpr size_t entry_fields = 3;
+
+static std::string make_key(const std::string& root, const std::string& path)
+{
+    return root + " " + path;
+}
+
+std::string hd_cache::identify(const hd_public& root)
+{
+    const auto identity = build_chunk({ root.point(), root.chain_code() });
+    return encode_base16(bitcoin_short_hash(identity));
+}
+
+hd_cache::hd_cache(const std::string& file, uint32_t public_version)
+  : file_(file), public_version_(public_version)
+{
+    bc::ifstream stream(file_);
+
+    std::string line;
+    while (std::getline(stream, line))
+    {
+        std::vector<std::string> fields;
+        const auto trimmed = boost::trim_copy(line);
+        boost::split(fields, trimmed, boost::is_any_of(" \t"),
+            boost::token_compress_on);
+
+        if (fields.size() == entry_fields)
+            keys_[make_key(fields[0], fields[1])] = fields[2];
+    }
+}
+
+bool hd_cache::find(hd_public& out, size_t& depth, const std::string& root,
+    const std::vector<uint32_t>& path) const
+{
+    // Ancestors are tried from the deepest, until a step is hardened.
+    for (depth = path.size(); depth > 0; --depth)
+    {
+        const std::vector<uint32_t> prefix(path.begin(),
+            path.begin() + depth);
+
+        const auto entry = keys_.find(make_key(root, encode_hd_path(prefix)));
+        if (entry != keys_.end())
+        {
+            out = hd_public(entry->second, public_version_);
+            if (out)
+                return true;
+        }
+
+        if (path[depth - 1] >= hd_first_hardened_key)
+            return false;
+    }
+
+    return false;
+}
+
+bool hd_cache::store(const std::string& root,
+    const std::vector<uint32_t>& path, const hd_public& key)
+{
+    const auto encoded_path = encode_hd_path(path);
+    const auto encoded_key = key.encoded();
+    keys_[make_key(root, encoded_path)] = encoded_key;
+
+    // Entries are appended, so concurrent writers at most duplicate a line.
+    bc::ofstream stream(file_, std::ios::app);
+    stream << root << " " << encoded_path << " " << encoded_key << std::endl;
+    return stream.good();
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,884 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/history_index.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <boost/lexical_cast.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/block_file.hpp>
+#include <bitcoin/explorer/mapped_file.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+using namespace bc::chain;
+using namespace bc::wallet;
+
+// A record is the address hash, the big-endian height, the kind, the point
+// and the big-endian point index, then for an output its value and for a
+// spend the previous output. Records sorted by their bytes are therefore
+// sorted by address hash, height, kind and point.
+constexpr size_t key_size = short_hash_size;
+constexpr size_t height_offset = key_size;
+constexpr size_t kind_offset = height_offset + sizeof(uint32_t);
+constexpr size_t point_offset = kind_offset + 1;
+constexpr size_t point_size = hash_size + sizeof(uint32_t);
+constexpr size_t value_offset = point_offset + point_size;
+constexpr size_t record_size = value_offset + point_size;
+
+constexpr uint8_t output_kind = 0;
+constexpr uint8_t spend_kind = 1;
+
+// The fence index holds the key of every 64th record of a run.
+constexpr size_t fence_interval = 64;
+
+// The number of blocks parsed concurrently while appending.
+constexpr size_t append_batch = 256;
+
+// The unspent changes of a run are its outputs that it does not spend, as
+// the point, the output kind and the address hash, and its spends of the
+// outputs of earlier runs, as the point, the spend kind and the address hash.
+// Changes sorted by their bytes are therefore sorted by point.
+constexpr size_t change_kind_offset = point_size;
+constexpr size_t change_key_offset = change_kind_offset + 1;
+constexpr size_t change_size = change_key_offset + key_size;
+
+typedef byte_array<point_size> point_key;
+typedef byte_array<record_size> index_record;
+typedef byte_array<change_size> unspent_change;
+
+struct point_key_hasher
+{
+    size_t operator()(const point_key& key) const
+    {
+        // Transaction hashes are uniform, so a prefix is a sufficient hash.
+        size_t value;
+        std::memcpy(&value, key.data(), sizeof(value));
+        return value ^ from_little_endian_unsafe<uint32_t>(key.begin() +
+            hash_size);
+    }
+};
+
+// The kind and address hash of an unspent change, by point.
+typedef std::unordered_map<point_key, std::pair<uint8_t, short_hash>,
+    point_key_hasher> unspent_map;
+
+static point_key to_key(const hash_digest& hash, uint32_t index)
+{
+    point_key key;
+    const auto index_bytes = to_little_endian(index);
+    std::copy(hash.begin(), hash.end(), key.begin());
+    std::copy(index_bytes.begin(), index_bytes.end(), key.begin() + hash_size);
+    return key;
+}
+
+static index_record make_record(const short_hash& key, uint32_t height,
+    uint8_t kind, const hash_digest& hash, uint32_t index)
+{
+    index_record record{};
+    const auto height_bytes = to_big_endian(height);
+    const auto index_bytes = to_big_endian(index);
+    auto it = std::copy(key.begin(), key.end(), record.begin());
+    it = std::copy(height_bytes.begin(), height_bytes.end(), it);
+    *it++ = kind;
+    it = std::copy(hash.begin(), hash.end(), it);
+    std::copy(index_bytes.begin(), index_bytes.end(), it);
+    return record;
+}
+
+static unspent_change make_change(const point_key& point, uint8_t kind,
+    const short_hash& key)
+{
+    unspent_change change;
+    auto it = std::copy(point.begin(), point.end(), change.begin());
+    *it++ = kind;
+    std::copy(key.begin(), key.end(), it);
+    return change;
+}
+
+static bool point_less(const unspent_change& left,
+    const unspent_change& right)
+{
+    return std::lexicographical_compare(left.begin(),
+        left.begin() + point_size, right.begin(), right.begin() + point_size);
+}
+
+static bool read_file(data_chunk& out, const std::string& path)
+{
+    bc::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+
+    out.assign(std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>());
+    return !file.bad();
+}
+
+static bool write_file(const std::string& path, const data_chunk& data)
+{
+    bc::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    file.flush();
+    return file.good();
+}
+
+// Replace a file as a whole, so that it is never partially written.
+static bool replace_file(const std::string& path, const data_chunk& data)
+{
+    const auto temporary = path + ".new";
+    if (!write_file(temporary, data))
+        return false;
+
+    boost::system::error_code ec;
+    boost::filesystem::rename(temporary, path, ec);
+    return !ec;
+}
+
+history_index::history_index(const std::string& directory)
+  : directory_(directory), top_(null_hash), blocks_(0)
+{
+}
+
+std::string history_index::path(const std::string& name) const
+{
+    return (boost::filesystem::path(directory_) / name).string();
+}
+
+std::string history_index::run_path(const run& fenced,
+    const std::string& extension) const
+{
+    return path((boost::format("%010u-%010u.%s") % fenced.start % fenced.end %
+        extension).str());
+}
+
+// Parse the blocks of a run from its file name, which is the first block and
+// the block that follows the last.
+static bool parse_run_name(uint32_t& start, uint32_t& end,
+    const boost::filesystem::path& file)
+{
+    const auto stem = file.stem().string();
+    const auto separator = stem.find('-');
+    if (separator == std::string::npos ||
+        stem.find_first_not_of("0123456789", separator + 1) !=
+            std::string::npos)
+        return false;
+
+    try
+    {
+        start = boost::lexical_cast<uint32_t>(stem.substr(0, separator));
+        end = boost::lexical_cast<uint32_t>(stem.substr(separator + 1));
+    }
+    catch (const boost::bad_lexical_cast&)
+    {
+        return false;
+    }
+
+    return start <= end;
+}
+
+bool history_index::find_runs(std::vector<run>& out) const
+{
+    out.clear();
+    boost::system::error_code ec;
+    boost::filesystem::directory_iterator it(directory_, ec);
+    if (ec)
+        return false;
+
+    for (; it != boost::filesystem::directory_iterator(); ++it)
+    {
+        const auto& file = it->path();
+        run fenced{ 0, 0, 0, {} };
+        if (file.extension() == ".fence" &&
+            parse_run_name(fenced.start, fenced.end, file))
+            out.push_back(fenced);
+    }
+
+    // A merged run precedes the runs it contains.
+    std::sort(out.begin(), out.end(),
+        [](const run& left, const run& right)
+        {
+            return left.start < right.start ||
+                (left.start == right.start && left.end > right.end);
+        });
+
+    return true;
+}
+
+void history_index::remove_stale() const
+{
+    boost::system::error_code ec;
+    boost::filesystem::directory_iterator it(directory_, ec);
+    if (ec)
+        return;
+
+    std::vector<boost::filesystem::path> stale;
+    for (; it != boost::filesystem::directory_iterator(); ++it)
+    {
+        const auto& file = it->path();
+        const auto extension = file.extension();
+
+        if (extension == ".new")
+        {
+            stale.push_back(file);
+        }
+        else if (extension == ".fence" || extension == ".run" ||
+            extension == ".unspent")
+        {
+            uint32_t start;
+            uint32_t end;
+            if (!parse_run_name(start, end, file))
+                continue;
+
+            const auto loaded = std::find_if(runs_.begin(), runs_.end(),
+                [=](const run& fenced)
+                {
+                    return fenced.start == start && fenced.end == end;
+                });
+
+            if (loaded == runs_.end())
+                stale.push_back(file);
+        }
+    }
+
+    // A fence is removed before its run, so a fence never lacks its run.
+    std::stable_partition(stale.begin(), stale.end(),
+        [](const boost::filesystem::path& file)
+        {
+            return file.extension() == ".fence";
+        });
+
+    for (const auto& file: stale)
+        boost::filesystem::remove(file, ec);
+}
+
+bool history_index::load()
+{
+    runs_.clear();
+    top_ = null_hash;
+    blocks_ = 0;
+
+    boost::system::error_code ec;
+    const auto status = boost::filesystem::status(directory_, ec);
+    if (status.type() == boost::filesystem::file_not_found)
+        return true;
+
+    if (ec)
+        return false;
+
+    data_chunk chain;
+    if (!read_file(chain, path("chain")) || chain.size() % hash_size != 0)
+        return false;
+
+    blocks_ = chain.size() / hash_size;
+    if (blocks_ == 0)
+        return true;
+
+    std::copy(chain.end() - hash_size, chain.end(), top_.begin());
+
+    std::vector<run> found;
+    if (!find_runs(found))
+        return false;
+
+    // The runs must cover the indexed blocks. Runs above the top were not
+    // committed, and runs within a merged run were not yet removed.
+    uint32_t covered = 0;
+    for (auto& fenced: found)
+    {
+        if (fenced.end > blocks_ || fenced.start < covered)
+            continue;
+
+        if (fenced.start != covered)
+            return false;
+
+        const auto size = boost::filesystem::file_size(
+            run_path(fenced, "run"), ec);
+        if (ec || size % record_size != 0)
+            return false;
+
+        data_chunk keys;
+        if (!read_file(keys, run_path(fenced, "fence")) ||
+            keys.size() % key_size != 0)
+            return false;
+
+        fenced.fence.resize(keys.size() / key_size);
+        for (size_t index = 0; index < fenced.fence.size(); ++index)
+            std::copy(keys.begin() + index * key_size,
+                keys.begin() + (index + 1) * key_size,
+                fenced.fence[index].begin());
+
+        fenced.records = size / record_size;
+        covered = fenced.end;
+        runs_.push_back(std::move(fenced));
+    }
+
+    return covered == blocks_;
+}
+
+size_t history_index::blocks() const
+{
+    return blocks_;
+}
+
+// Write a sorted run and its fence index, and populate the fence keys.
+static bool write_run(std::vector<short_hash>& keys,
+    const std::string& run_file, const std::string& fence_file,
+    const std::vector<index_record>& records)
+{
+    data_chunk run;
+    data_chunk fence;
+    keys.clear();
+    run.reserve(records.size() * record_size);
+    for (size_t position = 0; position < records.size(); ++position)
+    {
+        const auto& record = records[position];
+        extend_data(run, record);
+
+        if (position % fence_interval == 0)
+        {
+            short_hash key;
+            std::copy(record.begin(), record.begin() + key_size, key.begin());
+            extend_data(fence, key);
+            keys.push_back(key);
+        }
+    }
+
+    // The fence is written last, as its presence completes the run.
+    return replace_file(run_file, run) && replace_file(fence_file, fence);
+}
+
+// Write the unspent changes of a run, which precede its run and fence.
+static bool write_changes(const std::string& file,
+    const std::vector<unspent_change>& changes)
+{
+    data_chunk data;
+    data.reserve(changes.size() * change_size);
+    for (const auto& change: changes)
+        extend_data(data, change);
+
+    return replace_file(file, data);
+}
+
+// Read the sorted entries of a file and merge them with the preceding sorted
+// entries. The merge is stable, so entries of the file follow equal entries.
+template <typename Entry, typename Compare>
+static bool merge_file(std::vector<Entry>& entries, const std::string& file,
+    Compare less)
+{
+    const auto size = std::tuple_size<Entry>::value;
+    data_chunk data;
+    if (!read_file(data, file) || data.size() % size != 0)
+        return false;
+
+    const auto middle = entries.size();
+    entries.resize(middle + data.size() / size);
+    for (size_t position = middle; position < entries.size(); ++position)
+    {
+        const auto entry = data.begin() + (position - middle) * size;
+        std::copy(entry, entry + size, entries[position].begin());
+    }
+
+    std::inplace_merge(entries.begin(), entries.begin() + middle,
+        entries.end(), less);
+    return true;
+}
+
+// Combine the changes of consecutive runs, ordered by point and then by run,
+// into those of the runs together. An output and its spend cancel, and
+// spends are dropped if no earlier run remains to hold their outputs.
+static void combine_changes(std::vector<unspent_change>& out,
+    const std::vector<unspent_change>& changes, bool earliest)
+{
+    out.clear();
+    for (auto it = changes.begin(); it != changes.end();)
+    {
+        const unspent_change* last = nullptr;
+        for (const auto group = it; it != changes.end() &&
+            !point_less(*group, *it); ++it)
+        {
+            if ((*it)[change_kind_offset] == spend_kind && last != nullptr &&
+                (*last)[change_kind_offset] == output_kind)
+                last = nullptr;
+            else
+                last = &(*it);
+        }
+
+        if (last != nullptr &&
+            ((*last)[change_kind_offset] == output_kind || !earliest))
+            out.push_back(*last);
+    }
+}
+
+void history_index::merge_runs()
+{
+    // A run is merged with the runs that follow it once they hold as many
+    // records, so runs of similar size are merged. There are then only a
+    // logarithmic number of runs, and each record is rewritten a
+    // logarithmic number of times.
+    if (runs_.empty())
+        return;
+
+    auto first = runs_.size() - 1;
+    auto records = runs_.back().records;
+    while (first > 0 && runs_[first - 1].records <= records)
+        records += runs_[--first].records;
+
+    if (first == runs_.size() - 1)
+        return;
+
+    // Each run is sorted, so the runs are concatenated and merged in place.
+    std::vector<index_record> merged_records;
+    std::vector<unspent_change> changes;
+    for (auto it = runs_.begin() + first; it != runs_.end(); ++it)
+        if (!merge_file(merged_records, run_path(*it, "run"),
+            std::less<index_record>()) ||
+            !merge_file(changes, run_path(*it, "unspent"), point_less))
+            return;
+
+    std::vector<unspent_change> combined;
+    combine_changes(combined, changes, first == 0);
+
+    // The merged run is named for all of its blocks, so it does not replace
+    // any of the runs, which are removed once its fence is written.
+    run merged{ runs_[first].start, runs_.back().end,
+        merged_records.size(), {} };
+    if (!write_changes(run_path(merged, "unspent"), combined) ||
+        !write_run(merged.fence, run_path(merged, "run"),
+            run_path(merged, "fence"), merged_records))
+        return;
+
+    boost::system::error_code ec;
+    for (auto it = runs_.begin() + first; it != runs_.end(); ++it)
+    {
+        boost::filesystem::remove(run_path(*it, "fence"), ec);
+        boost::filesystem::remove(run_path(*it, "run"), ec);
+        boost::filesystem::remove(run_path(*it, "unspent"), ec);
+    }
+
+    runs_.resize(first);
+    runs_.push_back(std::move(merged));
+}
+
+// Find an unspent output in the changes of the runs, newest first, each of
+// which is sorted by point.
+static bool find_unspent(short_hash& out, const point_key& point,
+    const std::vector<data_slice>& runs)
+{
+    for (auto run = runs.rbegin(); run != runs.rend(); ++run)
+    {
+        size_t low = 0;
+        size_t high = run->size() / change_size;
+        while (low < high)
+        {
+            const auto middle = low + (high - low) / 2;
+            const auto change = run->data() + middle * change_size;
+            if (std::memcmp(change, point.data(), point_size) < 0)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        const auto change = run->data() + low * change_size;
+        if (low == run->size() / change_size ||
+            std::memcmp(change, point.data(), point_size) != 0)
+            continue;
+
+        if (change[change_kind_offset] != output_kind)
+            return false;
+
+        std::copy(change + change_key_offset, change + change_size,
+            out.begin());
+        return true;
+    }
+
+    return false;
+}
+
+// The outputs to addresses and spends of a block, in transaction order.
+struct block_events
+{
+    struct event
+    {
+        bool spend;
+        hash_digest hash;
+        uint32_t index;
+        short_hash key;
+        uint64_t value;
+        point_key previous;
+    };
+
+    std::vector<event> events;
+    bool valid;
+};
+
+static void extract_events(block_events& out, data_slice record)
+{
+    block parsed;
+    out.events.clear();
+    out.valid = parse_block_record(parsed, record);
+    if (!out.valid)
+        return;
+
+    for (const auto& tx: parsed.transactions())
+    {
+        const auto hash = tx.hash();
+        const auto& inputs = tx.inputs();
+        const auto& outputs = tx.outputs();
+
+        // Inputs precede outputs, as a tx cannot spend its own outputs.
+        if (!tx.is_coinbase())
+        {
+            for (uint32_t index = 0; index < inputs.size(); ++index)
+            {
+                const auto& point = inputs[index].previous_output();
+                block_events::event spend{};
+                spend.spend = true;
+                spend.hash = hash;
+                spend.index = index;
+                spend.previous = to_key(point.hash(), point.index());
+                out.events.push_back(spend);
+            }
+        }
+
+        for (uint32_t index = 0; index < outputs.size(); ++index)
+        {
+            const auto address = payment_address::extract(
+                outputs[index].script());
+
+            if (!address)
+                continue;
+
+            block_events::event output{};
+            output.hash = hash;
+            output.index = index;
+            output.key = address.hash();
+            output.value = outputs[index].value();
+            out.events.push_back(output);
+        }
+    }
+}
+
+history_index_result history_index::append(size_t& indexed, size_t& invalid,
+    const std::vector<data_slice>& records, size_t threads)
+{
+    indexed = 0;
+    const auto count = records.size();
+
+    // Link the blocks by their headers, which are parsed concurrently.
+    std::vector<hash_digest> hashes(count);
+    std::vector<hash_digest> parents(count);
+    std::vector<uint8_t> headers(count, 0);
+
+    const auto parse_header = [&](size_t index)
+    {
+        header block_header;
+        if (!parse_block_header(block_header, records[index]))
+            return;
+
+        hashes[index] = block_header.hash();
+        parents[index] = block_header.previous_block_hash();
+        headers[index] = 1;
+    };
+
+    parallel_for(count, parse_header, threads);
+
+    const auto bad = std::find(headers.begin(), headers.end(), 0);
+    if (bad != headers.end())
+    {
+        invalid = std::distance(headers.begin(), bad);
+        return history_index_result::invalid_block;
+    }
+
+    // Duplicate records of a block are ignored.
+    std::map<hash_digest, std::vector<size_t>> children;
+    std::map<hash_digest, size_t> unique;
+    for (size_t index = 0; index < count; ++index)
+        if (unique.emplace(hashes[index], index).second)
+            children[parents[index]].push_back(index);
+
+    // Walk the tree of blocks above the top, breadth first, to find the end
+    // of its longest branch. The first block of the greatest depth wins.
+    const size_t none = count;
+    std::vector<size_t> queue;
+    std::vector<size_t> depth(count, 0);
+    std::vector<size_t> parent(count, none);
+    auto deepest = none;
+
+    const auto enqueue = [&](const hash_digest& hash, size_t from)
+    {
+        const auto found = children.find(hash);
+        if (found == children.end())
+            return;
+
+        for (const auto child: found->second)
+        {
+            parent[child] = from;
+            depth[child] = from == none ? 1 : depth[from] + 1;
+            queue.push_back(child);
+        }
+    };
+
+    enqueue(top_, none);
+    for (size_t next = 0; next < queue.size(); ++next)
+    {
+        const auto index = queue[next];
+        if (deepest == none || depth[index] > depth[deepest])
+            deepest = index;
+
+        enqueue(hashes[index], index);
+    }
+
+    std::vector<size_t> branch;
+    for (auto index = deepest; index != none; index = parent[index])
+        branch.push_back(index);
+
+    std::reverse(branch.begin(), branch.end());
+    if (branch.empty())
+        return history_index_result::okay;
+
+    // The outputs of the runs are found in their unspent changes, which are
+    // mapped, so that only the pages of the spent outputs are read.
+    std::list<file_contents> contents;
+    std::vector<data_slice> runs;
+    for (const auto& fenced: runs_)
+    {
+        contents.emplace_back(run_path(fenced, "unspent"));
+        if (!contents.back().valid())
+            return history_index_result::file_failure;
+
+        runs.push_back(contents.back().data());
+    }
+
+    // Blocks are parsed concurrently in batches, then their outputs and
+    // spends are applied in chain order.
+    unspent_map unspent;
+    std::vector<index_record> added;
+    std::vector<block_events> batch;
+    for (size_t first = 0; first < branch.size(); first += append_batch)
+    {
+        const auto size = std::min(append_batch, branch.size() - first);
+        batch.resize(size);
+
+        const auto extract = [&](size_t index)
+        {
+            extract_events(batch[index], records[branch[first + index]]);
+        };
+
+        parallel_for_dynamic(size, extract, threads);
+
+        for (size_t index = 0; index < size; ++index)
+        {
+            if (!batch[index].valid)
+            {
+                invalid = branch[first + index];
+                return history_index_result::invalid_block;
+            }
+
+            const auto height = static_cast<uint32_t>(blocks_ + first + index);
+            for (const auto& event: batch[index].events)
+            {
+                if (event.spend)
+                {
+                    // An output of the appended blocks and its spend cancel.
+                    short_hash key;
+                    const auto change = unspent.find(event.previous);
+                    if (change != unspent.end())
+                    {
+                        if (change->second.first != output_kind)
+                            continue;
+
+                        key = change->second.second;
+                        unspent.erase(change);
+                    }
+                    else
+                    {
+                        if (!find_unspent(key, event.previous, runs))
+                            continue;
+
+                        unspent[event.previous] = { spend_kind, key };
+                    }
+
+                    auto record = make_record(key, height, spend_kind,
+                        event.hash, event.index);
+                    std::copy(event.previous.begin(), event.previous.end(),
+                        record.begin() + value_offset);
+                    added.push_back(record);
+                }
+                else
+                {
+                    auto record = make_record(event.key, height, output_kind,
+                        event.hash, event.index);
+                    const auto value = to_little_endian(event.value);
+                    std::copy(value.begin(), value.end(),
+                        record.begin() + value_offset);
+                    added.push_back(record);
+                    unspent[to_key(event.hash, event.index)] =
+                        { output_kind, event.key };
+                }
+            }
+        }
+    }
+
+    std::sort(added.begin(), added.end());
+
+    std::vector<unspent_change> changes;
+    changes.reserve(unspent.size());
+    for (const auto& change: unspent)
+        changes.push_back(make_change(change.first, change.second.first,
+            change.second.second));
+
+    std::sort(changes.begin(), changes.end());
+
+    data_chunk chain;
+    if (blocks_ > 0 && !read_file(chain, path("chain")))
+        return history_index_result::file_failure;
+
+    chain.resize(blocks_ * hash_size);
+    chain.reserve(chain.size() + branch.size() * hash_size);
+    for (const auto index: branch)
+        extend_data(chain, hashes[index]);
+
+    // The run is written above the top, and the replacement of the chain
+    // commits it. Until then it is ignored, and the files of an earlier
+    // append that failed are removed first.
+    const auto end = blocks_ + branch.size();
+    run appended{ static_cast<uint32_t>(blocks_),
+        static_cast<uint32_t>(end), added.size(), {} };
+
+    boost::system::error_code ec;
+    remove_stale();
+    boost::filesystem::create_directories(directory_, ec);
+    if (ec || !write_changes(run_path(appended, "unspent"), changes) ||
+        !write_run(appended.fence, run_path(appended, "run"),
+            run_path(appended, "fence"), added) ||
+        !replace_file(path("chain"), chain))
+        return history_index_result::file_failure;
+
+    runs_.push_back(std::move(appended));
+    blocks_ = end;
+    top_ = hashes[branch.back()];
+    indexed = branch.size();
+
+    // Merging is only an optimization of the committed index, so a merge
+    // that fails leaves the runs as they are.
+    merge_runs();
+
+    return history_index_result::okay;
+}
+
+bool history_index::history(chain::history::list& out,
+    const payment_address& address) const
+{
+    out.clear();
+    const auto& key = address.hash();
+
+    std::vector<index_record> found;
+    for (const auto& fenced: runs_)
+    {
+        // Runs are mapped, so that only the fenced range is read.
+        const file_contents contents(run_path(fenced, "run"));
+        if (!contents.valid())
+            return false;
+
+        const auto run = contents.data();
+        const auto count = run.size() / record_size;
+
+        // The first record of the key follows the last fence below it.
+        const auto fence = std::lower_bound(fenced.fence.begin(),
+            fenced.fence.end(), key);
+        const auto lower = static_cast<size_t>(std::distance(
+            fenced.fence.begin(), fence));
+
+        size_t position = lower == 0 ? 0 : (lower - 1) * fence_interval;
+        for (; position < count; ++position)
+        {
+            const auto record = run.begin() + position * record_size;
+            const auto order = std::memcmp(record, key.data(), key_size);
+            if (order > 0)
+                break;
+
+            if (order < 0)
+                continue;
+
+            index_record copy;
+            std::copy(record, record + record_size, copy.begin());
+            found.push_back(copy);
+        }
+    }
+
+    // Outputs precede their spends, which are at the same or greater height.
+    std::sort(found.begin(), found.end());
+
+    std::map<point_key, size_t> rows;
+    for (const auto& record: found)
+    {
+        const auto height = from_big_endian_unsafe<uint32_t>(
+            record.begin() + height_offset);
+
+        hash_digest hash;
+        std::copy(record.begin() + point_offset,
+            record.begin() + point_offset + hash_size, hash.begin());
+        const auto index = from_big_endian_unsafe<uint32_t>(
+            record.begin() + point_offset + hash_size);
+
+        if (record[kind_offset] == output_kind)
+        {
+            chain::history row;
+            row.output = output_point(hash, index);
+            row.output_height = height;
+            row.value = from_little_endian_unsafe<uint64_t>(
+                record.begin() + value_offset);
+            row.spend = input_point(null_hash, max_uint32);
+            row.spend_height = 0;
+            rows[to_key(hash, index)] = out.size();
+            out.push_back(row);
+            continue;
+        }
+
+        point_key previous;
+        std::copy(record.begin() + value_offset, record.end(),
+            previous.begin());
+
+        const auto row = rows.find(previous);
+        if (row == rows.end())
+            return false;
+
+        out[row->second].spend = input_point(hash, index);
+        out[row->second].spend_height = height;
+    }
+
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
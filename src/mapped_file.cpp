@@ -0,0 +1,144 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/mapped_file.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <bitcoin/bitcoin.hpp>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace libbitcoin {
+namespace explorer {
+
+#ifdef _WIN32
+
+mapped_file::mapped_file(int)
+  : data_(nullptr), size_(0), offset_(0)
+{
+}
+
+mapped_file::mapped_file(const std::string&)
+  : data_(nullptr), size_(0), offset_(0)
+{
+}
+
+mapped_file::~mapped_file()
+{
+}
+
+#else
+
+mapped_file::mapped_file(int descriptor)
+  : data_(nullptr), size_(0), offset_(0)
+{
+    map(descriptor);
+}
+
+mapped_file::mapped_file(const std::string& path)
+  : data_(nullptr), size_(0), offset_(0)
+{
+    const auto descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0)
+        return;
+
+    // The mapping remains valid once the descriptor is closed.
+    map(descriptor);
+    close(descriptor);
+}
+
+void mapped_file::map(int descriptor)
+{
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode))
+        return;
+
+    // The contents are mapped from the current position of the descriptor.
+    const auto position = lseek(descriptor, 0, SEEK_CUR);
+    if (position < 0 || position >= status.st_size)
+        return;
+
+    const auto size = static_cast<size_t>(status.st_size);
+    const auto view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor,
+        0);
+
+    if (view == MAP_FAILED)
+        return;
+
+    // The file is read once, front to back.
+    madvise(view, size, MADV_SEQUENTIAL);
+    data_ = static_cast<uint8_t*>(view);
+    size_ = size;
+    offset_ = static_cast<size_t>(position);
+}
+
+mapped_file::~mapped_file()
+{
+    if (data_ != nullptr)
+        munmap(data_, size_);
+}
+
+#endif
+
+bool mapped_file::mapped() const
+{
+    return data_ != nullptr;
+}
+
+data_slice mapped_file::data() const
+{
+    return data_slice(data_ + offset_, data_ + size_);
+}
+
+file_contents::file_contents(const std::string& path)
+  : mapped_(path), valid_(mapped_.mapped())
+{
+    if (valid_)
+        return;
+
+    // The file is empty, cannot be mapped on this platform, or is missing.
+    bc::ifstream file(path, std::ios::binary);
+    if (!file)
+        return;
+
+    buffer_.assign(std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>());
+    valid_ = true;
+}
+
+bool file_contents::valid() const
+{
+    return valid_;
+}
+
+data_slice file_contents::data() const
+{
+    return mapped_.mapped() ? mapped_.data() : data_slice(buffer_);
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/merkle_tree.hpp>
+
+#include <cstddef>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/multi_sha256.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+// The stored size of a level, completed to an even number if not the root.
+static size_t stored_size(size_t count)
+{
+    return count > 1 && count % 2 != 0 ? count + 1 : count;
+}
+
+merkle_tree::merkle_tree(const hash_list& leaves)
+  : size_(leaves.size())
+{
+    if (leaves.empty())
+        return;
+
+    // Size the buffer for all levels so that it is allocated only once.
+    size_t total = 0;
+    for (auto count = size_; ; count = (count + 1) / 2)
+    {
+        offsets_.push_back(total);
+        total += stored_size(count);
+
+        if (count == 1)
+            break;
+    }
+
+    nodes_.resize(total);
+    std::copy(leaves.begin(), leaves.end(), nodes_.begin());
+
+    auto count = size_;
+    for (size_t level = 0; level + 1 < offsets_.size(); ++level)
+    {
+        const auto nodes = nodes_.data() + offsets_[level];
+        if (count % 2 != 0)
+            nodes[count] = nodes[count - 1];
+
+        const auto pairs = (count + 1) / 2;
+        bitcoin_hash_pairs(nodes_.data() + offsets_[level + 1], nodes, pairs);
+        count = pairs;
+    }
+}
+
+size_t merkle_tree::size() const
+{
+    return size_;
+}
+
+hash_digest merkle_tree::root() const
+{
+    return nodes_.empty() ? null_hash : nodes_.back();
+}
+
+bool merkle_tree::branch(hash_list& out, size_t index) const
+{
+    out.clear();
+    if (index >= size_)
+        return false;
+
+    // The root has no sibling, and a completed level stores the sibling of
+    // its last hash.
+    for (size_t level = 0; level + 1 < offsets_.size(); ++level)
+    {
+        out.push_back(nodes_[offsets_[level] + (index ^ 1)]);
+        index /= 2;
+    }
+
+    return true;
+}
+
+hash_digest merkle_tree::branch_root(const hash_digest& leaf,
+    const hash_list& branch, size_t index)
+{
+    auto node = leaf;
+    for (const auto& sibling: branch)
+    {
+        if (index % 2 == 0)
+            node = bitcoin_hash(build_chunk({ node, sibling }));
+        else
+            node = bitcoin_hash(build_chunk({ sibling, node }));
+
+        index /= 2;
+    }
+
+    return node;
+}
+
+hash_list transaction_hashes(const chain::transaction::list& transactions)
+{
+    data_stack serialized;
+    serialized.reserve(transactions.size());
+
+    for (const auto& tx: transactions)
+        serialized.push_back(tx.to_data());
+
+    return bitcoin_hash_batch(serialized);
+}
+
+bool read_merkle_leaves(hash_list& out, size_t& line, const data_chunk& text,
+    bool block)
+{
+    out.clear();
+    line = 0;
+
+    if (block)
+    {
+        data_chunk data;
+        chain::block instance;
+        if (!append_base16_data(data, trim_slice(text)) ||
+            !instance.from_data(data))
+            return false;
+
+        out = transaction_hashes(instance.transactions());
+        return true;
+    }
+
+    std::vector<bc::config::hash256> hashes;
+    if (!deserialize_lines(hashes, line, text))
+        return false;
+
+    out.assign(hashes.begin(), hashes.end());
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,220 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/mnemonic_index.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+using namespace bc::wallet;
+
+// BIP39 mnemonic parameters.
+constexpr size_t bits_per_word = 11;
+constexpr size_t entropy_bit_divisor = 32;
+
+static bool get_bit(const uint8_t* data, size_t bit)
+{
+    return (data[bit / byte_bits] & (0x80 >> (bit % byte_bits))) != 0;
+}
+
+bool mnemonic_index::checksum(const std::vector<uint16_t>& indexes)
+{
+    if (indexes.empty() || (indexes.size() % mnemonic_word_multiple) != 0)
+        return false;
+
+    const auto total_bits = bits_per_word * indexes.size();
+    const auto check_bits = total_bits / (entropy_bit_divisor + 1);
+    const auto entropy_bits = total_bits - check_bits;
+
+    if (check_bits > hash_size * byte_bits)
+        return false;
+
+    // Concatenate the 11 bit word indexes, most significant bit first.
+    data_chunk bits((total_bits + byte_bits - 1) / byte_bits, 0);
+    size_t bit = 0;
+    for (const auto index: indexes)
+    {
+        for (size_t shift = bits_per_word; shift > 0; --shift, ++bit)
+            if (((index >> (shift - 1)) & 1) != 0)
+                bits[bit / byte_bits] |= (0x80 >> (bit % byte_bits));
+    }
+
+    const auto entropy_end = bits.begin() + entropy_bits / byte_bits;
+    const auto hash = sha256_hash(data_chunk(bits.begin(), entropy_end));
+
+    for (size_t check = 0; check < check_bits; ++check)
+        if (get_bit(hash.data(), check) !=
+            get_bit(bits.data(), entropy_bits + check))
+            return false;
+
+    return true;
+}
+
+const mnemonic_index& mnemonic_index::all()
+{
+    // Initialization of a local static is thread safe.
+    static const mnemonic_index instance(language::all);
+    return instance;
+}
+
+mnemonic_index::mnemonic_index(const dictionary_list& lexicons)
+  : lexicons_(lexicons)
+{
+    size_t words = 0;
+    for (const auto lexicon: lexicons_)
+        words += lexicon->size();
+
+    words_.reserve(words);
+
+    for (size_t ordinal = 0; ordinal < lexicons_.size(); ++ordinal)
+    {
+        const auto& lexicon = *lexicons_[ordinal];
+        for (size_t index = 0; index < lexicon.size(); ++index)
+        {
+            const position entry
+            {
+                static_cast<uint8_t>(ordinal),
+                static_cast<uint16_t>(index)
+            };
+
+            words_[lexicon[index]].push_back(entry);
+        }
+    }
+}
+
+const mnemonic_index::positions* mnemonic_index::lookup(
+    const std::string& word) const
+{
+    const auto it = words_.find(word);
+    return it == words_.end() ? nullptr : &it->second;
+}
+
+bool mnemonic_index::ordinal(uint8_t& out, const dictionary& lexicon) const
+{
+    for (size_t index = 0; index < lexicons_.size(); ++index)
+    {
+        if (lexicons_[index] == &lexicon)
+        {
+            out = static_cast<uint8_t>(index);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool mnemonic_index::find(std::vector<uint16_t>& out, const word_list& words,
+    const dictionary& lexicon) const
+{
+    uint8_t lexicon_ordinal;
+    if (!ordinal(lexicon_ordinal, lexicon))
+        return false;
+
+    out.clear();
+    out.reserve(words.size());
+
+    for (const auto& word: words)
+    {
+        const auto entries = lookup(word);
+        if (entries == nullptr)
+            return false;
+
+        auto found = false;
+        for (const auto& entry: *entries)
+        {
+            if (entry.lexicon == lexicon_ordinal)
+            {
+                out.push_back(entry.index);
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+            return false;
+    }
+
+    return true;
+}
+
+dictionary_list mnemonic_index::languages(const word_list& words) const
+{
+    // One bit per dictionary, cleared when a word is not in the dictionary.
+    std::vector<bool> candidates(lexicons_.size(), true);
+
+    for (const auto& word: words)
+    {
+        const auto entries = lookup(word);
+        if (entries == nullptr)
+            return{};
+
+        std::vector<bool> contains(lexicons_.size(), false);
+        for (const auto& entry: *entries)
+            contains[entry.lexicon] = true;
+
+        for (size_t ordinal = 0; ordinal < candidates.size(); ++ordinal)
+            candidates[ordinal] = candidates[ordinal] && contains[ordinal];
+    }
+
+    dictionary_list out;
+    for (size_t ordinal = 0; ordinal < candidates.size(); ++ordinal)
+        if (candidates[ordinal])
+            out.push_back(lexicons_[ordinal]);
+
+    return out;
+}
+
+bool mnemonic_index::validate(const word_list& words,
+    const dictionary& lexicon) const
+{
+    uint8_t unused;
+    if (!ordinal(unused, lexicon))
+        return validate_mnemonic(words, lexicon);
+
+    if ((words.size() % mnemonic_word_multiple) != 0)
+        return false;
+
+    const auto total_bits = bits_per_word * words.size();
+    const auto check_bits = total_bits / (entropy_bit_divisor + 1);
+
+    // The checksum is taken from a single hash.
+    if (check_bits > hash_size * byte_bits)
+        return validate_mnemonic(words, lexicon);
+
+    std::vector<uint16_t> indexes;
+    return find(indexes, words, lexicon) && checksum(indexes);
+}
+
+const dictionary* mnemonic_index::validate(const word_list& words,
+    const dictionary_list& lexicons) const
+{
+    for (const auto lexicon: lexicons)
+        if (validate(words, *lexicon))
+            return lexicon;
+
+    return nullptr;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,548 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/multi_sha256.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/sha256.hpp>
+
+#if defined(__SHA__) && defined(__SSE4_1__)
+#define BX_SHA256_EXTENSIONS
+#include <immintrin.h>
+#elif defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace libbitcoin {
+namespace explorer {
+
+constexpr size_t block_size = 64;
+constexpr size_t digest_words = hash_size / sizeof(uint32_t);
+constexpr size_t block_words = block_size / sizeof(uint32_t);
+constexpr size_t rounds = 64;
+
+// The padding is at least the 0x80 byte and the 64 bit message length.
+constexpr size_t minimum_padding = 1 + sizeof(uint64_t);
+
+typedef std::array<uint32_t, digest_words> scalar_state;
+
+// Words are stored by index then lane, so each operation on a word is a
+// loop over lanes that the compiler may vectorize.
+template <size_t Lanes>
+struct lanes
+{
+    typedef std::array<uint32_t, Lanes> word;
+    typedef std::array<word, digest_words> state;
+    typedef std::array<word, block_words> block;
+};
+
+static inline uint32_t rotate(uint32_t value, uint32_t bits)
+{
+    return (value >> bits) | (value << (32 - bits));
+}
+
+static inline uint32_t read_big_endian(const uint8_t* data)
+{
+    return (uint32_t(data[0]) << 24) | (uint32_t(data[1]) << 16) |
+        (uint32_t(data[2]) << 8) | uint32_t(data[3]);
+}
+
+static inline void write_big_endian(uint8_t* data, uint32_t value)
+{
+    data[0] = static_cast<uint8_t>(value >> 24);
+    data[1] = static_cast<uint8_t>(value >> 16);
+    data[2] = static_cast<uint8_t>(value >> 8);
+    data[3] = static_cast<uint8_t>(value);
+}
+
+template <size_t Lanes>
+static void compress(typename lanes<Lanes>::state& state,
+    const typename lanes<Lanes>::block& block)
+{
+    typedef typename lanes<Lanes>::word word;
+    std::array<word, rounds> schedule;
+    std::copy(block.begin(), block.end(), schedule.begin());
+
+    for (size_t round = block_words; round < rounds; ++round)
+    {
+        for (size_t lane = 0; lane < Lanes; ++lane)
+        {
+            const auto early = schedule[round - 15][lane];
+            const auto late = schedule[round - 2][lane];
+            const auto sigma0 = rotate(early, 7) ^ rotate(early, 18) ^
+                (early >> 3);
+            const auto sigma1 = rotate(late, 17) ^ rotate(late, 19) ^
+                (late >> 10);
+            schedule[round][lane] = schedule[round - 16][lane] + sigma0 +
+                schedule[round - 7][lane] + sigma1;
+        }
+    }
+
+    auto a = state[0], b = state[1], c = state[2], d = state[3];
+    auto e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        for (size_t lane = 0; lane < Lanes; ++lane)
+        {
+            const auto sum1 = rotate(e[lane], 6) ^ rotate(e[lane], 11) ^
+                rotate(e[lane], 25);
+            const auto choose = (e[lane] & f[lane]) ^ (~e[lane] & g[lane]);
+            const auto temp1 = h[lane] + sum1 + choose + sha256_constants[round] +
+                schedule[round][lane];
+            const auto sum0 = rotate(a[lane], 2) ^ rotate(a[lane], 13) ^
+                rotate(a[lane], 22);
+            const auto majority = (a[lane] & b[lane]) ^ (a[lane] & c[lane]) ^
+                (b[lane] & c[lane]);
+            const auto temp2 = sum0 + majority;
+
+            h[lane] = g[lane];
+            g[lane] = f[lane];
+            f[lane] = e[lane];
+            e[lane] = d[lane] + temp1;
+            d[lane] = c[lane];
+            c[lane] = b[lane];
+            b[lane] = a[lane];
+            a[lane] = temp1 + temp2;
+        }
+    }
+
+    for (size_t lane = 0; lane < Lanes; ++lane)
+    {
+        state[0][lane] += a[lane];
+        state[1][lane] += b[lane];
+        state[2][lane] += c[lane];
+        state[3][lane] += d[lane];
+        state[4][lane] += e[lane];
+        state[5][lane] += f[lane];
+        state[6][lane] += g[lane];
+        state[7][lane] += h[lane];
+    }
+}
+
+#if defined(__AVX2__) && !defined(BX_SHA256_EXTENSIONS)
+
+// Eight lanes map exactly to the eight 32 bit elements of an AVX2 register.
+static_assert(sha256_lanes == 8, "AVX2 compression requires 8 lanes");
+
+static inline __m256i load(const std::array<uint32_t, 8>& word)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(word.data()));
+}
+
+static inline void store(std::array<uint32_t, 8>& word, __m256i value)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(word.data()), value);
+}
+
+static inline __m256i add(__m256i left, __m256i right)
+{
+    return _mm256_add_epi32(left, right);
+}
+
+static inline __m256i exclusive(__m256i left, __m256i right)
+{
+    return _mm256_xor_si256(left, right);
+}
+
+#define BX_ROTATE(value, bits) \
+    _mm256_or_si256(_mm256_srli_epi32(value, bits), \
+        _mm256_slli_epi32(value, 32 - (bits)))
+
+template <>
+void compress<8>(lanes<8>::state& state, const lanes<8>::block& block)
+{
+    __m256i schedule[rounds];
+    for (size_t round = 0; round < block_words; ++round)
+        schedule[round] = load(block[round]);
+
+    for (size_t round = block_words; round < rounds; ++round)
+    {
+        const auto early = schedule[round - 15];
+        const auto late = schedule[round - 2];
+        const auto sigma0 = exclusive(exclusive(BX_ROTATE(early, 7),
+            BX_ROTATE(early, 18)), _mm256_srli_epi32(early, 3));
+        const auto sigma1 = exclusive(exclusive(BX_ROTATE(late, 17),
+            BX_ROTATE(late, 19)), _mm256_srli_epi32(late, 10));
+        schedule[round] = add(add(schedule[round - 16], sigma0),
+            add(schedule[round - 7], sigma1));
+    }
+
+    auto a = load(state[0]), b = load(state[1]);
+    auto c = load(state[2]), d = load(state[3]);
+    auto e = load(state[4]), f = load(state[5]);
+    auto g = load(state[6]), h = load(state[7]);
+
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        const auto constant = _mm256_set1_epi32(
+            static_cast<int>(sha256_constants[round]));
+        const auto sum1 = exclusive(exclusive(BX_ROTATE(e, 6),
+            BX_ROTATE(e, 11)), BX_ROTATE(e, 25));
+        const auto choose = exclusive(_mm256_and_si256(e, f),
+            _mm256_andnot_si256(e, g));
+        const auto temp1 = add(add(add(h, sum1), add(choose, constant)),
+            schedule[round]);
+        const auto sum0 = exclusive(exclusive(BX_ROTATE(a, 2),
+            BX_ROTATE(a, 13)), BX_ROTATE(a, 22));
+        const auto majority = exclusive(exclusive(_mm256_and_si256(a, b),
+            _mm256_and_si256(a, c)), _mm256_and_si256(b, c));
+        const auto temp2 = add(sum0, majority);
+
+        h = g;
+        g = f;
+        f = e;
+        e = add(d, temp1);
+        d = c;
+        c = b;
+        b = a;
+        a = add(temp1, temp2);
+    }
+
+    store(state[0], add(load(state[0]), a));
+    store(state[1], add(load(state[1]), b));
+    store(state[2], add(load(state[2]), c));
+    store(state[3], add(load(state[3]), d));
+    store(state[4], add(load(state[4]), e));
+    store(state[5], add(load(state[5]), f));
+    store(state[6], add(load(state[6]), g));
+    store(state[7], add(load(state[7]), h));
+}
+
+#undef BX_ROTATE
+
+#endif
+
+#ifdef BX_SHA256_EXTENSIONS
+
+// Compress one block with the SHA extensions, which hold the state in the
+// ABEF and CDGH word orders and perform two rounds per instruction.
+static void compress_bytes(scalar_state& state, const uint8_t* data)
+{
+#ifdef __AVX__
+    // The SHA instructions have no VEX encoding, so clear the upper AVX
+    // state to avoid the penalty of mixing with legacy SSE encodings.
+    _mm256_zeroupper();
+#endif
+
+    const auto mask = _mm_set_epi64x(0x0c0d0e0f08090a0bll,
+        0x0405060700010203ll);
+
+    auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+    auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+    low = _mm_shuffle_epi32(low, 0xb1);
+    high = _mm_shuffle_epi32(high, 0x1b);
+    auto abef = _mm_alignr_epi8(low, high, 8);
+    auto cdgh = _mm_blend_epi16(high, low, 0xf0);
+    const auto abef_saved = abef;
+    const auto cdgh_saved = cdgh;
+
+    __m128i message[4];
+    for (size_t group = 0; group < 4; ++group)
+        message[group] = _mm_shuffle_epi8(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + group * 16)), mask);
+
+    for (size_t group = 0; group < rounds / 4; ++group)
+    {
+        auto& words = message[group % 4];
+
+        if (group >= 4)
+        {
+            const auto& next = message[(group + 1) % 4];
+            const auto& older = message[(group + 2) % 4];
+            const auto& newer = message[(group + 3) % 4];
+            words = _mm_sha256msg2_epu32(_mm_add_epi32(
+                _mm_sha256msg1_epu32(words, next),
+                _mm_alignr_epi8(newer, older, 4)), newer);
+        }
+
+        auto sum = _mm_add_epi32(words, _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(&sha256_constants[group * 4])));
+        cdgh = _mm_sha256rnds2_epu32(cdgh, abef, sum);
+        sum = _mm_shuffle_epi32(sum, 0x0e);
+        abef = _mm_sha256rnds2_epu32(abef, cdgh, sum);
+    }
+
+    abef = _mm_add_epi32(abef, abef_saved);
+    cdgh = _mm_add_epi32(cdgh, cdgh_saved);
+
+    const auto feba = _mm_shuffle_epi32(abef, 0x1b);
+    const auto dchg = _mm_shuffle_epi32(cdgh, 0xb1);
+    low = _mm_blend_epi16(feba, dchg, 0xf0);
+    high = _mm_alignr_epi8(dchg, feba, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), low);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), high);
+}
+
+#endif
+
+// The number of blocks of the padded message.
+static size_t padded_blocks(size_t size)
+{
+    return (size + minimum_padding + block_size - 1) / block_size;
+}
+
+// Copy a block of the padded message, which is all zeros beyond the end.
+static void copy_block(uint8_t* out, data_slice message, size_t block)
+{
+    const auto size = message.size();
+    const auto offset = block * block_size;
+    std::fill(out, out + block_size, 0);
+
+    if (offset < size)
+    {
+        const auto count = std::min(block_size, size - offset);
+        std::copy(message.data() + offset, message.data() + offset + count,
+            out);
+    }
+
+    if (size >= offset && size < offset + block_size)
+        out[size - offset] = 0x80;
+
+    if (block + 1 == padded_blocks(size))
+    {
+        const auto bits = uint64_t(size) * 8;
+        const auto length = out + block_size - sizeof(uint64_t);
+        write_big_endian(length, static_cast<uint32_t>(bits >> 32));
+        write_big_endian(length + sizeof(uint32_t),
+            static_cast<uint32_t>(bits));
+    }
+}
+
+static hash_digest to_digest(const scalar_state& state)
+{
+    hash_digest out;
+    for (size_t word = 0; word < digest_words; ++word)
+        write_big_endian(out.data() + word * sizeof(uint32_t), state[word]);
+
+    return out;
+}
+
+#ifdef BX_SHA256_EXTENSIONS
+
+static hash_digest hash_single(data_slice message)
+{
+    auto state = sha256_initial;
+    std::array<uint8_t, block_size> buffer;
+    const auto blocks = padded_blocks(message.size());
+
+    // Whole blocks of the message are compressed in place.
+    const auto whole = message.size() / block_size;
+    for (size_t block = 0; block < whole; ++block)
+        compress_bytes(state, message.data() + block * block_size);
+
+    for (auto block = whole; block < blocks; ++block)
+    {
+        copy_block(buffer.data(), message, block);
+        compress_bytes(state, buffer.data());
+    }
+
+    return to_digest(state);
+}
+
+#else
+
+// Messages not hashed in lanes are hashed by the scalar implementation.
+static hash_digest hash_single(data_slice message)
+{
+    sha256_context context;
+    context.write(message);
+    return context.finalize();
+}
+
+#endif
+
+// Hash one message per lane. Lanes with fewer blocks than the longest
+// message compress padding blocks after their last, which are discarded.
+template <size_t Lanes>
+static void hash_lanes(hash_digest* const* out, const data_slice* messages)
+{
+    typename lanes<Lanes>::state state;
+    typename lanes<Lanes>::block block;
+    std::array<uint8_t, block_size> buffer;
+    std::array<size_t, Lanes> blocks;
+
+    for (size_t lane = 0; lane < Lanes; ++lane)
+    {
+        blocks[lane] = padded_blocks(messages[lane].size());
+        for (size_t word = 0; word < digest_words; ++word)
+            state[word][lane] = sha256_initial[word];
+    }
+
+    const auto longest = *std::max_element(blocks.begin(), blocks.end());
+
+    for (size_t index = 0; index < longest; ++index)
+    {
+        for (size_t lane = 0; lane < Lanes; ++lane)
+        {
+            copy_block(buffer.data(), messages[lane], index);
+            for (size_t word = 0; word < block_words; ++word)
+                block[word][lane] = read_big_endian(buffer.data() +
+                    word * sizeof(uint32_t));
+        }
+
+        compress<Lanes>(state, block);
+
+        for (size_t lane = 0; lane < Lanes; ++lane)
+        {
+            if (index + 1 != blocks[lane])
+                continue;
+
+            scalar_state lane_state;
+            for (size_t word = 0; word < digest_words; ++word)
+                lane_state[word] = state[word][lane];
+
+            *out[lane] = to_digest(lane_state);
+        }
+    }
+}
+
+static std::vector<hash_digest> hash_all(
+    const std::vector<data_slice>& messages)
+{
+    const auto count = messages.size();
+    std::vector<hash_digest> out(count);
+
+#ifdef BX_SHA256_EXTENSIONS
+    // A block with the SHA extensions is faster than a share of a block in
+    // eight AVX2 lanes, so lanes are not used.
+    for (size_t index = 0; index < count; ++index)
+        out[index] = hash_single(messages[index]);
+#else
+    constexpr auto width = sha256_lanes;
+
+    // Messages of similar length are grouped to minimize discarded blocks.
+    std::vector<size_t> order(count);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+        [&messages](size_t left, size_t right)
+        {
+            return messages[left].size() < messages[right].size();
+        });
+
+    const auto grouped = count - (count % width);
+    std::array<hash_digest*, width> targets;
+    std::vector<data_slice> group;
+
+    for (size_t index = 0; index < grouped; index += width)
+    {
+        group.clear();
+        for (size_t lane = 0; lane < width; ++lane)
+        {
+            targets[lane] = &out[order[index + lane]];
+            group.push_back(messages[order[index + lane]]);
+        }
+
+        hash_lanes<width>(targets.data(), group.data());
+    }
+
+    for (auto index = grouped; index < count; ++index)
+        out[order[index]] = hash_single(messages[order[index]]);
+#endif
+
+    return out;
+}
+
+std::vector<hash_digest> sha256_hash_batch(const data_stack& messages)
+{
+    return hash_all(std::vector<data_slice>(messages.begin(),
+        messages.end()));
+}
+
+std::vector<hash_digest> bitcoin_hash_batch(const data_stack& messages)
+{
+    return bitcoin_hash_batch(std::vector<data_slice>(messages.begin(),
+        messages.end()));
+}
+
+std::vector<hash_digest> bitcoin_hash_batch(
+    const std::vector<data_slice>& messages)
+{
+    const auto first = hash_all(messages);
+    return hash_all(std::vector<data_slice>(first.begin(), first.end()));
+}
+
+void bitcoin_hash_pairs(hash_digest* out, const hash_digest* in, size_t pairs)
+{
+    constexpr auto pair_size = 2 * hash_size;
+    const auto pair = [in](size_t index)
+    {
+        const auto begin = in[2 * index].data();
+        return data_slice(begin, begin + pair_size);
+    };
+
+#ifdef BX_SHA256_EXTENSIONS
+    for (size_t index = 0; index < pairs; ++index)
+        out[index] = hash_single(hash_single(pair(index)));
+#else
+    constexpr auto width = sha256_lanes;
+    const auto grouped = pairs - (pairs % width);
+
+    // The first hashes of a group are held apart from the output, so that
+    // each group is read in full before its parents are written.
+    std::array<hash_digest, width> first;
+    std::array<hash_digest*, width> targets;
+    std::vector<data_slice> group;
+
+    for (size_t index = 0; index < grouped; index += width)
+    {
+        group.clear();
+        for (size_t lane = 0; lane < width; ++lane)
+        {
+            targets[lane] = &first[lane];
+            group.push_back(pair(index + lane));
+        }
+
+        hash_lanes<width>(targets.data(), group.data());
+
+        group.clear();
+        for (size_t lane = 0; lane < width; ++lane)
+        {
+            targets[lane] = &out[index + lane];
+            group.push_back(first[lane]);
+        }
+
+        hash_lanes<width>(targets.data(), group.data());
+    }
+
+    for (auto index = grouped; index < pairs; ++index)
+        out[index] = hash_single(hash_single(pair(index)));
+#endif
+}
+
+std::vector<short_hash> bitcoin_short_hash_batch(const data_stack& messages)
+{
+    const auto first = sha256_hash_batch(messages);
+    std::vector<short_hash> out;
+    out.reserve(first.size());
+
+    for (const auto& hash: first)
+        out.push_back(ripemd160_hash(hash));
+
+    return out;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,464 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/pbkdf2.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace libbitcoin {
+namespace explorer {
+
+constexpr size_t block_size = 128;
+constexpr size_t digest_size = 64;
+constexpr size_t digest_words = digest_size / sizeof(uint64_t);
+constexpr size_t block_words = block_size / sizeof(uint64_t);
+constexpr size_t rounds = 80;
+
+static const std::array<uint64_t, digest_words> initial
+{
+    {
+        0x6a09e667f3bcc908, 0xbb67ae8584caa73b,
+        0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+        0x510e527fade682d1, 0x9b05688c2b3e6c1f,
+        0x1f83d9abfb41bd6b, 0x5be0cd19137e2179
+    }
+};
+
+static const std::array<uint64_t, rounds> constants
+{
+    {
+        0x428a2f98d728ae22, 0x7137449123ef65cd,
+        0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
+        0x3956c25bf348b538, 0x59f111f1b605d019,
+        0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
+        0xd807aa98a3030242, 0x12835b0145706fbe,
+        0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+        0x72be5d74f27b896f, 0x80deb1fe3b1696b1,
+        0x9bdc06a725c71235, 0xc19bf174cf692694,
+        0xe49b69c19ef14ad2, 0xefbe4786384f25e3,
+        0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+        0x2de92c6f592b0275, 0x4a7484aa6ea6e483,
+        0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+        0x983e5152ee66dfab, 0xa831c66d2db43210,
+        0xb00327c898fb213f, 0xbf597fc7beef0ee4,
+        0xc6e00bf33da88fc2, 0xd5a79147930aa725,
+        0x06ca6351e003826f, 0x142929670a0e6e70,
+        0x27b70a8546d22ffc, 0x2e1b21385c26c926,
+        0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+        0x650a73548baf63de, 0x766a0abb3c77b2a8,
+        0x81c2c92e47edaee6, 0x92722c851482353b,
+        0xa2bfe8a14cf10364, 0xa81a664bbc423001,
+        0xc24b8b70d0f89791, 0xc76c51a30654be30,
+        0xd192e819d6ef5218, 0xd69906245565a910,
+        0xf40e35855771202a, 0x106aa07032bbd1b8,
+        0x19a4c116b8d2d0c8, 0x1e376c085141ab53,
+        0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
+        0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb,
+        0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
+        0x748f82ee5defb2fc, 0x78a5636f43172f60,
+        0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+        0x90befffa23631e28, 0xa4506cebde82bde9,
+        0xbef9a3f7b2c67915, 0xc67178f2e372532b,
+        0xca273eceea26619c, 0xd186b8c721c0c207,
+        0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
+        0x06f067aa72176fba, 0x0a637dc5a2c898a6,
+        0x113f9804bef90dae, 0x1b710b35131c471b,
+        0x28db77f523047d84, 0x32caab7b40c72493,
+        0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
+        0x4cc5d4becb3e42b6, 0x597f299cfc657e2a,
+        0x5fcb6fab3ad6faec, 0x6c44198c4a475817
+    }
+};
+
+// Words are stored by index then lane, so each operation on a word is a
+// loop over lanes that the compiler may vectorize.
+template <size_t Lanes>
+struct lanes
+{
+    typedef std::array<uint64_t, Lanes> word;
+    typedef std::array<word, digest_words> state;
+    typedef std::array<word, block_words> block;
+};
+
+typedef std::array<uint64_t, digest_words> scalar_state;
+
+static inline uint64_t rotate(uint64_t value, uint64_t bits)
+{
+    return (value >> bits) | (value << (64 - bits));
+}
+
+static inline uint64_t read_big_endian(const uint8_t* data)
+{
+    uint64_t value = 0;
+    for (size_t byte = 0; byte < sizeof(value); ++byte)
+        value = (value << 8) | data[byte];
+
+    return value;
+}
+
+static inline void write_big_endian(uint8_t* data, uint64_t value)
+{
+    for (size_t byte = 0; byte < sizeof(value); ++byte)
+        data[byte] = static_cast<uint8_t>(value >> (56 - 8 * byte));
+}
+
+template <size_t Lanes>
+static void compress(typename lanes<Lanes>::state& state,
+    const typename lanes<Lanes>::block& block)
+{
+    typedef typename lanes<Lanes>::word word;
+    std::array<word, rounds> schedule;
+    std::copy(block.begin(), block.end(), schedule.begin());
+
+    for (size_t round = block_words; round < rounds; ++round)
+    {
+        for (size_t lane = 0; lane < Lanes; ++lane)
+        {
+            const auto early = schedule[round - 15][lane];
+            const auto late = schedule[round - 2][lane];
+            const auto sigma0 = rotate(early, 1) ^ rotate(early, 8) ^
+                (early >> 7);
+            const auto sigma1 = rotate(late, 19) ^ rotate(late, 61) ^
+                (late >> 6);
+            schedule[round][lane] = schedule[round - 16][lane] + sigma0 +
+                schedule[round - 7][lane] + sigma1;
+        }
+    }
+
+    auto a = state[0], b = state[1], c = state[2], d = state[3];
+    auto e = state[4], f = state[5], g = state[6], h = state[7];
+
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        for (size_t lane = 0; lane < Lanes; ++lane)
+        {
+            const auto sum1 = rotate(e[lane], 14) ^ rotate(e[lane], 18) ^
+                rotate(e[lane], 41);
+            const auto choose = (e[lane] & f[lane]) ^ (~e[lane] & g[lane]);
+            const auto temp1 = h[lane] + sum1 + choose + constants[round] +
+                schedule[round][lane];
+            const auto sum0 = rotate(a[lane], 28) ^ rotate(a[lane], 34) ^
+                rotate(a[lane], 39);
+            const auto majority = (a[lane] & b[lane]) ^ (a[lane] & c[lane]) ^
+                (b[lane] & c[lane]);
+            const auto temp2 = sum0 + majority;
+
+            h[lane] = g[lane];
+            g[lane] = f[lane];
+            f[lane] = e[lane];
+            e[lane] = d[lane] + temp1;
+            d[lane] = c[lane];
+            c[lane] = b[lane];
+            b[lane] = a[lane];
+            a[lane] = temp1 + temp2;
+        }
+    }
+
+    for (size_t lane = 0; lane < Lanes; ++lane)
+    {
+        state[0][lane] += a[lane];
+        state[1][lane] += b[lane];
+        state[2][lane] += c[lane];
+        state[3][lane] += d[lane];
+        state[4][lane] += e[lane];
+        state[5][lane] += f[lane];
+        state[6][lane] += g[lane];
+        state[7][lane] += h[lane];
+    }
+}
+
+#ifdef __AVX2__
+
+// Four lanes map exactly to the four 64 bit elements of an AVX2 register.
+static_assert(pbkdf2_sha512_lanes == 4, "AVX2 compression requires 4 lanes");
+
+static inline __m256i load(const std::array<uint64_t, 4>& word)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(word.data()));
+}
+
+static inline void store(std::array<uint64_t, 4>& word, __m256i value)
+{
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(word.data()), value);
+}
+
+static inline __m256i add(__m256i left, __m256i right)
+{
+    return _mm256_add_epi64(left, right);
+}
+
+static inline __m256i exclusive(__m256i left, __m256i right)
+{
+    return _mm256_xor_si256(left, right);
+}
+
+#define BX_ROTATE(value, bits) \
+    _mm256_or_si256(_mm256_srli_epi64(value, bits), \
+        _mm256_slli_epi64(value, 64 - (bits)))
+
+template <>
+void compress<4>(lanes<4>::state& state, const lanes<4>::block& block)
+{
+    __m256i schedule[rounds];
+    for (size_t round = 0; round < block_words; ++round)
+        schedule[round] = load(block[round]);
+
+    for (size_t round = block_words; round < rounds; ++round)
+    {
+        const auto early = schedule[round - 15];
+        const auto late = schedule[round - 2];
+        const auto sigma0 = exclusive(exclusive(BX_ROTATE(early, 1),
+            BX_ROTATE(early, 8)), _mm256_srli_epi64(early, 7));
+        const auto sigma1 = exclusive(exclusive(BX_ROTATE(late, 19),
+            BX_ROTATE(late, 61)), _mm256_srli_epi64(late, 6));
+        schedule[round] = add(add(schedule[round - 16], sigma0),
+            add(schedule[round - 7], sigma1));
+    }
+
+    auto a = load(state[0]), b = load(state[1]);
+    auto c = load(state[2]), d = load(state[3]);
+    auto e = load(state[4]), f = load(state[5]);
+    auto g = load(state[6]), h = load(state[7]);
+
+    for (size_t round = 0; round < rounds; ++round)
+    {
+        const auto constant = _mm256_set1_epi64x(
+            static_cast<long long>(constants[round]));
+        const auto sum1 = exclusive(exclusive(BX_ROTATE(e, 14),
+            BX_ROTATE(e, 18)), BX_ROTATE(e, 41));
+        const auto choose = exclusive(_mm256_and_si256(e, f),
+            _mm256_andnot_si256(e, g));
+        const auto temp1 = add(add(add(h, sum1), add(choose, constant)),
+            schedule[round]);
+        const auto sum0 = exclusive(exclusive(BX_ROTATE(a, 28),
+            BX_ROTATE(a, 34)), BX_ROTATE(a, 39));
+        const auto majority = exclusive(exclusive(_mm256_and_si256(a, b),
+            _mm256_and_si256(a, c)), _mm256_and_si256(b, c));
+        const auto temp2 = add(sum0, majority);
+
+        h = g;
+        g = f;
+        f = e;
+        e = add(d, temp1);
+        d = c;
+        c = b;
+        b = a;
+        a = add(temp1, temp2);
+    }
+
+    store(state[0], add(load(state[0]), a));
+    store(state[1], add(load(state[1]), b));
+    store(state[2], add(load(state[2]), c));
+    store(state[3], add(load(state[3]), d));
+    store(state[4], add(load(state[4]), e));
+    store(state[5], add(load(state[5]), f));
+    store(state[6], add(load(state[6]), g));
+    store(state[7], add(load(state[7]), h));
+}
+
+#undef BX_ROTATE
+
+#endif
+
+static void compress_bytes(scalar_state& state, const uint8_t* data)
+{
+    lanes<1>::state lane_state;
+    lanes<1>::block lane_block;
+
+    for (size_t word = 0; word < digest_words; ++word)
+        lane_state[word][0] = state[word];
+
+    for (size_t word = 0; word < block_words; ++word)
+        lane_block[word][0] = read_big_endian(data + word * sizeof(uint64_t));
+
+    compress<1>(lane_state, lane_block);
+
+    for (size_t word = 0; word < digest_words; ++word)
+        state[word] = lane_state[word][0];
+}
+
+// Hash a message that follows a prefix of whole blocks already compressed
+// into the state, where the prefix size is in bytes.
+static long_hash finalize(scalar_state state, const uint8_t* data,
+    size_t size, uint64_t prefix_size)
+{
+    const auto bits = (prefix_size + size) * 8;
+    const auto whole = size - (size % block_size);
+
+    for (size_t offset = 0; offset < whole; offset += block_size)
+        compress_bytes(state, data + offset);
+
+    // The padding and 128 bit length occupy one or two blocks.
+    std::array<uint8_t, 2 * block_size> tail{};
+    const auto remainder = size - whole;
+    std::copy(data + whole, data + size, tail.begin());
+    tail[remainder] = 0x80;
+
+    const size_t blocks = remainder + 1 + 16 > block_size ? 2 : 1;
+    const auto end = blocks * block_size;
+    write_big_endian(tail.data() + end - sizeof(uint64_t), bits);
+
+    for (size_t block = 0; block < blocks; ++block)
+        compress_bytes(state, tail.data() + block * block_size);
+
+    long_hash out;
+    for (size_t word = 0; word < digest_words; ++word)
+        write_big_endian(out.data() + word * sizeof(uint64_t), state[word]);
+
+    return out;
+}
+
+// The HMAC key pad states, each the compression of a padded key block.
+struct hmac_pads
+{
+    scalar_state inner;
+    scalar_state outer;
+};
+
+static hmac_pads make_pads(data_slice password)
+{
+    std::array<uint8_t, block_size> key{};
+
+    if (password.size() > block_size)
+    {
+        const auto hash = finalize(initial, password.data(), password.size(),
+            0);
+        std::copy(hash.begin(), hash.end(), key.begin());
+    }
+    else
+    {
+        std::copy(password.begin(), password.end(), key.begin());
+    }
+
+    auto inner_key = key;
+    auto outer_key = key;
+    for (size_t byte = 0; byte < block_size; ++byte)
+    {
+        inner_key[byte] ^= 0x36;
+        outer_key[byte] ^= 0x5c;
+    }
+
+    hmac_pads pads{ initial, initial };
+    compress_bytes(pads.inner, inner_key.data());
+    compress_bytes(pads.outer, outer_key.data());
+    return pads;
+}
+
+// The first iteration hashes the salt and the (big endian) block index one.
+static long_hash first_iteration(const hmac_pads& pads, data_slice salt)
+{
+    data_chunk message(salt.begin(), salt.end());
+    extend_data(message, data_chunk{ 0x00, 0x00, 0x00, 0x01 });
+
+    const auto inner = finalize(pads.inner, message.data(), message.size(),
+        block_size);
+    return finalize(pads.outer, inner.data(), inner.size(), block_size);
+}
+
+// Derive one key per lane. After the first, every inner and outer hash is
+// of a single digest following the key block, so all remaining iterations
+// are two compressions of an identically padded block.
+template <size_t Lanes>
+static void derive(long_hash* out, const data_chunk* passwords,
+    data_slice salt, size_t iterations)
+{
+    typename lanes<Lanes>::state inner;
+    typename lanes<Lanes>::state outer;
+    typename lanes<Lanes>::state result;
+    typename lanes<Lanes>::block block;
+
+    for (size_t lane = 0; lane < Lanes; ++lane)
+    {
+        const auto pads = make_pads(passwords[lane]);
+        const auto first = first_iteration(pads, salt);
+
+        for (size_t word = 0; word < digest_words; ++word)
+        {
+            inner[word][lane] = pads.inner[word];
+            outer[word][lane] = pads.outer[word];
+            result[word][lane] = read_big_endian(first.data() +
+                word * sizeof(uint64_t));
+            block[word][lane] = result[word][lane];
+        }
+
+        block[digest_words][lane] = uint64_t(0x80) << 56;
+        for (auto word = digest_words + 1; word < block_words - 1; ++word)
+            block[word][lane] = 0;
+
+        block[block_words - 1][lane] = (block_size + digest_size) * 8;
+    }
+
+    for (size_t iteration = 1; iteration < iterations; ++iteration)
+    {
+        auto state = inner;
+        compress<Lanes>(state, block);
+        std::copy(state.begin(), state.end(), block.begin());
+
+        state = outer;
+        compress<Lanes>(state, block);
+        std::copy(state.begin(), state.end(), block.begin());
+
+        for (size_t word = 0; word < digest_words; ++word)
+            for (size_t lane = 0; lane < Lanes; ++lane)
+                result[word][lane] ^= state[word][lane];
+    }
+
+    for (size_t lane = 0; lane < Lanes; ++lane)
+        for (size_t word = 0; word < digest_words; ++word)
+            write_big_endian(out[lane].data() + word * sizeof(uint64_t),
+                result[word][lane]);
+}
+
+long_hash pbkdf2_sha512(data_slice password, data_slice salt,
+    size_t iterations)
+{
+    long_hash out;
+    const data_chunk chunk(password.begin(), password.end());
+    derive<1>(&out, &chunk, salt, iterations);
+    return out;
+}
+
+std::vector<long_hash> pbkdf2_sha512_batch(const data_stack& passwords,
+    data_slice salt, size_t iterations)
+{
+    constexpr auto width = pbkdf2_sha512_lanes;
+    const auto count = passwords.size();
+    const auto grouped = count - (count % width);
+    std::vector<long_hash> out(count);
+
+    for (size_t index = 0; index < grouped; index += width)
+        derive<width>(&out[index], &passwords[index], salt, iterations);
+
+    for (auto index = grouped; index < count; ++index)
+        derive<1>(&out[index], &passwords[index], salt, iterations);
+
+    return out;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -20,6 +20,7 @@
 
 #include <bitcoin/explorer/prop_tree.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -33,6 +34,8 @@
 #include <bitcoin/explorer/config/script.hpp>
 #include <bitcoin/explorer/config/transaction.hpp>
 #include <bitcoin/explorer/config/wrapper.hpp>
+#include <bitcoin/explorer/tx_ancestry.hpp>
+#include <bitcoin/explorer/utility.hpp>
 
 using namespace pt;
 using namespace bc::client;
@@ -81,6 +84,37 @@ ptree prop_tree(const std::vector<header>& headers, bool json)
     return tree;
 }
 
+// blocks
+
+ptree prop_list(const chain::block& block, bool json, size_t threads)
+{
+    const auto& txs = block.transactions();
+    std::vector<ptree> lists(txs.size());
+
+    // Each transaction is hashed and rendered independently.
+    const auto render = [&](size_t index)
+    {
+        lists[index] = prop_list(txs[index], json);
+    };
+
+    parallel_for(txs.size(), render, threads);
+
+    ptree transactions;
+    for (const auto& list: lists)
+        add_child(transactions, "transaction", list, json);
+
+    ptree tree;
+    tree.add_child("header", prop_list(header(block.header())));
+    tree.add_child("transactions", transactions);
+    return tree;
+}
+ptree prop_tree(const chain::block& block, bool json, size_t threads)
+{
+    ptree tree;
+    tree.add_child("block", prop_list(block, json, threads));
+    return tree;
+}
+
 // transfers
 
 ptree prop_list(const chain::history& row)
@@ -283,10 +317,8 @@ ptree prop_tree(const chain::points_info& points_info, bool json)
 
 // transactions
 
-ptree prop_list(const transaction& transaction, bool json)
+ptree prop_list(const tx_type& tx, bool json)
 {
-    const tx_type& tx = transaction;
-
     ptree tree;
     tree.put("hash", hash256(tx.hash()));
     tree.add_child("inputs", prop_tree_list("input", tx.inputs(), json));
@@ -295,6 +327,11 @@ ptree prop_list(const transaction& transaction, bool json)
     tree.put("version", tx.version());
     return tree;
 }
+ptree prop_list(const transaction& transaction, bool json)
+{
+    const tx_type& tx = transaction;
+    return prop_list(tx, json);
+}
 ptree prop_tree(const transaction& transaction, bool json)
 {
     ptree tree;
@@ -434,6 +471,32 @@ ptree prop_tree(const hash_digest& hash, size_t height, size_t index)
     return tree;
 }
 
+// ancestors
+
+ptree prop_list(const ancestor& ancestor, bool json)
+{
+    ptree tree;
+    tree.put("confirmed", ancestor.confirmed);
+    tree.put("depth", ancestor.depth);
+    tree.put("hash", hash256(ancestor.hash));
+
+    if (ancestor.confirmed)
+        tree.put("height", ancestor.height);
+
+    const std::vector<hash256> parents(ancestor.parents.begin(),
+        ancestor.parents.end());
+    tree.add_child("parents", prop_value_list("hash", parents, json));
+    return tree;
+}
+
+ptree prop_tree(const std::vector<ancestor>& ancestors, bool json)
+{
+    ptree tree;
+    tree.add_child("ancestors",
+        prop_tree_list_of_lists("transaction", ancestors, json));
+    return tree;
+}
+
 // settings
 
 ptree prop_tree(const settings_list& settings)
@@ -0,0 +1,464 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/script_text.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+using namespace bc::machine;
+
+constexpr uint8_t to_byte(opcode code)
+{
+    return static_cast<uint8_t>(code);
+}
+
+// The largest null data push, as for the null data pattern.
+constexpr size_t maximum_null_data = 80;
+
+// The serialized sizes of the pay to key hash and script hash templates.
+constexpr size_t pay_key_hash_size = 3 + short_hash_size + 2;
+constexpr size_t pay_script_hash_size = 2 + short_hash_size + 1;
+
+// The name of each opcode and the opcode of each unique name, excluding the
+// push codes that are followed by data, which are written as data tokens.
+class opcode_table
+{
+public:
+    typedef std::pair<std::string, uint8_t> entry;
+
+    opcode_table()
+    {
+        static constexpr auto flags = rule_fork::all_rules;
+
+        for (size_t code = 0; code < names_.size(); ++code)
+        {
+            const auto value = static_cast<opcode>(code);
+            names_[code] = opcode_to_string(value, flags);
+
+            if (code == to_byte(opcode::push_size_0) ||
+                code > to_byte(opcode::push_four_size))
+                codes_.emplace_back(names_[code], static_cast<uint8_t>(code));
+        }
+
+        std::sort(codes_.begin(), codes_.end());
+
+        // An ambiguous name is left to the operation parser.
+        std::vector<entry> unique;
+        for (size_t index = 0; index < codes_.size(); ++index)
+        {
+            const auto& name = codes_[index].first;
+            if ((index > 0 && codes_[index - 1].first == name) ||
+                (index + 1 < codes_.size() && codes_[index + 1].first == name))
+                continue;
+
+            unique.push_back(codes_[index]);
+        }
+
+        codes_.swap(unique);
+    }
+
+    const std::string& name(uint8_t code) const
+    {
+        return names_[code];
+    }
+
+    bool find(uint8_t& out, const char* token, size_t size) const
+    {
+        const auto compare = [size](const entry& left, const char* right)
+        {
+            return left.first.compare(0, left.first.size(), right, size) < 0;
+        };
+
+        const auto it = std::lower_bound(codes_.begin(), codes_.end(), token,
+            compare);
+
+        if (it == codes_.end() ||
+            it->first.compare(0, it->first.size(), token, size) != 0)
+            return false;
+
+        out = it->second;
+        return true;
+    }
+
+private:
+    std::array<std::string, 256> names_;
+    std::vector<entry> codes_;
+};
+
+static const opcode_table& opcodes()
+{
+    static const opcode_table table;
+    return table;
+}
+
+static bool is_whitespace(uint8_t character)
+{
+    return character == ' ' || character == '\t' || character == '\r' ||
+        character == '\n';
+}
+
+static uint8_t push_code(size_t size)
+{
+    return size <= to_byte(opcode::push_size_75) ? static_cast<uint8_t>(size) :
+        size <= max_uint8 ? to_byte(opcode::push_one_size) :
+        size <= max_uint16 ? to_byte(opcode::push_two_size) :
+        to_byte(opcode::push_four_size);
+}
+
+// The size of the data of a push code, zero for other codes.
+static size_t prefix_size(uint8_t code)
+{
+    return code == to_byte(opcode::push_one_size) ? sizeof(uint8_t) :
+        code == to_byte(opcode::push_two_size) ? sizeof(uint16_t) :
+        code == to_byte(opcode::push_four_size) ? sizeof(uint32_t) : 0;
+}
+
+// A push of data, prefixed with the width of its size if not minimal.
+static void append_push(std::string& out, uint8_t code, const uint8_t* data,
+    size_t size)
+{
+    if (size == 0)
+    {
+        out += opcodes().name(code);
+        return;
+    }
+
+    out += '[';
+
+    if (code != push_code(size))
+    {
+        out += static_cast<char>('0' + prefix_size(code));
+        out += '.';
+    }
+
+    append_base16_text(out, data_slice(data, data + size));
+    out += ']';
+}
+
+static bool is_key_push(const uint8_t* position, const uint8_t* end)
+{
+    const auto remaining = static_cast<size_t>(end - position);
+
+    if (*position == to_byte(opcode::push_size_33))
+        return remaining > ec_compressed_size &&
+            (position[1] == 0x02 || position[1] == 0x03);
+
+    if (*position == to_byte(opcode::push_size_65))
+        return remaining > ec_uncompressed_size && position[1] == 0x04;
+
+    return false;
+}
+
+static bool is_positive(uint8_t code)
+{
+    return code >= to_byte(opcode::push_positive_1) &&
+        code <= to_byte(opcode::push_positive_16);
+}
+
+static bool is_pay_multisig(data_slice script)
+{
+    const auto begin = script.begin();
+    const auto end = script.end();
+
+    if (script.size() < 3 || !is_positive(begin[0]) ||
+        end[-1] != to_byte(opcode::checkmultisig) || !is_positive(end[-2]))
+        return false;
+
+    const auto signatures = begin[0] - to_byte(opcode::push_positive_1) + 1;
+    const auto keys = end[-2] - to_byte(opcode::push_positive_1) + 1;
+    if (signatures > keys)
+        return false;
+
+    auto position = begin + 1;
+    for (auto key = 0; key < keys; ++key)
+    {
+        if (position >= end - 2 || !is_key_push(position, end - 2))
+            return false;
+
+        position += 1 + *position;
+    }
+
+    return position == end - 2;
+}
+
+static bool is_null_data(data_slice script)
+{
+    const auto begin = script.begin();
+    const auto size = script.size();
+
+    if (size < 2 || begin[0] != to_byte(opcode::return_))
+        return false;
+
+    const auto code = begin[1];
+    if (code <= to_byte(opcode::push_size_75))
+        return code <= maximum_null_data && size == 2u + code;
+
+    if (code == to_byte(opcode::push_one_size))
+        return size > 2 && begin[2] <= maximum_null_data &&
+            size == 3u + begin[2];
+
+    return false;
+}
+
+standard_script match_standard_script(data_slice script)
+{
+    const auto data = script.begin();
+    const auto size = script.size();
+
+    if (size == pay_key_hash_size &&
+        data[0] == to_byte(opcode::dup) &&
+        data[1] == to_byte(opcode::hash160) &&
+        data[2] == to_byte(opcode::push_size_20) &&
+        data[23] == to_byte(opcode::equalverify) &&
+        data[24] == to_byte(opcode::checksig))
+        return standard_script::pay_key_hash;
+
+    if (size == pay_script_hash_size &&
+        data[0] == to_byte(opcode::hash160) &&
+        data[1] == to_byte(opcode::push_size_20) &&
+        data[22] == to_byte(opcode::equal))
+        return standard_script::pay_script_hash;
+
+    if (is_pay_multisig(script))
+        return standard_script::pay_multisig;
+
+    if (is_null_data(script))
+        return standard_script::null_data;
+
+    return standard_script::non_standard;
+}
+
+std::string standard_script_name(standard_script type)
+{
+    switch (type)
+    {
+        case standard_script::pay_key_hash:
+            return "pay_key_hash";
+        case standard_script::pay_script_hash:
+            return "pay_script_hash";
+        case standard_script::pay_multisig:
+            return "pay_multisig";
+        case standard_script::null_data:
+            return "null_data";
+        default:
+            return "non_standard";
+    }
+}
+
+void append_script_text(std::string& out, data_slice script)
+{
+    const auto& table = opcodes();
+    const auto begin = script.begin();
+    const auto end = script.end();
+
+    // The standard templates are written from their fixed layouts.
+    const auto name = [&table](opcode code) -> const std::string&
+    {
+        return table.name(to_byte(code));
+    };
+
+    switch (match_standard_script(script))
+    {
+        case standard_script::pay_key_hash:
+            out += name(opcode::dup);
+            out += ' ';
+            out += name(opcode::hash160);
+            out += " [";
+            append_base16_text(out, data_slice(begin + 3, begin + 23));
+            out += "] ";
+            out += name(opcode::equalverify);
+            out += ' ';
+            out += name(opcode::checksig);
+            return;
+
+        case standard_script::pay_script_hash:
+            out += name(opcode::hash160);
+            out += " [";
+            append_base16_text(out, data_slice(begin + 2, begin + 22));
+            out += "] ";
+            out += name(opcode::equal);
+            return;
+
+        case standard_script::pay_multisig:
+            out += table.name(begin[0]);
+            for (auto position = begin + 1; position < end - 2;
+                position += 1 + *position)
+            {
+                out += " [";
+                append_base16_text(out, data_slice(position + 1,
+                    position + 1 + *position));
+                out += ']';
+            }
+
+            out += ' ';
+            out += table.name(end[-2]);
+            out += ' ';
+            out += name(opcode::checkmultisig);
+            return;
+
+        case standard_script::null_data:
+        {
+            const auto prefix = prefix_size(begin[1]);
+            out += name(opcode::return_);
+            out += ' ';
+            append_push(out, begin[1], begin + 2 + prefix,
+                script.size() - 2 - prefix);
+            return;
+        }
+
+        default:
+            break;
+    }
+
+    for (auto position = begin; position != end;)
+    {
+        if (position != begin)
+            out += ' ';
+
+        const auto code = *position++;
+        const auto prefix = prefix_size(code);
+        const auto remaining = static_cast<size_t>(end - position);
+        size_t size = 0;
+
+        if (code <= to_byte(opcode::push_size_75))
+        {
+            size = code;
+        }
+        else if (prefix == 0)
+        {
+            out += table.name(code);
+            continue;
+        }
+        else if (prefix <= remaining)
+        {
+            for (size_t byte = 0; byte < prefix; ++byte)
+                size |= static_cast<size_t>(position[byte]) << (8 * byte);
+
+            position += prefix;
+        }
+        else
+        {
+            out += "<invalid>";
+            return;
+        }
+
+        // A truncated push ends the script, as in script parsing.
+        if (size > static_cast<size_t>(end - position))
+        {
+            out += "<invalid>";
+            return;
+        }
+
+        append_push(out, code, position, size);
+        position += size;
+    }
+}
+
+// Append a single token, parsing it as an operation if it is not a name or
+// a minimal data push.
+static bool append_token(data_chunk& out, const uint8_t* token, size_t size)
+{
+    const auto text = reinterpret_cast<const char*>(token);
+
+    uint8_t code;
+    if (opcodes().find(code, text, size))
+    {
+        out.push_back(code);
+        return true;
+    }
+
+    const auto is_push = size >= 2 && token[0] == '[' &&
+        token[size - 1] == ']';
+
+    if (is_push && std::find(token, token + size, '.') == token + size)
+    {
+        // The push code is written last, once the data size is known.
+        const auto start = out.size();
+        out.push_back(0);
+
+        if (!append_base16_data(out, data_slice(token + 1, token + size - 1)))
+        {
+            out.resize(start);
+            return false;
+        }
+
+        const auto data_size = out.size() - start - 1;
+        const auto push = push_code(data_size);
+        const auto prefix = prefix_size(push);
+        out[start] = push;
+
+        if (prefix != 0)
+        {
+            const auto length = to_little_endian(
+                static_cast<uint32_t>(data_size));
+            out.insert(out.begin() + start + 1, length.begin(),
+                length.begin() + prefix);
+        }
+
+        return true;
+    }
+
+    chain::operation operation;
+    if (!operation.from_string(std::string(text, size)))
+        return false;
+
+    extend_data(out, operation.to_data());
+    return true;
+}
+
+bool append_script_data(data_chunk& out, data_slice text)
+{
+    const auto start = out.size();
+    const auto end = text.end();
+    auto position = text.begin();
+
+    while (true)
+    {
+        while (position != end && is_whitespace(*position))
+            ++position;
+
+        if (position == end)
+            return true;
+
+        const auto token = position;
+        while (position != end && !is_whitespace(*position))
+            ++position;
+
+        const auto size = static_cast<size_t>(position - token);
+        if (!append_token(out, token, size))
+        {
+            out.resize(start);
+            return false;
+        }
+    }
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,194 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/sha256.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <bitcoin/bitcoin.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+constexpr size_t block_size = 64;
+constexpr size_t length_size = sizeof(uint64_t);
+
+const std::array<uint32_t, 8> sha256_initial
+{
+    {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+    }
+};
+
+const std::array<uint32_t, 64> sha256_constants
+{
+    {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+        0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+        0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+        0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+        0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+    }
+};
+
+static inline uint32_t rotate(uint32_t value, uint32_t bits)
+{
+    return (value >> bits) | (value << (32 - bits));
+}
+
+static inline uint32_t read_big_endian(const uint8_t* data)
+{
+    return
+        (static_cast<uint32_t>(data[0]) << 24) |
+        (static_cast<uint32_t>(data[1]) << 16) |
+        (static_cast<uint32_t>(data[2]) << 8) |
+        (static_cast<uint32_t>(data[3]));
+}
+
+sha256_context::sha256_context()
+  : state_(sha256_initial), buffer_(), size_(0)
+{
+}
+
+void sha256_context::write(const uint8_t* data, size_t size)
+{
+    auto used = static_cast<size_t>(size_ % block_size);
+    size_ += size;
+
+    // Complete a partially-filled block.
+    if (used != 0)
+    {
+        const auto fill = std::min(block_size - used, size);
+        std::copy(data, data + fill, buffer_.begin() + used);
+        data += fill;
+        size -= fill;
+        used += fill;
+
+        if (used < block_size)
+            return;
+
+        transform(buffer_.data());
+    }
+
+    // Hash whole blocks directly from the message.
+    for (; size >= block_size; data += block_size, size -= block_size)
+        transform(data);
+
+    std::copy(data, data + size, buffer_.begin());
+}
+
+void sha256_context::write(data_slice data)
+{
+    write(data.begin(), data.size());
+}
+
+hash_digest sha256_context::finalize() const
+{
+    auto copy = *this;
+    const auto bits = size_ * 8;
+
+    // Pad to the final block, leaving room for the big endian bit length.
+    std::array<uint8_t, block_size + length_size> pad{ { 0x80 } };
+    const auto used = static_cast<size_t>(size_ % block_size);
+    const auto padding = (used < block_size - length_size ? block_size :
+        2 * block_size) - used - length_size;
+
+    for (size_t byte = 0; byte < length_size; ++byte)
+        pad[padding + byte] = static_cast<uint8_t>(bits >> (56 - 8 * byte));
+
+    copy.write(pad.data(), padding + length_size);
+
+    hash_digest out;
+    for (size_t word = 0; word < copy.state_.size(); ++word)
+        for (size_t byte = 0; byte < sizeof(uint32_t); ++byte)
+            out[word * 4 + byte] = static_cast<uint8_t>(
+                copy.state_[word] >> (24 - 8 * byte));
+
+    return out;
+}
+
+void sha256_context::transform(const uint8_t* block)
+{
+    std::array<uint32_t, 64> words;
+    for (size_t index = 0; index < 16; ++index)
+        words[index] = read_big_endian(block + index * 4);
+
+    for (size_t index = 16; index < words.size(); ++index)
+    {
+        const auto low = words[index - 15];
+        const auto high = words[index - 2];
+        const auto sigma0 = rotate(low, 7) ^ rotate(low, 18) ^ (low >> 3);
+        const auto sigma1 = rotate(high, 17) ^ rotate(high, 19) ^ (high >> 10);
+        words[index] = words[index - 16] + sigma0 + words[index - 7] + sigma1;
+    }
+
+    auto a = state_[0];
+    auto b = state_[1];
+    auto c = state_[2];
+    auto d = state_[3];
+    auto e = state_[4];
+    auto f = state_[5];
+    auto g = state_[6];
+    auto h = state_[7];
+
+    for (size_t index = 0; index < words.size(); ++index)
+    {
+        const auto sum1 = rotate(e, 6) ^ rotate(e, 11) ^ rotate(e, 25);
+        const auto choose = (e & f) ^ (~e & g);
+        const auto temp1 = h + sum1 + choose + sha256_constants[index] + words[index];
+        const auto sum0 = rotate(a, 2) ^ rotate(a, 13) ^ rotate(a, 22);
+        const auto majority = (a & b) ^ (a & c) ^ (b & c);
+        const auto temp2 = sum0 + majority;
+
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+
+    state_[0] += a;
+    state_[1] += b;
+    state_[2] += c;
+    state_[3] += d;
+    state_[4] += e;
+    state_[5] += f;
+    state_[6] += g;
+    state_[7] += h;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,245 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/sighash_context.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/sha256.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+using namespace bc::chain;
+
+constexpr uint8_t sighash_mask = 0x1f;
+constexpr size_t outpoint_size = 36;
+constexpr size_t sequence_size = sizeof(uint32_t);
+constexpr size_t input_size = outpoint_size + 1 + sequence_size;
+
+// An empty script (its zero length prefix) and a zeroed sequence.
+static const uint8_t empty_script = 0x00;
+static const byte_array<sequence_size> zero_sequence{ { 0, 0, 0, 0 } };
+
+// A maximum value output with an empty script, for sighash single.
+static const byte_array<9> null_output
+{
+    { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00 }
+};
+
+// The hash signed where there is no corresponding input or output.
+static const hash_digest one_hash{ { 1 } };
+
+static data_chunk to_variable(uint64_t value)
+{
+    data_chunk out;
+
+    if (value < 0xfd)
+    {
+        out.push_back(static_cast<uint8_t>(value));
+    }
+    else if (value <= max_uint16)
+    {
+        out.push_back(0xfd);
+        extend_data(out, to_little_endian(static_cast<uint16_t>(value)));
+    }
+    else if (value <= max_uint32)
+    {
+        out.push_back(0xfe);
+        extend_data(out, to_little_endian(static_cast<uint32_t>(value)));
+    }
+    else
+    {
+        out.push_back(0xff);
+        extend_data(out, to_little_endian(value));
+    }
+
+    return out;
+}
+
+// The prefixed script with any code separators removed.
+static data_chunk to_script_code(const script& contract)
+{
+    const auto& ops = contract.operations();
+    const auto separator = [](const machine::operation& op)
+    {
+        return op.code() == machine::opcode::codeseparator;
+    };
+
+    if (std::none_of(ops.begin(), ops.end(), separator))
+        return contract.to_data(true);
+
+    machine::operation::list stripped;
+    for (const auto& op: ops)
+        if (!separator(op))
+            stripped.push_back(op);
+
+    return script(stripped).to_data(true);
+}
+
+sighash_context::sighash_context(const tx_type& tx)
+  : version_(tx.version()), locktime_(tx.locktime()),
+    inputs_(tx.inputs().size()), outputs_(tx.outputs().size())
+{
+    inputs_sequenced_.reserve(inputs_ * input_size);
+    inputs_unsequenced_.reserve(inputs_ * input_size);
+
+    for (const auto& input: tx.inputs())
+    {
+        const auto outpoint = input.previous_output().to_data();
+        extend_data(inputs_sequenced_, outpoint);
+        inputs_sequenced_.push_back(empty_script);
+        extend_data(inputs_sequenced_, to_little_endian(input.sequence()));
+        extend_data(inputs_unsequenced_, outpoint);
+        inputs_unsequenced_.push_back(empty_script);
+        extend_data(inputs_unsequenced_, zero_sequence);
+    }
+
+    outputs_all_ = to_variable(outputs_);
+    output_offsets_.reserve(outputs_ + 1);
+
+    for (const auto& output: tx.outputs())
+    {
+        output_offsets_.push_back(outputs_all_.size());
+        extend_data(outputs_all_, output.to_data());
+    }
+
+    output_offsets_.push_back(outputs_all_.size());
+
+    // The midstate of each input follows all of the inputs that precede it.
+    sha256_context sequenced;
+    sequenced.write(to_little_endian(version_));
+    sequenced.write(to_variable(inputs_));
+    auto unsequenced = sequenced;
+
+    prefixes_sequenced_.reserve(inputs_);
+    prefixes_unsequenced_.reserve(inputs_);
+
+    for (size_t index = 0; index < inputs_; ++index)
+    {
+        const auto offset = index * input_size;
+        prefixes_sequenced_.push_back(sequenced);
+        prefixes_unsequenced_.push_back(unsequenced);
+        sequenced.write(inputs_sequenced_.data() + offset, input_size);
+        unsequenced.write(inputs_unsequenced_.data() + offset, input_size);
+    }
+}
+
+hash_digest sighash_context::signature_hash(uint32_t index,
+    const script& contract, uint8_t sighash_type) const
+{
+    const auto type = sighash_type & sighash_mask;
+    const auto single = (type == machine::sighash_algorithm::single);
+    const auto none = (type == machine::sighash_algorithm::none);
+    const auto anyone = (sighash_type &
+        machine::sighash_algorithm::anyone_can_pay) != 0;
+
+    if (index >= inputs_ || (single && index >= outputs_))
+        return one_hash;
+
+    // Other inputs are committed without their sequences for none/single.
+    const auto sequenced = !single && !none;
+    const auto& inputs = sequenced ? inputs_sequenced_ : inputs_unsequenced_;
+    const auto& prefixes = sequenced ? prefixes_sequenced_ :
+        prefixes_unsequenced_;
+
+    // The signed input is always committed with its own sequence.
+    const auto offset = index * input_size;
+    const auto own = inputs_sequenced_.data() + offset;
+
+    sha256_context context;
+    if (anyone)
+    {
+        context.write(to_little_endian(version_));
+        context.write(to_variable(1));
+    }
+    else
+    {
+        context = prefixes[index];
+    }
+
+    context.write(own, outpoint_size);
+    context.write(to_script_code(contract));
+    context.write(own + outpoint_size + 1, sequence_size);
+
+    if (!anyone)
+    {
+        const auto next = offset + input_size;
+        context.write(inputs.data() + next, inputs.size() - next);
+    }
+
+    if (none)
+    {
+        context.write(to_variable(0));
+    }
+    else if (single)
+    {
+        const auto start = output_offsets_[index];
+        const auto end = output_offsets_[index + 1];
+        context.write(to_variable(index + 1));
+
+        for (size_t output = 0; output < index; ++output)
+            context.write(null_output);
+
+        context.write(outputs_all_.data() + start, end - start);
+    }
+    else
+    {
+        context.write(outputs_all_);
+    }
+
+    context.write(to_little_endian(locktime_));
+    context.write(to_little_endian(static_cast<uint32_t>(sighash_type)));
+    return sha256_hash(context.finalize());
+}
+
+bool sighash_context::create_endorsement(endorsement& out,
+    const ec_secret& secret, const script& contract, uint32_t index,
+    uint8_t sighash_type) const
+{
+    ec_signature signature;
+    const auto sighash = signature_hash(index, contract, sighash_type);
+    if (!sign(signature, secret, sighash) || !encode_signature(out, signature))
+        return false;
+
+    out.push_back(sighash_type);
+    return true;
+}
+
+bool sighash_context::check_signature(const ec_signature& signature,
+    uint8_t sighash_type, data_slice public_key, const script& contract,
+    uint32_t index) const
+{
+    if (public_key.empty())
+        return false;
+
+    const auto sighash = signature_hash(index, contract, sighash_type);
+    return verify_signature(public_key, sighash, signature);
+}
+
+size_t sighash_context::inputs() const
+{
+    return inputs_;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
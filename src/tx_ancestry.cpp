@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/tx_ancestry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+size_t tx_ancestry::hash_hasher::operator()(const hash_digest& hash) const
+{
+    // Transaction hashes are uniform, so a prefix is a sufficient hash.
+    size_t value;
+    std::memcpy(&value, hash.data(), sizeof(value));
+    return value;
+}
+
+tx_ancestry::tx_ancestry(index_fetcher fetch_index,
+    transaction_fetcher fetch_tx, size_t window, size_t depth)
+  : fetch_index_(fetch_index),
+    fetch_tx_(fetch_tx),
+    window_(std::max(window, size_t(1))),
+    depth_(depth),
+    pending_(0),
+    issuing_(false)
+{
+}
+
+void tx_ancestry::start(const hash_digest& hash)
+{
+    enqueue(hash, 0);
+    issue();
+}
+
+bool tx_ancestry::complete() const
+{
+    return pending_ == 0 && queue_.empty();
+}
+
+const code& tx_ancestry::error() const
+{
+    return error_;
+}
+
+const std::vector<ancestor>& tx_ancestry::ancestors() const
+{
+    return ancestors_;
+}
+
+void tx_ancestry::enqueue(const hash_digest& hash, size_t depth)
+{
+    if (!seen_.insert(hash).second)
+        return;
+
+    ancestors_.push_back({ hash, depth, false, 0, {} });
+    queue_.push_back(ancestors_.size() - 1);
+}
+
+void tx_ancestry::issue()
+{
+    // A fetcher that completes before returning reenters here, in which case
+    // the outermost call continues to issue the queued queries.
+    if (issuing_)
+        return;
+
+    issuing_ = true;
+
+    while (!error_ && pending_ < window_ && !queue_.empty())
+    {
+        const auto position = queue_.front();
+        queue_.pop_front();
+        ++pending_;
+        query(position);
+    }
+
+    issuing_ = false;
+}
+
+void tx_ancestry::query(size_t position)
+{
+    const auto handler = [this, position](const code& ec, size_t height)
+    {
+        handle_index(position, ec, height);
+    };
+
+    fetch_index_(ancestors_[position].hash, handler);
+}
+
+void tx_ancestry::handle_index(size_t position, const code& ec,
+    size_t height)
+{
+    if (ec == error::not_found && !error_)
+    {
+        // The transaction is unconfirmed, its fetch keeps the query's slot.
+        const auto handler = [this, position](const code& ec,
+            const chain::transaction& tx)
+        {
+            handle_transaction(position, ec, tx);
+        };
+
+        fetch_tx_(ancestors_[position].hash, handler);
+        return;
+    }
+
+    --pending_;
+
+    if (ec)
+    {
+        fail(ec);
+        return;
+    }
+
+    ancestors_[position].confirmed = true;
+    ancestors_[position].height = height;
+    issue();
+}
+
+void tx_ancestry::handle_transaction(size_t position, const code& ec,
+    const chain::transaction& tx)
+{
+    --pending_;
+
+    if (ec)
+    {
+        fail(ec);
+        return;
+    }
+
+    const auto depth = ancestors_[position].depth;
+    hash_list parents;
+
+    for (const auto& input: tx.inputs())
+    {
+        const auto& point = input.previous_output();
+        const auto& hash = point.hash();
+
+        if (point.is_null() ||
+            std::find(parents.begin(), parents.end(), hash) != parents.end())
+            continue;
+
+        parents.push_back(hash);
+
+        // The parents of the last generation are listed but not queried.
+        if (depth < depth_)
+            enqueue(hash, depth + 1);
+    }
+
+    // The enqueue may reallocate the ancestors, so this follows it.
+    ancestors_[position].parents = std::move(parents);
+    issue();
+}
+
+void tx_ancestry::fail(const code& ec)
+{
+    if (!error_)
+        error_ = ec;
+
+    queue_.clear();
+}
+
+} // namespace explorer
+} // namespace libbitcoin
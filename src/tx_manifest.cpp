@@ -0,0 +1,375 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/tx_manifest.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/base58_codec.hpp>
+#include <bitcoin/explorer/utility.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+using namespace bc::chain;
+
+// A range of the manifest text, which is not copied. Absent fields are null.
+struct text_range
+{
+    const char* begin;
+    const char* end;
+};
+
+// The fields of a line, an input if hash is present, otherwise an output.
+struct manifest_line
+{
+    text_range hash;
+    text_range index;
+    text_range sequence;
+    text_range target;
+    text_range amount;
+};
+
+static bool is_space(char character)
+{
+    return character == ' ' || character == '\t' || character == '\r';
+}
+
+static bool is_present(const text_range& range)
+{
+    return range.begin != nullptr;
+}
+
+static text_range trim(text_range range)
+{
+    while (range.begin != range.end && is_space(*range.begin))
+        ++range.begin;
+
+    while (range.end != range.begin && is_space(*(range.end - 1)))
+        --range.end;
+
+    return range;
+}
+
+static bool equals(const text_range& range, const char* literal)
+{
+    const auto length = std::strlen(literal);
+    return static_cast<size_t>(range.end - range.begin) == length &&
+        std::equal(range.begin, range.end, literal);
+}
+
+// Parse an unsigned decimal integer, with no sign and no overflow.
+template <typename Integer>
+static bool parse_number(Integer& out, const text_range& range)
+{
+    if (range.begin == range.end)
+        return false;
+
+    uint64_t value = 0;
+    for (auto it = range.begin; it != range.end; ++it)
+    {
+        if (*it < '0' || *it > '9')
+            return false;
+
+        const auto digit = static_cast<uint64_t>(*it - '0');
+        if (value > (max_uint64 - digit) / 10)
+            return false;
+
+        value = value * 10 + digit;
+    }
+
+    if (value > std::numeric_limits<Integer>::max())
+        return false;
+
+    out = static_cast<Integer>(value);
+    return true;
+}
+
+static data_slice to_slice(const text_range& range)
+{
+    const auto begin = reinterpret_cast<const uint8_t*>(range.begin);
+    const auto end = reinterpret_cast<const uint8_t*>(range.end);
+    return data_slice(begin, end);
+}
+
+// Decode a hash, which is displayed in reverse byte order.
+static bool parse_hash(hash_digest& out, const text_range& range)
+{
+    if (!decode_base16_into(out.data(), out.size(), to_slice(range)))
+        return false;
+
+    std::reverse(out.begin(), out.end());
+    return true;
+}
+
+// Parse a JSON string, escapes are not needed by any field.
+static bool parse_string(text_range& out, const char*& it, const char* end)
+{
+    if (it == end || *it != '"')
+        return false;
+
+    const auto begin = ++it;
+    while (it != end && *it != '"')
+        if (*it++ == '\\')
+            return false;
+
+    if (it == end)
+        return false;
+
+    out = { begin, it++ };
+    return true;
+}
+
+static void skip_space(const char*& it, const char* end)
+{
+    while (it != end && is_space(*it))
+        ++it;
+}
+
+static text_range* select_field(manifest_line& out, const text_range& key)
+{
+    if (equals(key, "hash"))
+        return &out.hash;
+    if (equals(key, "index"))
+        return &out.index;
+    if (equals(key, "sequence"))
+        return &out.sequence;
+    if (equals(key, "target"))
+        return &out.target;
+    if (equals(key, "amount"))
+        return &out.amount;
+
+    return nullptr;
+}
+
+// Parse a flat JSON object with string and unsigned integer values.
+static bool parse_json_line(manifest_line& out, const text_range& line)
+{
+    auto it = line.begin;
+    const auto end = line.end;
+
+    // The line is trimmed and begins with the brace.
+    ++it;
+    skip_space(it, end);
+
+    if (it != end && *it == '}')
+        return ++it == end;
+
+    while (true)
+    {
+        text_range key;
+        if (!parse_string(key, it, end))
+            return false;
+
+        const auto field = select_field(out, key);
+        if (field == nullptr || is_present(*field))
+            return false;
+
+        skip_space(it, end);
+        if (it == end || *it++ != ':')
+            return false;
+
+        skip_space(it, end);
+        if (it != end && *it == '"')
+        {
+            if (!parse_string(*field, it, end))
+                return false;
+        }
+        else
+        {
+            const auto begin = it;
+            while (it != end && *it >= '0' && *it <= '9')
+                ++it;
+
+            *field = { begin, it };
+        }
+
+        skip_space(it, end);
+        if (it == end)
+            return false;
+
+        if (*it == '}')
+            return ++it == end;
+
+        if (*it++ != ',')
+            return false;
+
+        skip_space(it, end);
+    }
+}
+
+static bool parse_csv_line(manifest_line& out, const text_range& line)
+{
+    static constexpr size_t maximum_fields = 4;
+    text_range fields[maximum_fields];
+    size_t count = 0;
+
+    for (auto begin = line.begin; count < maximum_fields; ++count)
+    {
+        const auto end = std::find(begin, line.end, ',');
+        fields[count] = trim({ begin, end });
+        if (end == line.end)
+        {
+            ++count;
+            break;
+        }
+
+        begin = end + 1;
+        if (count + 1 == maximum_fields)
+            return false;
+    }
+
+    if (equals(fields[0], "input") && (count == 3 || count == 4))
+    {
+        out.hash = fields[1];
+        out.index = fields[2];
+        if (count == 4)
+            out.sequence = fields[3];
+
+        return true;
+    }
+
+    if (equals(fields[0], "output") && count == 3)
+    {
+        out.target = fields[1];
+        out.amount = fields[2];
+        return true;
+    }
+
+    return false;
+}
+
+static bool append_input(transaction& tx, const manifest_line& line)
+{
+    hash_digest hash;
+    uint32_t index;
+    uint32_t sequence = max_input_sequence;
+
+    if (!is_present(line.index) || is_present(line.target) ||
+        is_present(line.amount) ||
+        !parse_hash(hash, line.hash) ||
+        !parse_number(index, line.index) ||
+        (is_present(line.sequence) && !parse_number(sequence, line.sequence)))
+        return false;
+
+    tx.inputs().emplace_back(output_point{ hash, index }, script{}, sequence);
+    return true;
+}
+
+static bool append_output(transaction& tx, const manifest_line& line,
+    uint8_t script_version)
+{
+    uint64_t amount;
+    if (!is_present(line.amount) || is_present(line.index) ||
+        is_present(line.sequence) || !parse_number(amount, line.amount) ||
+        amount > max_money())
+        return false;
+
+    const std::string target(line.target.begin, line.target.end);
+
+    // Is the target a payment address?
+    data_chunk decoded;
+    if (from_base58(decoded, target) && decoded.size() == 1 +
+        short_hash_size + checksum_size && verify_checksum(decoded))
+    {
+        short_hash hash;
+        std::copy_n(decoded.begin() + 1, short_hash_size, hash.begin());
+        const auto ops = decoded.front() == script_version ?
+            script::to_pay_script_hash_pattern(hash) :
+            script::to_pay_key_hash_pattern(hash);
+
+        tx.outputs().emplace_back(amount, script{ ops });
+        return true;
+    }
+
+    // The target must be a serialized script.
+    decoded.clear();
+    if (!append_base16_data(decoded, to_slice(line.target)))
+        return false;
+
+    tx.outputs().emplace_back(amount, script{ decoded, false });
+    return true;
+}
+
+bool read_tx_manifest(transaction& tx, size_t& invalid, data_slice manifest,
+    uint8_t script_version)
+{
+    const auto text = reinterpret_cast<const char*>(manifest.data());
+    const auto end = text + manifest.size();
+    const auto newlines = std::count(text, end, '\n');
+
+    // The lines are parsed first, so that the tx is reserved only once.
+    std::vector<manifest_line> lines;
+    std::vector<size_t> numbers;
+    lines.reserve(newlines + 1);
+    numbers.reserve(newlines + 1);
+    size_t inputs = 0;
+
+    size_t number = 0;
+    for (auto begin = text; begin != end;)
+    {
+        const auto line_end = std::find(begin, end, '\n');
+        const auto line = trim({ begin, line_end });
+        begin = line_end == end ? end : line_end + 1;
+        ++number;
+
+        if (line.begin == line.end || *line.begin == '#')
+            continue;
+
+        manifest_line parsed{};
+        const auto valid = *line.begin == '{' ?
+            parse_json_line(parsed, line) : parse_csv_line(parsed, line);
+
+        if (!valid || is_present(parsed.hash) == is_present(parsed.target))
+        {
+            invalid = number;
+            return false;
+        }
+
+        inputs += is_present(parsed.hash) ? 1 : 0;
+        lines.push_back(parsed);
+        numbers.push_back(number);
+    }
+
+    tx.inputs().reserve(tx.inputs().size() + inputs);
+    tx.outputs().reserve(tx.outputs().size() + lines.size() - inputs);
+
+    for (size_t index = 0; index < lines.size(); ++index)
+    {
+        const auto& line = lines[index];
+        const auto valid = is_present(line.hash) ? append_input(tx, line) :
+            append_output(tx, line, script_version);
+
+        if (!valid)
+        {
+            invalid = numbers[index];
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -0,0 +1,211 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/explorer/tx_size.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <boost/lexical_cast.hpp>
+#include <bitcoin/bitcoin.hpp>
+#include <bitcoin/explorer/define.hpp>
+#include <bitcoin/explorer/utility.hpp>
+#include <bitcoin/explorer/config/output.hpp>
+
+namespace libbitcoin {
+namespace explorer {
+
+// A maximal DER signature and the signature hash type.
+constexpr size_t endorsement_size = 72 + 1;
+constexpr size_t compressed_key_size = 33;
+constexpr size_t uncompressed_key_size = 65;
+
+// The scripts of pay-to-key-hash and pay-to-script-hash outputs.
+constexpr size_t pay_key_hash_size = 25;
+constexpr size_t pay_script_hash_size = 23;
+
+// The version, locktime and point and sequence of each input.
+constexpr size_t version_locktime_size = 2 * sizeof(uint32_t);
+constexpr size_t input_point_sequence_size = hash_size + 2 *
+    sizeof(uint32_t);
+
+// The witness marker and flag of a transaction with witnesses.
+constexpr size_t witness_marker_size = 2;
+constexpr size_t witness_scale = 4;
+
+static const std::string multisig_token = "p2sh-multisig";
+
+// The size of the smallest push of data of the size.
+static size_t push_size(size_t size)
+{
+    if (size < 76)
+        return 1 + size;
+
+    return (size <= max_uint8 ? 2 : 3) + size;
+}
+
+// The size of a witness of a signature and a compressed public key.
+static size_t key_witness_size()
+{
+    return variable_uint_size(2) +
+        variable_uint_size(endorsement_size) + endorsement_size +
+        variable_uint_size(compressed_key_size) + compressed_key_size;
+}
+
+// The sizes of the input script and of the witness of a signed input.
+static void signed_sizes(size_t& script, size_t& witness,
+    const input_script_type& type)
+{
+    witness = 0;
+    switch (type.script)
+    {
+        case input_script::pay_key_hash:
+            script = push_size(endorsement_size) +
+                push_size(compressed_key_size);
+            break;
+        case input_script::pay_key_hash_uncompressed:
+            script = push_size(endorsement_size) +
+                push_size(uncompressed_key_size);
+            break;
+        case input_script::pay_public_key:
+            script = push_size(endorsement_size);
+            break;
+        case input_script::pay_script_hash_multisig:
+        {
+            // The key count, keys, signature count and checkmultisig.
+            const auto redeem = 3 + type.keys *
+                push_size(compressed_key_size);
+
+            // The leading zero of checkmultisig, signatures and the script.
+            script = 1 + type.signatures * push_size(endorsement_size) +
+                push_size(redeem);
+            break;
+        }
+        case input_script::pay_witness_key_hash:
+            script = 0;
+            witness = key_witness_size();
+            break;
+        case input_script::pay_script_hash_witness_key_hash:
+            // The embedded script is a version zero push of the key hash.
+            script = push_size(2 + short_hash_size);
+            witness = key_witness_size();
+            break;
+    }
+}
+
+bool parse_input_script_type(input_script_type& out, const std::string& token)
+{
+    out.signatures = 1;
+    out.keys = 1;
+
+    if (token == "p2pkh")
+        out.script = input_script::pay_key_hash;
+    else if (token == "p2pkh-uncompressed")
+        out.script = input_script::pay_key_hash_uncompressed;
+    else if (token == "p2pk")
+        out.script = input_script::pay_public_key;
+    else if (token == "p2wpkh")
+        out.script = input_script::pay_witness_key_hash;
+    else if (token == "p2sh-p2wpkh")
+        out.script = input_script::pay_script_hash_witness_key_hash;
+    else
+    {
+        const auto tokens = split(token, BX_TX_POINT_DELIMITER);
+        if (tokens.size() != 3 || tokens[0] != multisig_token)
+            return false;
+
+        uint32_t signatures;
+        uint32_t keys;
+        try
+        {
+            deserialize(signatures, tokens[1], true);
+            deserialize(keys, tokens[2], true);
+        }
+        catch (const boost::bad_lexical_cast&)
+        {
+            return false;
+        }
+
+        // The counts must be representable as small integer opcodes.
+        if (signatures == 0 || signatures > keys || keys > 16)
+            return false;
+
+        out.script = input_script::pay_script_hash_multisig;
+        out.signatures = static_cast<uint8_t>(signatures);
+        out.keys = static_cast<uint8_t>(keys);
+    }
+
+    return true;
+}
+
+void append_script_sizes(std::vector<size_t>& out,
+    const config::output& output, uint8_t script_version)
+{
+    if (output.script().is_valid() ||
+        output.pay_to_hash() == null_short_hash)
+    {
+        out.push_back(output.script().serialized_size(false));
+        return;
+    }
+
+    // The null data script of a stealth output is a return and a push.
+    if (!output.ephemeral_data().empty())
+        out.push_back(1 + push_size(output.ephemeral_data().size()));
+
+    out.push_back(output.version() == script_version ? pay_script_hash_size :
+        pay_key_hash_size);
+}
+
+tx_size estimate_tx_size(const std::vector<input_script_type>& inputs,
+    const std::vector<size_t>& script_sizes)
+{
+    auto base = version_locktime_size + variable_uint_size(inputs.size()) +
+        variable_uint_size(script_sizes.size());
+
+    size_t witnesses = 0;
+    auto witnessed = false;
+
+    for (const auto& input: inputs)
+    {
+        size_t script;
+        size_t witness;
+        signed_sizes(script, witness, input);
+        base += input_point_sequence_size + variable_uint_size(script) +
+            script;
+
+        // An input without a witness has an empty witness, of one byte.
+        witnesses += witness == 0 ? 1 : witness;
+        witnessed |= witness != 0;
+    }
+
+    for (const auto size: script_sizes)
+        base += sizeof(uint64_t) + variable_uint_size(size) + size;
+
+    if (!witnessed)
+        return { base, base * witness_scale, base };
+
+    const auto size = base + witness_marker_size + witnesses;
+    const auto weight = base * witness_scale + (size - base);
+    const auto virtual_size = (weight + witness_scale - 1) / witness_scale;
+    return { size, weight, virtual_size };
+}
+
+} // namespace explorer
+} // namespace libbitcoin
@@ -20,8 +20,12 @@
 #include <bitcoin/explorer/utility.hpp>
 
 #include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <random>
 #include <cstdint>
 #include <mutex>
@@ -41,14 +45,239 @@
 #include <boost/property_tree/xml_parser.hpp>
 #include <bitcoin/client.hpp>
 #include <bitcoin/explorer/command.hpp>
+#include <bitcoin/explorer/config/transaction.hpp>
 #include <bitcoin/explorer/define.hpp>
 
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
 using namespace bc::client;
 using boost::filesystem::path;
 
 namespace libbitcoin {
 namespace explorer {
 
+// The suffix of a hardened index in an HD derivation path.
+constexpr char hardened_marker = '\'';
+
+static const char base16_digits[] = "0123456789abcdef";
+
+// The value of each Base16 character, or 0xff if it is not one.
+static std::array<uint8_t, 256> make_base16_values()
+{
+    std::array<uint8_t, 256> values;
+    values.fill(0xff);
+
+    for (uint8_t digit = 0; digit < 10; ++digit)
+        values['0' + digit] = digit;
+
+    for (uint8_t digit = 0; digit < 6; ++digit)
+    {
+        values['a' + digit] = 10 + digit;
+        values['A' + digit] = 10 + digit;
+    }
+
+    return values;
+}
+
+static const auto base16_values = make_base16_values();
+
+bool decode_base16_into(uint8_t* out, size_t size, data_slice text)
+{
+    if (text.size() != 2 * size)
+        return false;
+
+    auto character = text.begin();
+    for (size_t index = 0; index < size; ++index, character += 2)
+    {
+        const auto high = base16_values[character[0]];
+        const auto low = base16_values[character[1]];
+
+        if (high == 0xff || low == 0xff)
+            return false;
+
+        out[index] = static_cast<uint8_t>((high << 4) | low);
+    }
+
+    return true;
+}
+
+bool append_base16_data(data_chunk& out, data_slice text)
+{
+    if (text.size() % 2 != 0)
+        return false;
+
+    const auto start = out.size();
+    out.resize(start + text.size() / 2);
+
+    if (!decode_base16_into(out.data() + start, text.size() / 2, text))
+    {
+        out.resize(start);
+        return false;
+    }
+
+    return true;
+}
+
+void append_base16_text(std::string& out, data_slice data)
+{
+    const auto start = out.size();
+    out.resize(start + 2 * data.size());
+    auto character = out.begin() + start;
+
+    for (const auto byte: data)
+    {
+        *character++ = base16_digits[byte >> 4];
+        *character++ = base16_digits[byte & 0x0f];
+    }
+}
+
+static bool is_space(uint8_t character)
+{
+    return std::isspace(character) != 0;
+}
+
+data_slice trim_slice(data_slice text)
+{
+    const auto first = std::find_if_not(text.begin(), text.end(), is_space);
+    auto last = text.end();
+    while (last != first && is_space(last[-1]))
+        --last;
+
+    return data_slice(first, last);
+}
+
+void split_lines(std::vector<data_slice>& out, std::vector<size_t>& lines,
+    data_slice text, bool trim)
+{
+    out.clear();
+    lines.clear();
+
+    size_t line = 0;
+    for (auto start = text.begin(); start != text.end(); ++line)
+    {
+        const auto begin = start;
+        const auto end = std::find(begin, text.end(), '\n');
+        const auto trimmed = trim_slice(data_slice(begin, end));
+        start = end == text.end() ? end : end + 1;
+
+        // Blank lines are skipped, not reported.
+        if (trimmed.empty())
+            continue;
+
+        if (trim)
+            out.push_back(trimmed);
+        else
+            out.emplace_back(begin, end[-1] == '\r' ? end - 1 : end);
+
+        lines.push_back(line + 1);
+    }
+}
+
+bool decode_base16_lines(data_stack& out, size_t& line,
+    const data_chunk& text)
+{
+    out.clear();
+    line = 0;
+
+    std::vector<data_slice> rows;
+    std::vector<size_t> lines;
+    split_lines(rows, lines, text);
+    out.reserve(rows.size());
+
+    for (size_t index = 0; index < rows.size(); ++index)
+    {
+        data_chunk data;
+        if (!append_base16_data(data, rows[index]))
+        {
+            line = lines[index];
+            return false;
+        }
+
+        out.push_back(std::move(data));
+    }
+
+    return true;
+}
+
+void load_input(config::transaction& parameter, const std::string& name,
+    po::variables_map& variables, std::istream& input, bool raw)
+{
+    if (variables.find(name) != variables.end())
+        return;
+
+    if (variables.find(BX_BINARY_VARIABLE) == variables.end())
+    {
+        deserialize(parameter, input, !raw);
+        return;
+    }
+
+    if (!parameter.from_binary(input))
+    {
+        BOOST_THROW_EXCEPTION(po::invalid_option_value(name));
+    }
+}
+
+bool parse_hd_path(std::vector<uint32_t>& out, const std::string& path)
+{
+    out.clear();
+    if (path.empty() || path == "m")
+        return true;
+
+    std::vector<std::string> tokens;
+    boost::split(tokens, path, boost::is_any_of("/"));
+    const size_t first = tokens.front() == "m" ? 1 : 0;
+
+    for (auto token = tokens.begin() + first; token != tokens.end(); ++token)
+    {
+        auto digits = *token;
+        const auto hard = !digits.empty() && digits.back() == hardened_marker;
+        if (hard)
+            digits.pop_back();
+
+        if (digits.empty() ||
+            digits.find_first_not_of("0123456789") != std::string::npos)
+            return false;
+
+        uint64_t index = 0;
+        for (const auto digit: digits)
+        {
+            index = index * 10 + (digit - '0');
+            if (index >= wallet::hd_first_hardened_key)
+                return false;
+        }
+
+        const auto position = static_cast<uint32_t>(index);
+        out.push_back(hard ? wallet::hd_first_hardened_key + position :
+            position);
+    }
+
+    return true;
+}
+
+std::string encode_hd_path(const std::vector<uint32_t>& path)
+{
+    std::string out("m");
+    for (const auto position: path)
+    {
+        const auto hard = position >= wallet::hd_first_hardened_key;
+        const auto index = hard ? position - wallet::hd_first_hardened_key :
+            position;
+
+        out += "/" + std::to_string(index);
+        if (hard)
+            out += hardened_marker;
+    }
+
+    return out;
+}
+
 connection_type get_connection(const command& command)
 {
     const auto public_key = command.get_server_server_public_key_setting();
@@ -98,6 +327,69 @@ void random_fill(data_chunk& chunk)
     pseudo_random_fill(chunk);
 }
 
+#ifdef __linux__
+// The kernel estimate of memory available without swapping, which unlike
+// free pages includes reclaimable cache, or zero if not reported.
+static uint64_t meminfo_available()
+{
+    std::ifstream meminfo("/proc/meminfo");
+    std::string name;
+    uint64_t kilobytes;
+
+    while (meminfo >> name >> kilobytes)
+    {
+        if (name == "MemAvailable:")
+            return kilobytes * 1024;
+
+        meminfo.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    }
+
+    return 0;
+}
+#endif
+
+// The physical memory currently available, or zero if not determinable.
+static uint64_t available_memory()
+{
+#if defined(_WIN32)
+    MEMORYSTATUSEX status;
+    status.dwLength = sizeof(status);
+    return GlobalMemoryStatusEx(&status) ? status.ullAvailPhys : 0;
+#elif defined(_SC_AVPHYS_PAGES)
+#ifdef __linux__
+    const auto available = meminfo_available();
+    if (available != 0)
+        return available;
+#endif
+
+    const auto pages = sysconf(_SC_AVPHYS_PAGES);
+    const auto page_size = sysconf(_SC_PAGESIZE);
+    if (pages <= 0 || page_size <= 0)
+        return 0;
+
+    return static_cast<uint64_t>(pages) * static_cast<uint64_t>(page_size);
+#else
+    return 0;
+#endif
+}
+
+// Leave half of the available memory to the rest of the system.
+size_t memory_bounded_threads(size_t threads, uint64_t memory)
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+
+    const auto available = available_memory();
+    if (available != 0 && memory != 0)
+    {
+        const auto affordable = available / 2 / memory;
+        if (affordable < threads)
+            threads = static_cast<size_t>(affordable);
+    }
+
+    return std::max(threads, size_t(1));
+}
+
 // TODO: switch to binary for raw (primitive) reads in windows.
 std::string read_stream(std::istream& stream)
 {
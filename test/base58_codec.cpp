@@ -0,0 +1,184 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+#include "benchmark.hpp"
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Values of each length, including leading zero bytes, from a hash chain.
+static data_stack make_values(size_t count, size_t size)
+{
+    data_stack values;
+    auto hash = sha256_hash(to_little_endian<uint64_t>(size));
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        data_chunk value;
+        while (value.size() < size)
+        {
+            hash = sha256_hash(hash);
+            extend_data(value, hash);
+        }
+
+        value.resize(size);
+        const auto zeros = std::min<size_t>(index % 4, size);
+        std::fill(value.begin(), value.begin() + zeros, 0);
+        values.push_back(value);
+    }
+
+    return values;
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(base58_codec__to_base58)
+
+BOOST_AUTO_TEST_CASE(base58_codec__to_base58__empty__empty)
+{
+    BOOST_REQUIRE(to_base58(data_chunk{}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(base58_codec__to_base58__zeros__ones)
+{
+    BOOST_REQUIRE_EQUAL(to_base58(data_chunk(3, 0)), "111");
+}
+
+BOOST_AUTO_TEST_CASE(base58_codec__to_base58__address__expected)
+{
+    data_chunk address;
+    BOOST_REQUIRE(decode_base16(address, "00b472a266d0bd89c13706a4132ccfb16f7c3b9fcb52ec0a8a"));
+    BOOST_REQUIRE_EQUAL(to_base58(address), "1HT7xU2Ngenf7D4yocz2SAcnNLW7rK8d4E");
+}
+
+BOOST_AUTO_TEST_CASE(base58_codec__to_base58__all_sizes__matches_encode_base58)
+{
+    // Include the sizes above the fixed buffers.
+    for (size_t size = 0; size < 200; ++size)
+        for (const auto& value: make_values(8, size))
+            BOOST_REQUIRE_EQUAL(to_base58(value), encode_base58(value));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(base58_codec__from_base58)
+
+BOOST_AUTO_TEST_CASE(base58_codec__from_base58__empty__true_empty)
+{
+    data_chunk out;
+    BOOST_REQUIRE(from_base58(out, ""));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(base58_codec__from_base58__invalid_character__false)
+{
+    data_chunk out;
+    BOOST_REQUIRE(!from_base58(out, "1HT7xU2Ngenf7D4yocz2SAcnNLW7rK8d40"));
+    BOOST_REQUIRE(!from_base58(out, "1HT7xU2Ngenf7D4yocz2SAcnNLW7rK8d4l"));
+    BOOST_REQUIRE(!from_base58(out, "1HT7xU2Ngenf7D4yocz2SAcnNLW7rK8d4 "));
+}
+
+BOOST_AUTO_TEST_CASE(base58_codec__from_base58__all_sizes__round_trips)
+{
+    for (size_t size = 0; size < 200; ++size)
+    {
+        for (const auto& value: make_values(8, size))
+        {
+            data_chunk out;
+            BOOST_REQUIRE(from_base58(out, encode_base58(value)));
+            BOOST_REQUIRE(out == value);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(base58_codec__batch)
+
+BOOST_AUTO_TEST_CASE(base58_codec__batch__extended_keys__round_trips)
+{
+    const auto values = make_values(100, wallet::hd_key_size);
+    const auto encoded = to_base58_batch(values, 0);
+    BOOST_REQUIRE_EQUAL(encoded.size(), values.size());
+
+    size_t invalid;
+    data_stack decoded;
+    BOOST_REQUIRE(from_base58_batch(decoded, invalid, encoded, 0));
+    BOOST_REQUIRE(decoded == values);
+
+    for (size_t index = 0; index < values.size(); ++index)
+        BOOST_REQUIRE_EQUAL(encoded[index], encode_base58(values[index]));
+}
+
+BOOST_AUTO_TEST_CASE(base58_codec__batch__invalid__false_first_index)
+{
+    size_t invalid;
+    data_stack decoded;
+    const std::vector<std::string> texts{ "11", "1I", "abc", "0" };
+    BOOST_REQUIRE(!from_base58_batch(decoded, invalid, texts, 0));
+    BOOST_REQUIRE_EQUAL(invalid, 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+// The benchmark suite compares the rate of address encoding and decoding of
+// libbitcoin and of the codec on a single thread.
+BOOST_AUTO_TEST_SUITE(benchmark)
+BOOST_AUTO_TEST_SUITE(base58_codec__benchmark)
+
+BOOST_AUTO_TEST_CASE(base58_codec__benchmark__addresses__per_second)
+{
+    const auto values = make_values(100000, 25);
+    const auto count = values.size();
+
+    std::vector<std::string> expected(count);
+    const auto library_start = benchmark_clock::now();
+    for (size_t index = 0; index < count; ++index)
+        expected[index] = encode_base58(values[index]);
+
+    const auto library_time = seconds_since(library_start);
+
+    const auto encode_start = benchmark_clock::now();
+    const auto encoded = to_base58_batch(values);
+    const auto encode_time = seconds_since(encode_start);
+
+    size_t invalid;
+    data_stack decoded;
+    const auto decode_start = benchmark_clock::now();
+    BOOST_REQUIRE(from_base58_batch(decoded, invalid, encoded));
+    const auto decode_time = seconds_since(decode_start);
+
+    BOOST_REQUIRE(encoded == expected);
+    BOOST_REQUIRE(decoded == values);
+
+    BOOST_TEST_MESSAGE("library: " << count / library_time <<
+        " encodes/s codec: " << count / encode_time << " encodes/s " <<
+        count / decode_time << " decodes/s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,44 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <chrono>
+
+// Benchmark suites are nested in the benchmark suite, which is not part of
+// the default test run, use --run_test=benchmark to execute.
+
+typedef std::chrono::steady_clock benchmark_clock;
+
+// The time elapsed since the start, in seconds.
+inline double seconds_since(const benchmark_clock::time_point& start)
+{
+    const auto elapsed = benchmark_clock::now() - start;
+    return std::chrono::duration<double>(elapsed).count();
+}
+
+// The time elapsed since the start, in microseconds.
+inline double microseconds_since(const benchmark_clock::time_point& start)
+{
+    const auto elapsed = benchmark_clock::now() - start;
+    return std::chrono::duration<double, std::micro>(elapsed).count();
+}
+
+#endif
@@ -0,0 +1,148 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// The block of the block-decode tests.
+#define BLOCK_FILE_BLOCK_BASE16 \
+"010000006fe28c0ab6f1b372c1a6a246ae63f74f931e8365e15a089c68d6190000000000121eb81089faac7652fe7891159d8705f25149081a6142018e18430193315fa929ab5f49ffff001d2a000000020100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac000000000100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000006a473044022039a36013301597daef41fbe593a02cc513d0b55527ec2df1050e2e8ff49c85c202201035fe810e283bcf394485c6a9dfd117ad9f684cdd83d36453718f5d0491b9dd012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+
+// Append a record of the magic, the size and the block to a block file.
+static void append_record(data_chunk& file, const data_chunk& block,
+    uint32_t magic=mainnet_block_file_magic)
+{
+    extend_data(file, to_little_endian(magic));
+    extend_data(file, to_little_endian(static_cast<uint32_t>(block.size())));
+    extend_data(file, block);
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(block_file__read_block_records)
+
+BOOST_AUTO_TEST_CASE(block_file__read_block_records__empty__true_empty)
+{
+    std::vector<data_slice> records;
+    BOOST_REQUIRE(read_block_records(records, data_chunk{}, mainnet_block_file_magic));
+    BOOST_REQUIRE(records.empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__read_block_records__padded__true_expected)
+{
+    data_chunk file;
+    append_record(file, { 0x01, 0x02, 0x03 });
+    append_record(file, {});
+    file.resize(file.size() + 100, 0x00);
+    append_record(file, { 0x04 });
+    file.resize(file.size() + 100, 0x00);
+
+    std::vector<data_slice> records;
+    BOOST_REQUIRE(read_block_records(records, file, mainnet_block_file_magic));
+    BOOST_REQUIRE_EQUAL(records.size(), 3u);
+    BOOST_REQUIRE(to_chunk(records[0]) == data_chunk({ 0x01, 0x02, 0x03 }));
+    BOOST_REQUIRE(records[1].empty());
+    BOOST_REQUIRE(to_chunk(records[2]) == data_chunk({ 0x04 }));
+}
+
+BOOST_AUTO_TEST_CASE(block_file__read_block_records__other_magic__true_empty)
+{
+    data_chunk file;
+    append_record(file, { 0x01, 0x02, 0x03 }, 0x0709110b);
+
+    std::vector<data_slice> records;
+    BOOST_REQUIRE(read_block_records(records, file, mainnet_block_file_magic));
+    BOOST_REQUIRE(records.empty());
+}
+
+BOOST_AUTO_TEST_CASE(block_file__read_block_records__truncated_block__false_preceding)
+{
+    data_chunk file;
+    append_record(file, { 0x01, 0x02, 0x03 });
+    append_record(file, { 0x04, 0x05 });
+    file.pop_back();
+
+    std::vector<data_slice> records;
+    BOOST_REQUIRE(!read_block_records(records, file, mainnet_block_file_magic));
+    BOOST_REQUIRE_EQUAL(records.size(), 1u);
+    BOOST_REQUIRE(to_chunk(records[0]) == data_chunk({ 0x01, 0x02, 0x03 }));
+}
+
+BOOST_AUTO_TEST_CASE(block_file__read_block_records__truncated_size__false_preceding)
+{
+    data_chunk file;
+    append_record(file, { 0x01, 0x02, 0x03 });
+    extend_data(file, to_little_endian(mainnet_block_file_magic));
+    file.push_back(0x01);
+
+    std::vector<data_slice> records;
+    BOOST_REQUIRE(!read_block_records(records, file, mainnet_block_file_magic));
+    BOOST_REQUIRE_EQUAL(records.size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(block_file__parse_block_record)
+
+BOOST_AUTO_TEST_CASE(block_file__parse_block_record__block__true_expected)
+{
+    data_chunk block;
+    BOOST_REQUIRE(decode_base16(block, BLOCK_FILE_BLOCK_BASE16));
+
+    data_chunk file;
+    append_record(file, block);
+
+    std::vector<data_slice> records;
+    BOOST_REQUIRE(read_block_records(records, file, mainnet_block_file_magic));
+    BOOST_REQUIRE_EQUAL(records.size(), 1u);
+
+    chain::block parsed;
+    BOOST_REQUIRE(parse_block_record(parsed, records[0]));
+    BOOST_REQUIRE_EQUAL(parsed.transactions().size(), 2u);
+    BOOST_REQUIRE_EQUAL(encode_hash(parsed.header().hash()), "6e3db72307ae412019ab480df14ed3f66bc2bd03dcd43a4822fdbd283618bda1");
+}
+
+BOOST_AUTO_TEST_CASE(block_file__parse_block_record__trailing_bytes__false)
+{
+    data_chunk block;
+    BOOST_REQUIRE(decode_base16(block, BLOCK_FILE_BLOCK_BASE16));
+    block.push_back(0x00);
+
+    chain::block parsed;
+    BOOST_REQUIRE(!parse_block_record(parsed, block));
+}
+
+BOOST_AUTO_TEST_CASE(block_file__parse_block_record__truncated__false)
+{
+    data_chunk block;
+    BOOST_REQUIRE(decode_base16(block, BLOCK_FILE_BLOCK_BASE16));
+    block.pop_back();
+
+    chain::block parsed;
+    BOOST_REQUIRE(!parse_block_record(parsed, block));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,82 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(address_decode_batch__invoke)
+
+#define ADDRESS_DECODE_BATCH_ADDRESSES \
+"1EKJFK8kBmasFRYY3Ay9QjpJLm4vemJtC1\n" \
+"\n" \
+"  197FLrycah42jKDgfmTaok7b8kNHA7R2ih\n" \
+"mtqFYNDizo282Y29kjwXEf2dCkfdZZydbf\r\n" \
+"3J98t1WpEZ73CNmQviecrnyiWrnqRhWNLy\n"
+
+#define ADDRESS_DECODE_BATCH_PAYLOADS \
+"0 920f84f611783d6bce850c43ecfa415c47fd44b9\n" \
+"0 58ef79796a72897e254008cc66b8117a7ef76059\n" \
+"111 920f84f611783d6bce850c43ecfa415c47fd44b9\n" \
+"5 b472a266d0bd89c13706a4132ccfb16f7c3b9fcb\n"
+
+BOOST_AUTO_TEST_CASE(address_decode_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(address_decode_batch);
+    command.set_payment_addresses_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(address_decode_batch__invoke__addresses__okay_output)
+{
+    BX_DECLARE_COMMAND(address_decode_batch);
+    command.set_payment_addresses_argument({ ADDRESS_DECODE_BATCH_ADDRESSES });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(ADDRESS_DECODE_BATCH_PAYLOADS);
+}
+
+BOOST_AUTO_TEST_CASE(address_decode_batch__invoke__invalid_character__failure_error)
+{
+    BX_DECLARE_COMMAND(address_decode_batch);
+    command.set_payment_addresses_argument({ "1EKJFK8kBmasFRYY3Ay9QjpJLm4vemJtC1\n\n197FLrycah42jKDgfmTaok7b8kNHA7R2i0\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The address on line 3 is not a valid payment address.\n");
+}
+
+BOOST_AUTO_TEST_CASE(address_decode_batch__invoke__invalid_length__failure_error)
+{
+    BX_DECLARE_COMMAND(address_decode_batch);
+    command.set_payment_addresses_argument({ "1EKJFK8kBmasFRYY3Ay9QjpJLm4vemJtC1\n1111\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The address on line 2 is not a valid payment address.\n");
+}
+
+BOOST_AUTO_TEST_CASE(address_decode_batch__invoke__invalid_checksum__failure_error)
+{
+    BX_DECLARE_COMMAND(address_decode_batch);
+    command.set_payment_addresses_argument({ "1EKJFK8kBmasFRYY3Ay9QjpJLm4vemJtC2\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The address on line 1 is not a valid payment address.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(block_decode__invoke)
+
+// A block of the two transactions of the tx-decode tests.
+#define BLOCK_DECODE_BLOCK_BASE16 \
+"010000006fe28c0ab6f1b372c1a6a246ae63f74f931e8365e15a089c68d6190000000000121eb81089faac7652fe7891159d8705f25149081a6142018e18430193315fa929ab5f49ffff001d2a000000020100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac000000000100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000006a473044022039a36013301597daef41fbe593a02cc513d0b55527ec2df1050e2e8ff49c85c202201035fe810e283bcf394485c6a9dfd117ad9f684cdd83d36453718f5d0491b9dd012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+
+#define BLOCK_DECODE_BLOCK_INFO \
+"block\n" \
+"{\n" \
+"    header\n" \
+"    {\n" \
+"        bits 486604799\n" \
+"        hash 6e3db72307ae412019ab480df14ed3f66bc2bd03dcd43a4822fdbd283618bda1\n" \
+"        merkle_tree_hash a95f31930143188e0142611a084951f205879d159178fe5276acfa8910b81e12\n" \
+"        nonce 42\n" \
+"        previous_block_hash 000000000019d6689c085ae165831e934ff763ae46a2a6c172b3f1b60a8ce26f\n" \
+"        time_stamp 1231006505\n" \
+"        version 1\n" \
+"    }\n" \
+"    transactions\n" \
+"    {\n" \
+"        transaction\n" \
+"        {\n" \
+"            hash 39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" \
+"            inputs\n" \
+"            {\n" \
+"                input\n" \
+"                {\n" \
+"                    previous_output\n" \
+"                    {\n" \
+"                        hash 97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3\n" \
+"                        index 1\n" \
+"                    }\n" \
+"                    script \"\"\n" \
+"                    sequence 4294967295\n" \
+"                }\n" \
+"            }\n" \
+"            lock_time 0\n" \
+"            outputs\n" \
+"            {\n" \
+"                output\n" \
+"                {\n" \
+"                    address 13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe\n" \
+"                    script \"dup hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equalverify checksig\"\n" \
+"                    value 90000\n" \
+"                }\n" \
+"            }\n" \
+"            version 1\n" \
+"        }\n" \
+"        transaction\n" \
+"        {\n" \
+"            hash c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b\n" \
+"            inputs\n" \
+"            {\n" \
+"                input\n" \
+"                {\n" \
+"                    address 1DRCR5Gvg18FNo8HUPH1u5bfd9b5XfnJDj\n" \
+"                    previous_output\n" \
+"                    {\n" \
+"                        hash 97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3\n" \
+"                        index 1\n" \
+"                    }\n" \
+"                    script \"[3044022039a36013301597daef41fbe593a02cc513d0b55527ec2df1050e2e8ff49c85c202201035fe810e283bcf394485c6a9dfd117ad9f684cdd83d36453718f5d0491b9dd01] [03c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0]\"\n" \
+"                    sequence 4294967295\n" \
+"                }\n" \
+"            }\n" \
+"            lock_time 0\n" \
+"            outputs\n" \
+"            {\n" \
+"                output\n" \
+"                {\n" \
+"                    address 13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe\n" \
+"                    script \"dup hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equalverify checksig\"\n" \
+"                    value 90000\n" \
+"                }\n" \
+"            }\n" \
+"            version 1\n" \
+"        }\n" \
+"    }\n" \
+"}\n"
+
+BOOST_AUTO_TEST_CASE(block_decode__invoke__base16_info__okay_output)
+{
+    BX_DECLARE_COMMAND(block_decode);
+    command.set_format_option({ encoding_engine::info });
+    command.set_block_argument({ BLOCK_DECODE_BLOCK_BASE16 "\n" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BLOCK_DECODE_BLOCK_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(block_decode__invoke__binary_concurrent_info__okay_output)
+{
+    data_chunk block;
+    BOOST_REQUIRE(decode_base16(block, BLOCK_DECODE_BLOCK_BASE16));
+
+    BX_DECLARE_COMMAND(block_decode);
+    command.set_binary_option(true);
+    command.set_threads_option(0);
+    command.set_format_option({ encoding_engine::info });
+    command.set_block_argument({ block });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(BLOCK_DECODE_BLOCK_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(block_decode__invoke__truncated__failure_error)
+{
+    const std::string hexcode(BLOCK_DECODE_BLOCK_BASE16);
+
+    BX_DECLARE_COMMAND(block_decode);
+    command.set_block_argument({ hexcode.substr(0, hexcode.size() - 2) });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_BLOCK_DECODE_INVALID_BLOCK "\n");
+}
+
+BOOST_AUTO_TEST_CASE(block_decode__invoke__binary_base16__failure_error)
+{
+    BX_DECLARE_COMMAND(block_decode);
+    command.set_binary_option(true);
+    command.set_block_argument({ BLOCK_DECODE_BLOCK_BASE16 });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_BLOCK_DECODE_INVALID_BLOCK "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
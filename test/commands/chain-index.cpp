@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+#include <string>
+#include <boost/filesystem.hpp>
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(chain_index__invoke)
+
+// A temporary path that is removed when the test completes.
+class temporary_path_fixture
+{
+public:
+    temporary_path_fixture(const data_chunk& contents={})
+      : path_(boost::filesystem::temp_directory_path() /
+            boost::filesystem::unique_path("bx-chain-index-%%%%-%%%%"))
+    {
+        if (contents.empty())
+            return;
+
+        std::ofstream file(path_.string(), std::ios::binary);
+        file.write(reinterpret_cast<const char*>(contents.data()),
+            contents.size());
+    }
+
+    ~temporary_path_fixture()
+    {
+        boost::system::error_code ignored;
+        boost::filesystem::remove_all(path_, ignored);
+    }
+
+    std::string path() const
+    {
+        return path_.string();
+    }
+
+private:
+    boost::filesystem::path path_;
+};
+
+// A genesis block with a single output to a key hash of the seed.
+static data_chunk make_genesis(uint8_t seed)
+{
+    auto hash = null_short_hash;
+    hash[0] = seed;
+    const chain::input coinbase{ chain::output_point{ null_hash, max_uint32 },
+        chain::script{}, max_uint32 };
+    const chain::output out{ 50, chain::script{
+        chain::script::to_pay_key_hash_pattern(hash) } };
+    const chain::transaction tx{ 1, 0, { coinbase }, { out } };
+    const chain::header header{ 1, null_hash, null_hash, 0, 0, 0 };
+    return chain::block{ header, { tx } }.to_data();
+}
+
+static void append_record(data_chunk& file, const data_chunk& block)
+{
+    extend_data(file, to_little_endian(mainnet_block_file_magic));
+    extend_data(file, to_little_endian(static_cast<uint32_t>(block.size())));
+    extend_data(file, block);
+}
+
+static data_chunk make_block_file()
+{
+    data_chunk file;
+    append_record(file, make_genesis(1));
+    file.resize(file.size() + 64, 0x00);
+    return file;
+}
+
+BOOST_AUTO_TEST_CASE(chain_index__invoke__genesis__okay_output)
+{
+    const temporary_path_fixture file(make_block_file());
+    const temporary_path_fixture index;
+    BX_DECLARE_COMMAND(chain_index);
+    command.set_index_option(index.path());
+    command.set_files_argument({ file.path() });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("Indexed 1 blocks, the index has 1 blocks.\n");
+}
+
+BOOST_AUTO_TEST_CASE(chain_index__invoke__indexed_again__okay_output)
+{
+    const temporary_path_fixture file(make_block_file());
+    const temporary_path_fixture index;
+    BX_DECLARE_COMMAND(chain_index);
+    command.set_threads_option(2);
+    command.set_index_option(index.path());
+    command.set_files_argument({ file.path(), file.path() });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    output.str("");
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("Indexed 0 blocks, the index has 1 blocks.\n");
+}
+
+BOOST_AUTO_TEST_CASE(chain_index__invoke__missing_file__failure_error)
+{
+    const temporary_path_fixture file;
+    const temporary_path_fixture index;
+    BX_DECLARE_COMMAND(chain_index);
+    command.set_index_option(index.path());
+    command.set_files_argument({ file.path() });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The block file " + file.path() + " cannot be read.\n");
+}
+
+BOOST_AUTO_TEST_CASE(chain_index__invoke__truncated__failure_error)
+{
+    auto contents = make_block_file();
+    contents.resize(contents.size() - 65);
+    const temporary_path_fixture file(contents);
+    const temporary_path_fixture index;
+    BX_DECLARE_COMMAND(chain_index);
+    command.set_index_option(index.path());
+    command.set_files_argument({ file.path() });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The last block of the file " + file.path() +
+        " is truncated.\n");
+}
+
+BOOST_AUTO_TEST_CASE(chain_index__invoke__invalid_block__failure_error)
+{
+    const auto genesis = make_genesis(1);
+    data_chunk contents;
+    append_record(contents, genesis);
+    append_record(contents, data_chunk(10, 0x00));
+    const temporary_path_fixture file(contents);
+    const temporary_path_fixture index;
+    BX_DECLARE_COMMAND(chain_index);
+    command.set_index_option(index.path());
+    command.set_files_argument({ file.path() });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The block at offset " +
+        std::to_string(genesis.size() + 8) + " of the file " + file.path() +
+        " is not valid.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,188 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+#include <string>
+#include <boost/filesystem.hpp>
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(chain_scan__invoke)
+
+// The block of the block-decode tests.
+#define CHAIN_SCAN_BLOCK_BASE16 \
+"010000006fe28c0ab6f1b372c1a6a246ae63f74f931e8365e15a089c68d6190000000000121eb81089faac7652fe7891159d8705f25149081a6142018e18430193315fa929ab5f49ffff001d2a000000020100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac000000000100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000006a473044022039a36013301597daef41fbe593a02cc513d0b55527ec2df1050e2e8ff49c85c202201035fe810e283bcf394485c6a9dfd117ad9f684cdd83d36453718f5d0491b9dd012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+
+#define CHAIN_SCAN_OUTPUT_ADDRESS "13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe"
+#define CHAIN_SCAN_INPUT_ADDRESS "1DRCR5Gvg18FNo8HUPH1u5bfd9b5XfnJDj"
+
+#define CHAIN_SCAN_OUTPUTS \
+"output 6e3db72307ae412019ab480df14ed3f66bc2bd03dcd43a4822fdbd283618bda1 39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0:0 90000 13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe\n" \
+"output 6e3db72307ae412019ab480df14ed3f66bc2bd03dcd43a4822fdbd283618bda1 c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b:0 90000 13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe\n"
+
+#define CHAIN_SCAN_INPUTS \
+"input 6e3db72307ae412019ab480df14ed3f66bc2bd03dcd43a4822fdbd283618bda1 c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b:0 97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3:1 1DRCR5Gvg18FNo8HUPH1u5bfd9b5XfnJDj\n"
+
+// A temporary block file that is removed when the test completes.
+class block_file_fixture
+{
+public:
+    block_file_fixture(const data_chunk& contents)
+      : path_(boost::filesystem::temp_directory_path() /
+            boost::filesystem::unique_path("bx-chain-scan-%%%%-%%%%.dat"))
+    {
+        std::ofstream file(path_.string(), std::ios::binary);
+        file.write(reinterpret_cast<const char*>(contents.data()),
+            contents.size());
+    }
+
+    ~block_file_fixture()
+    {
+        boost::system::error_code ignored;
+        boost::filesystem::remove(path_, ignored);
+    }
+
+    std::string path() const
+    {
+        return path_.string();
+    }
+
+private:
+    boost::filesystem::path path_;
+};
+
+// A block file of the block, padded with zeros as when preallocated.
+static data_chunk make_block_file(size_t records=1)
+{
+    data_chunk block;
+    decode_base16(block, CHAIN_SCAN_BLOCK_BASE16);
+
+    data_chunk file;
+    for (size_t record = 0; record < records; ++record)
+    {
+        extend_data(file, to_little_endian(mainnet_block_file_magic));
+        extend_data(file, to_little_endian(static_cast<uint32_t>(block.size())));
+        extend_data(file, block);
+    }
+
+    file.resize(file.size() + 64, 0x00);
+    return file;
+}
+
+BOOST_AUTO_TEST_CASE(chain_scan__invoke__no_targets__failure_error)
+{
+    const block_file_fixture file(make_block_file());
+    BX_DECLARE_COMMAND(chain_scan);
+    command.set_files_argument({ file.path() });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("At least one address or script is required.\n");
+}
+
+BOOST_AUTO_TEST_CASE(chain_scan__invoke__output_address__okay_output)
+{
+    const block_file_fixture file(make_block_file());
+    BX_DECLARE_COMMAND(chain_scan);
+    command.set_addresses_option({ { CHAIN_SCAN_OUTPUT_ADDRESS } });
+    command.set_files_argument({ file.path() });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(CHAIN_SCAN_OUTPUTS);
+}
+
+BOOST_AUTO_TEST_CASE(chain_scan__invoke__input_address__okay_output)
+{
+    const block_file_fixture file(make_block_file());
+    BX_DECLARE_COMMAND(chain_scan);
+    command.set_addresses_option({ { CHAIN_SCAN_INPUT_ADDRESS } });
+    command.set_files_argument({ file.path() });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(CHAIN_SCAN_INPUTS);
+}
+
+BOOST_AUTO_TEST_CASE(chain_scan__invoke__script__okay_output)
+{
+    const block_file_fixture file(make_block_file());
+    BX_DECLARE_COMMAND(chain_scan);
+    command.set_scripts_option({ { "dup hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equalverify checksig" } });
+    command.set_files_argument({ file.path() });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "output 6e3db72307ae412019ab480df14ed3f66bc2bd03dcd43a4822fdbd283618bda1 39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0:0 90000 76a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac\n"
+        "output 6e3db72307ae412019ab480df14ed3f66bc2bd03dcd43a4822fdbd283618bda1 c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b:0 90000 76a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac\n");
+}
+
+BOOST_AUTO_TEST_CASE(chain_scan__invoke__many_blocks_and_files__okay_ordered_output)
+{
+    const block_file_fixture first(make_block_file(3));
+    const block_file_fixture second(make_block_file(2));
+    BX_DECLARE_COMMAND(chain_scan);
+    command.set_threads_option(4);
+    command.set_addresses_option({ { CHAIN_SCAN_OUTPUT_ADDRESS }, { CHAIN_SCAN_INPUT_ADDRESS } });
+    command.set_files_argument({ first.path(), second.path() });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+
+    std::string expected;
+    for (size_t block = 0; block < 5; ++block)
+        expected += CHAIN_SCAN_OUTPUTS CHAIN_SCAN_INPUTS;
+
+    BX_REQUIRE_OUTPUT(expected);
+}
+
+BOOST_AUTO_TEST_CASE(chain_scan__invoke__missing_file__failure_error)
+{
+    BX_DECLARE_COMMAND(chain_scan);
+    command.set_addresses_option({ { CHAIN_SCAN_OUTPUT_ADDRESS } });
+    command.set_files_argument({ "bx-chain-scan-missing.dat" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The block file bx-chain-scan-missing.dat cannot be read.\n");
+}
+
+BOOST_AUTO_TEST_CASE(chain_scan__invoke__truncated__failure_output_error)
+{
+    auto contents = make_block_file(2);
+    contents.resize(contents.size() - 64 - 1);
+    const block_file_fixture file(contents);
+    BX_DECLARE_COMMAND(chain_scan);
+    command.set_addresses_option({ { CHAIN_SCAN_INPUT_ADDRESS } });
+    command.set_files_argument({ file.path() });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BOOST_REQUIRE_EQUAL(output.str(), CHAIN_SCAN_INPUTS);
+    BOOST_REQUIRE_EQUAL(error.str(), "The last block of the file " + file.path() + " is truncated.\n");
+}
+
+BOOST_AUTO_TEST_CASE(chain_scan__invoke__invalid_block__failure_error)
+{
+    // A record of one byte is not a block.
+    data_chunk contents;
+    extend_data(contents, to_little_endian(mainnet_block_file_magic));
+    extend_data(contents, to_little_endian(uint32_t(1)));
+    contents.push_back(0x00);
+
+    const block_file_fixture file(contents);
+    BX_DECLARE_COMMAND(chain_scan);
+    command.set_addresses_option({ { CHAIN_SCAN_INPUT_ADDRESS } });
+    command.set_files_argument({ file.path() });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BOOST_REQUIRE_EQUAL(error.str(), "The block at offset 0 of the file " + file.path() + " is not valid.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
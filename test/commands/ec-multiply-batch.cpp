@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(ec_multiply_batch__invoke)
+
+#define EC_MULTIPLY_BATCH_SECRETS \
+"4c721ccd679b817ea5e86e34f9d46abb1660a63955dde908702214eaab038475\n" \
+"\n" \
+"8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddb9c8\n" \
+"  0000000000000000000000000000000000000000000000000000000000000001\n" \
+"00000000000000000000000000000000000000000000000000000000000000ff\r\n" \
+"0000000000000000000000000000000000000000000000000000000000000100\n" \
+"8000000000000000000000000000000000000000000000000000000000000000\n" \
+"fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140\n" \
+"1bab84e687e36514eeaf5a017c30d32c1f59dd4ea6629da7970ca374513dd006\n"
+
+#define EC_MULTIPLY_BATCH_COMPRESSED \
+"03e50a085f199484f885e951ab7cbe7fb9ca5020c6bbb77871f8203251c99819f7\n" \
+"031ecc9423d81b672c426883fa5307a9aebc3f88fa6b6d34af875aef7426382325\n" \
+"021bab84e687e36514eeaf5a017c30d32c1f59dd4ea6629da7970ca374513dd006\n" \
+"03edf6258083bb83851b4881c55a0b8b8b51a567958aadc110161455e56fd3bfb9\n" \
+"02ae227f67946dda76a87d1c9385b31ccdc940ebbf2c5c927dba61e1c0fb48e660\n" \
+"036753c615c1e782cb402594bcdb7c4730c3bff6357258c5edf7f6166b6810cc2e\n" \
+"031bab84e687e36514eeaf5a017c30d32c1f59dd4ea6629da7970ca374513dd006\n" \
+"02da5629b7902abcfc166b30eda4cc6b2702b5d0bb867217614101caa710f0753b\n"
+
+#define EC_MULTIPLY_BATCH_UNCOMPRESSED \
+"04e50a085f199484f885e951ab7cbe7fb9ca5020c6bbb77871f8203251c99819f7483e6225940bbf24b531d8c0e33e56734e96c045179971e48f252c9a0b361bdd\n" \
+"041ecc9423d81b672c426883fa5307a9aebc3f88fa6b6d34af875aef74263823253f426f06a41bda16aaed7eb035a4787fa62f17cc865077e0a9fd6177467b0815\n" \
+"041bab84e687e36514eeaf5a017c30d32c1f59dd4ea6629da7970ca374513dd006ba308c310ea0fe37db8d4884dcb149e5658dcda8beeb4dfaaf1e2aaf30d8b9fa\n" \
+"04edf6258083bb83851b4881c55a0b8b8b51a567958aadc110161455e56fd3bfb9b4f9c37dc3eebbec8d4ec365410626c069ac0e606315b6951003d4ead3cc7827\n" \
+"04ae227f67946dda76a87d1c9385b31ccdc940ebbf2c5c927dba61e1c0fb48e6608ea0d9dcd450587b16276469622da56405b4c9f2af15b5fc655cc0dec2d85516\n" \
+"046753c615c1e782cb402594bcdb7c4730c3bff6357258c5edf7f6166b6810cc2e5266d98041991eeb6438bc35e4dc0260993cf01ac08ef855176b21da548a96e9\n" \
+"041bab84e687e36514eeaf5a017c30d32c1f59dd4ea6629da7970ca374513dd00645cf73cef15f01c82472b77b234eb61a9a7232574114b20550e1d54fcf274235\n" \
+"04da5629b7902abcfc166b30eda4cc6b2702b5d0bb867217614101caa710f0753b690f198286496c344154c148304543204d1c459c8612a0535b1a94104682c960\n"
+
+BOOST_AUTO_TEST_CASE(ec_multiply_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_multiply_batch);
+    command.set_point_argument({ "021bab84e687e36514eeaf5a017c30d32c1f59dd4ea6629da7970ca374513dd006" });
+    command.set_secrets_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(ec_multiply_batch__invoke__compressed_point__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_multiply_batch);
+    command.set_point_argument({ "021bab84e687e36514eeaf5a017c30d32c1f59dd4ea6629da7970ca374513dd006" });
+    command.set_secrets_argument({ EC_MULTIPLY_BATCH_SECRETS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EC_MULTIPLY_BATCH_COMPRESSED);
+}
+
+BOOST_AUTO_TEST_CASE(ec_multiply_batch__invoke__uncompressed_point__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_multiply_batch);
+    command.set_point_argument({ "041bab84e687e36514eeaf5a017c30d32c1f59dd4ea6629da7970ca374513dd006ba308c310ea0fe37db8d4884dcb149e5658dcda8beeb4dfaaf1e2aaf30d8b9fa" });
+    command.set_secrets_argument({ EC_MULTIPLY_BATCH_SECRETS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EC_MULTIPLY_BATCH_UNCOMPRESSED);
+}
+
+BOOST_AUTO_TEST_CASE(ec_multiply_batch__invoke__invalid_secret__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_multiply_batch);
+    command.set_point_argument({ "021bab84e687e36514eeaf5a017c30d32c1f59dd4ea6629da7970ca374513dd006" });
+    command.set_secrets_argument({ "0000000000000000000000000000000000000000000000000000000000000001\n0g\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The secret on line 2 is not a valid EC secret.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(ec_to_address_batch__invoke)
+
+#define EC_TO_ADDRESS_BATCH_KEYS \
+"0247140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36\n" \
+"\n" \
+"0447140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36e87bb04f401be3b770a0f3e2267a6c3b14a3074f6b5ce4419f1fcdc1ca4b1cb6\n" \
+"  03ac9e60013853128b42a1324609bac2ccff6a0b4844b6301f1f552e15ee14c7a5\n" \
+"0479be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8\r\n" \
+"031b38903a43f7f114ed4500b4eac7083fdefece1cf29c63528d563446f972c180\n"
+
+#define EC_TO_ADDRESS_BATCH_ADDRESSES \
+"1EKJFK8kBmasFRYY3Ay9QjpJLm4vemJtC1\n" \
+"197FLrycah42jKDgfmTaok7b8kNHA7R2ih\n" \
+"1CkPz6jjgEv8p5zYVo6GgobgB2NytLVA4B\n" \
+"1EHNa6Q4Jz2uvNExL497mE43ikXhwF6kZm\n" \
+"1DF7Yr4GKWoCXZZZXoEczo9oiokwQe8Urz\n"
+
+#define EC_TO_ADDRESS_BATCH_ADDRESSES_VERSION_111 \
+"mtqFYNDizo282Y29kjwXEf2dCkfdZZydbf\n" \
+"modCdv4bPiVHWRhJPLRxdfKuzjxz275cah\n" \
+"msGMH9piVGMPbCUADN4eWip131ygp7gDjo\n" \
+"mtoKs9V381UAhUia3d7Vb9GNak8Qvmcsme\n" \
+"msm4qu9F8YETJg3BFNCzpiN8aoMeGGfZZi\n"
+
+BOOST_AUTO_TEST_CASE(ec_to_address_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_address_batch);
+    command.set_ec_public_keys_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_address_batch__invoke__keys__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_address_batch);
+    command.set_ec_public_keys_argument({ EC_TO_ADDRESS_BATCH_KEYS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EC_TO_ADDRESS_BATCH_ADDRESSES);
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_address_batch__invoke__keys_version_111__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_address_batch);
+    command.set_version_option(111);
+    command.set_ec_public_keys_argument({ EC_TO_ADDRESS_BATCH_KEYS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EC_TO_ADDRESS_BATCH_ADDRESSES_VERSION_111);
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_address_batch__invoke__invalid_key__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_to_address_batch);
+    command.set_ec_public_keys_argument({ "0247140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36\n\n02ffff\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The key on line 3 is not a valid EC public key.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
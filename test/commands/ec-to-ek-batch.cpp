@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(ec_to_ek_batch__invoke)
+
+#ifdef WITH_ICU
+
+#define EC_TO_EK_BATCH_SECRETS \
+"261fc32e9f29c70e3d898aa7db028c81ede0658e8ff8ffab8160073c048ae83f\n" \
+"\n" \
+"cbf4b9f70470856bb4f40f80b87edb90865997ffee6df315ab166d713af433a5\r\n" \
+"09c2686880095b1a4c249ee3ac4eea8a014f11e6f986d0b5025ac1f39afbd9ae\n"
+
+#define EC_TO_EK_BATCH_KEYS \
+"6PYXCdvtrs4NN1TjUYbGS5Sd2gjsVsDm7GttqERRWvRjWDsrhQfJeEHrg5\n" \
+"6PYNKZ1EApQE8BY8VBzpceSUzXXmCLyNPv4ZufkVvydp7gUrzFXhMUxJze\n" \
+"6PYLtMnXw8LNom6u97f9wx6drRDh1qgYdvsGsZ36GxDJuVfLp9UnyeNMs6\n"
+
+BOOST_AUTO_TEST_CASE(ec_to_ek_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_ek_batch);
+    command.set_passphrase_argument("my passphrase");
+    command.set_ec_private_keys_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_ek_batch__invoke__one_thread__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_ek_batch);
+    command.set_threads_option(1);
+    command.set_passphrase_argument("my passphrase");
+    command.set_ec_private_keys_argument({ EC_TO_EK_BATCH_SECRETS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EC_TO_EK_BATCH_KEYS);
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_ek_batch__invoke__two_threads__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_ek_batch);
+    command.set_threads_option(2);
+    command.set_passphrase_argument("my passphrase");
+    command.set_ec_private_keys_argument({ EC_TO_EK_BATCH_SECRETS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EC_TO_EK_BATCH_KEYS);
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_ek_batch__invoke__uncompressed__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_ek_batch);
+    command.set_uncompressed_option(true);
+    command.set_passphrase_argument("my passphrase");
+    command.set_ec_private_keys_argument({ "261fc32e9f29c70e3d898aa7db028c81ede0658e8ff8ffab8160073c048ae83f" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("6PRPDbKfv3A45QPPfEtvcxM4oA6ShVL7t72VP74P1W3JEUHPrZXNy39FKe\n");
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_ek_batch__invoke__invalid_keys__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_to_ek_batch);
+    command.set_passphrase_argument("my passphrase");
+    command.set_ec_private_keys_argument({
+        "261fc32e9f29c70e3d898aa7db028c81ede0658e8ff8ffab8160073c048ae83f\n"
+        "0000000000000000000000000000000000000000000000000000000000000000\n"
+        "261fc32e\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+    BX_REQUIRE_ERROR(
+        "The key on line 2 is not a valid EC private key.\n"
+        "The key on line 3 is not a valid EC private key.\n");
+}
+
+#else // WITH_ICU
+
+BOOST_AUTO_TEST_CASE(ec_to_ek_batch__invoke__not_icu__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_to_ek_batch);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_EC_TO_EK_BATCH_REQUIRES_ICU "\n");
+}
+
+#endif // !WITH_ICU
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
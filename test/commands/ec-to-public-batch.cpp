@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(ec_to_public_batch__invoke)
+
+#define EC_TO_PUBLIC_BATCH_KEYS \
+"4c721ccd679b817ea5e86e34f9d46abb1660a63955dde908702214eaab038475\n" \
+"\n" \
+"8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddb9c8\n" \
+"  0000000000000000000000000000000000000000000000000000000000000001\n" \
+"00000000000000000000000000000000000000000000000000000000000000ff\r\n" \
+"0000000000000000000000000000000000000000000000000000000000000100\n" \
+"8000000000000000000000000000000000000000000000000000000000000000\n" \
+"fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140\n" \
+"1bab84e687e36514eeaf5a017c30d32c1f59dd4ea6629da7970ca374513dd006\n"
+
+#define EC_TO_PUBLIC_BATCH_COMPRESSED \
+"03ac9e60013853128b42a1324609bac2ccff6a0b4844b6301f1f552e15ee14c7a5\n" \
+"0247140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36\n" \
+"0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798\n" \
+"031b38903a43f7f114ed4500b4eac7083fdefece1cf29c63528d563446f972c180\n" \
+"038282263212c609d9ea2a6e3e172de238d8c39cabd5ac1ca10646e23fd5f51508\n" \
+"02b23790a42be63e1b251ad6c94fdef07271ec0aada31db6c3e8bd32043f8be384\n" \
+"0379be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798\n" \
+"0218684cfb6aefc8a7e4c08b4bad03fcd167c6e7401fe80997e8298f9f174cfe32\n"
+
+#define EC_TO_PUBLIC_BATCH_UNCOMPRESSED \
+"04ac9e60013853128b42a1324609bac2ccff6a0b4844b6301f1f552e15ee14c7a56e880343da4e6701e0c2266db10cffbd2b8c81d54ba77766d776c661476d1069\n" \
+"0447140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36e87bb04f401be3b770a0f3e2267a6c3b14a3074f6b5ce4419f1fcdc1ca4b1cb6\n" \
+"0479be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8\n" \
+"041b38903a43f7f114ed4500b4eac7083fdefece1cf29c63528d563446f972c1804036edc931a60ae889353f77fd53de4a2708b26b6f5da72ad3394119daf408f9\n" \
+"048282263212c609d9ea2a6e3e172de238d8c39cabd5ac1ca10646e23fd5f5150811f8a8098557dfe45e8256e830b60ace62d613ac2f7b17bed31b6eaff6e26caf\n" \
+"04b23790a42be63e1b251ad6c94fdef07271ec0aada31db6c3e8bd32043f8be384fc6b694919d55edbe8d50f88aa81f94517f004f4149ecb58d10a473deb19880e\n" \
+"0479be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798b7c52588d95c3b9aa25b0403f1eef75702e84bb7597aabe663b82f6f04ef2777\n" \
+"0418684cfb6aefc8a7e4c08b4bad03fcd167c6e7401fe80997e8298f9f174cfe321bf0e1edbae7b3f1f1942eefcaf0a3bedb85829c2ece5da9526071ca88be21fc\n"
+
+BOOST_AUTO_TEST_CASE(ec_to_public_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_public_batch);
+    command.set_ec_private_keys_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_public_batch__invoke__one_key__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_public_batch);
+    command.set_ec_private_keys_argument({ "8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddb9c8" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("0247140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36\n");
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_public_batch__invoke__compressed__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_public_batch);
+    command.set_uncompressed_option(false);
+    command.set_ec_private_keys_argument({ EC_TO_PUBLIC_BATCH_KEYS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EC_TO_PUBLIC_BATCH_COMPRESSED);
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_public_batch__invoke__uncompressed__okay_output)
+{
+    BX_DECLARE_COMMAND(ec_to_public_batch);
+    command.set_uncompressed_option(true);
+    command.set_ec_private_keys_argument({ EC_TO_PUBLIC_BATCH_KEYS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EC_TO_PUBLIC_BATCH_UNCOMPRESSED);
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_public_batch__invoke__zero_key__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_to_public_batch);
+    command.set_ec_private_keys_argument({ "0000000000000000000000000000000000000000000000000000000000000001\n\n0000000000000000000000000000000000000000000000000000000000000000\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The key on line 3 is not a valid EC private key.\n");
+}
+
+BOOST_AUTO_TEST_CASE(ec_to_public_batch__invoke__key_out_of_range__failure_error)
+{
+    BX_DECLARE_COMMAND(ec_to_public_batch);
+    command.set_ec_private_keys_argument({ "0000000000000000000000000000000000000000000000000000000000000001\nfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The key on line 2 is not a valid EC private key.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
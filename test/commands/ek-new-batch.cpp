@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(ek_new_batch__invoke)
+
+#define EK_NEW_BATCH_TOKEN "passphraseryQXuRZZQ3Jw5rAT7m6MzxkGSSRmysq3Ayj9vuEHEnbVPJSmRQ2xYFKDKjGYrq"
+
+#define EK_NEW_BATCH_SEEDS \
+"baadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00d\n" \
+"7113f4c2e8f67b61225c9a619cd984b63f28df434bf18217\n" \
+"\n" \
+"d36d8e703d8bd5445044178f69087657fba73d9f3ff211f7\n" \
+"bbeac8b9bb39381520b6873553544b387bcaa19112602230\n"
+
+#define EK_NEW_BATCH_KEYS \
+"6PnUht3dP5Jdcp1B7NGqkEoBw5Ja2wWEeQMDRHqLNrBG4Rqo59eVfMd98B 1DeDt7odeJqJvquJ6obEZfH1hfJHMvnURa\n" \
+"6PnTXoTt48rHNWvuMBRyW2ttL4zfz31J8TMcsJQVNxmxAgqVMN2mmNezsC 1DS3aqzg5w8bMsyzyutxcrhKoLZGjPnC13\n" \
+"6PnVX7FAt3ezDuJT6RxehKSHWnvQ1aLcb3TaNFmqTQLudi3ehkd6bTqSYb 1HfLfiM6D65WkodTk9QD1zPhUd44xj6Ppe\n" \
+"6PnXAztPxBWdK8qZMbiu4R4ZoBsFMSWmabnzrx18PF87b7zhhHgrjWf6HT 1Asvb9yc8YhR8yZ9p2XR2SXgi9nj94quEJ\n"
+
+BOOST_AUTO_TEST_CASE(ek_new_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(ek_new_batch);
+    command.set_token_argument({ EK_NEW_BATCH_TOKEN });
+    command.set_seeds_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(ek_new_batch__invoke__one_thread__okay_output)
+{
+    BX_DECLARE_COMMAND(ek_new_batch);
+    command.set_threads_option(1);
+    command.set_token_argument({ EK_NEW_BATCH_TOKEN });
+    command.set_seeds_argument({ EK_NEW_BATCH_SEEDS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EK_NEW_BATCH_KEYS);
+}
+
+BOOST_AUTO_TEST_CASE(ek_new_batch__invoke__three_threads__okay_output)
+{
+    BX_DECLARE_COMMAND(ek_new_batch);
+    command.set_threads_option(3);
+    command.set_token_argument({ EK_NEW_BATCH_TOKEN });
+    command.set_seeds_argument({ EK_NEW_BATCH_SEEDS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EK_NEW_BATCH_KEYS);
+}
+
+BOOST_AUTO_TEST_CASE(ek_new_batch__invoke__lot_sequence_token__okay_output)
+{
+    BX_DECLARE_COMMAND(ek_new_batch);
+    command.set_token_argument({ "passphrasecpXbDpHuo8F7yuZqR49koDA9uQojPijjjZaxsar7Woo9pfHJbeWF3VMU9EPBqJ" });
+    command.set_seeds_argument({ "baadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00d\r\n" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("6PoJB3hjqER7KJDeo69pfX3ttV5DPaQPEf4pZEwhNYjTjqMdvif5qfE34S 1LoMVBxYZuzZZfTckU3JRccwFCMJYP3WRg\n");
+}
+
+BOOST_AUTO_TEST_CASE(ek_new_batch__invoke__uncompressed__okay_output)
+{
+    BX_DECLARE_COMMAND(ek_new_batch);
+    command.set_uncompressed_option(true);
+    command.set_token_argument({ EK_NEW_BATCH_TOKEN });
+    command.set_seeds_argument({ "baadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00d" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("6PfM4jsmgX1veYaiBXqqDe3J8hFtAriohdNGjPfrbt7aQ8H53nijYN6svW 1MydksvfdWNXM1KnVTS8A78M4b78aJcL1W\n");
+}
+
+BOOST_AUTO_TEST_CASE(ek_new_batch__invoke__short_and_invalid_seeds__failure_error)
+{
+    BX_DECLARE_COMMAND(ek_new_batch);
+    command.set_token_argument({ EK_NEW_BATCH_TOKEN });
+    command.set_seeds_argument({
+        "baadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00d\n"
+        "baadf00dbaadf00dbaadf00dbaadf00d\n"
+        "not base16\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+    BX_REQUIRE_ERROR(
+        "The seed on line 2 is not Base16 or is less than 192 bits long.\n"
+        "The seed on line 3 is not Base16 or is less than 192 bits long.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(ek_to_ec_batch__invoke)
+
+#ifdef WITH_ICU
+
+#define EK_TO_EC_BATCH_KEYS \
+"6PYXCdvtrs4NN1TjUYbGS5Sd2gjsVsDm7GttqERRWvRjWDsrhQfJeEHrg5\n" \
+"\n" \
+"6PRPDbKfv3A45QPPfEtvcxM4oA6ShVL7t72VP74P1W3JEUHPrZXNy39FKe\r\n" \
+"8EzHSxX3sfZp6NjYUdt7fZAPCKByrFDS12PHfdexFLSaSAfM7wM7tw3Hof\n" \
+"6PoJB3hjqER7KJDeo69pfX3ttV5DPaQPEf4pZEwhNYjTjqMdvif5qfE34S\n" \
+"6PnUht3dP5Jdcp1B7NGqkEoBw5Ja2wWEeQMDRHqLNrBG4Rqo59eVfMd98B\n"
+
+#define EK_TO_EC_BATCH_SECRETS \
+"6PYXCdvtrs4NN1TjUYbGS5Sd2gjsVsDm7GttqERRWvRjWDsrhQfJeEHrg5 261fc32e9f29c70e3d898aa7db028c81ede0658e8ff8ffab8160073c048ae83f\n" \
+"6PRPDbKfv3A45QPPfEtvcxM4oA6ShVL7t72VP74P1W3JEUHPrZXNy39FKe 261fc32e9f29c70e3d898aa7db028c81ede0658e8ff8ffab8160073c048ae83f\n" \
+"8EzHSxX3sfZp6NjYUdt7fZAPCKByrFDS12PHfdexFLSaSAfM7wM7tw3Hof 261fc32e9f29c70e3d898aa7db028c81ede0658e8ff8ffab8160073c048ae83f\n" \
+"6PoJB3hjqER7KJDeo69pfX3ttV5DPaQPEf4pZEwhNYjTjqMdvif5qfE34S 056115405c7161e62216fcbbf48832c8ed5ef66819a361ec8f6583f12bb2a924\n" \
+"6PnUht3dP5Jdcp1B7NGqkEoBw5Ja2wWEeQMDRHqLNrBG4Rqo59eVfMd98B b1c23d8bf9a957349eafd851808ce5555279cc103924ebd96ddaa3b03666ac74\n"
+
+BOOST_AUTO_TEST_CASE(ek_to_ec_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(ek_to_ec_batch);
+    command.set_passphrase_argument("my passphrase");
+    command.set_ek_private_keys_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(ek_to_ec_batch__invoke__one_thread__okay_output)
+{
+    BX_DECLARE_COMMAND(ek_to_ec_batch);
+    command.set_threads_option(1);
+    command.set_passphrase_argument("my passphrase");
+    command.set_ek_private_keys_argument({ EK_TO_EC_BATCH_KEYS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EK_TO_EC_BATCH_SECRETS);
+}
+
+BOOST_AUTO_TEST_CASE(ek_to_ec_batch__invoke__two_threads__okay_output)
+{
+    BX_DECLARE_COMMAND(ek_to_ec_batch);
+    command.set_threads_option(2);
+    command.set_passphrase_argument("my passphrase");
+    command.set_ek_private_keys_argument({ EK_TO_EC_BATCH_KEYS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(EK_TO_EC_BATCH_SECRETS);
+}
+
+BOOST_AUTO_TEST_CASE(ek_to_ec_batch__invoke__incorrect_passphrase__failure_error)
+{
+    BX_DECLARE_COMMAND(ek_to_ec_batch);
+    command.set_passphrase_argument("my passphrase");
+    command.set_ek_private_keys_argument({
+        "6PYXCdvtrs4NN1TjUYbGS5Sd2gjsVsDm7GttqERRWvRjWDsrhQfJeEHrg5\n"
+        "6PRVWUbkzzsbcVac2qwfssoUJAN1Xhrg6bNk8J7Nzm5H7kxEbn2Nh2ZoGg\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("6PYXCdvtrs4NN1TjUYbGS5Sd2gjsVsDm7GttqERRWvRjWDsrhQfJeEHrg5 261fc32e9f29c70e3d898aa7db028c81ede0658e8ff8ffab8160073c048ae83f\n");
+    BX_REQUIRE_ERROR("The passphrase is incorrect for the key on line 2.\n");
+}
+
+BOOST_AUTO_TEST_CASE(ek_to_ec_batch__invoke__invalid_key__failure_error)
+{
+    BX_DECLARE_COMMAND(ek_to_ec_batch);
+    command.set_passphrase_argument("my passphrase");
+    command.set_ek_private_keys_argument({
+        "6PYXCdvtrs4NN1TjUYbGS5Sd2gjsVsDm7GttqERRWvRjWDsrhQfJeEHrg5\n"
+        "6PYXCdvtrs4NN1TjUYbGS5Sd2gjsVsDm7GttqERRWvRjWDsrhQfJeEHrg6\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+    BX_REQUIRE_ERROR("The key on line 2 is not a valid encrypted private key.\n");
+}
+
+#else // WITH_ICU
+
+BOOST_AUTO_TEST_CASE(ek_to_ec_batch__invoke__not_icu__failure_error)
+{
+    BX_DECLARE_COMMAND(ek_to_ec_batch);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_EK_TO_EC_BATCH_REQUIRES_ICU "\n");
+}
+
+#endif // !WITH_ICU
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <boost/filesystem.hpp>
 #include "command.hpp"
 
 BX_USING_NAMESPACES()
@@ -84,3 +85,21 @@ BOOST_AUTO_TEST_CASE(fetch_history__invoke__mainnet_sx_demo2_info__okay_output)
 
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(fetch_history__invoke)
+
+BOOST_AUTO_TEST_CASE(fetch_history__invoke__offline_empty_index__failure_error)
+{
+    const auto directory = (boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("bx-fetch-history-%%%%-%%%%")).string();
+    BX_DECLARE_COMMAND(fetch_history);
+    command.set_offline_option(true);
+    command.set_index_option(directory);
+    command.set_payment_address_argument({ BX_FETCH_HISTORY_SX_DEMO2_ADDRESS });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The chain index " + directory + " cannot be read.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,150 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(hash_batch__invoke)
+
+// Ten lines of three distinct items, enough to fill a group of lanes.
+#define HASH_BATCH_DATA \
+"00\n" \
+"\n" \
+"616263\n" \
+"  baadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00d\n" \
+"00\n" \
+"616263\n" \
+"baadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00d\r\n" \
+"00\n" \
+"616263\n" \
+"baadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00dbaadf00d\n" \
+"00\n"
+
+// The distinct item of each line of the data.
+static const std::vector<size_t> hash_batch_items
+{
+    0, 1, 2, 0, 1, 2, 0, 1, 2, 0
+};
+
+// The hashes of the three distinct items by each algorithm.
+struct hash_batch_vector
+{
+    std::string algorithm;
+    std::vector<std::string> hashes;
+};
+
+static const std::vector<hash_batch_vector> hash_batch_vectors
+{
+    {
+        "bitcoin160",
+        {
+            "9f7fd096d37ed2c0e3f7f0cfc924beef4ffceb68",
+            "bb1be98c142444d7a56aa3981c3942a978e4dc33",
+            "297844e8e7e8bd6d0b7a678cce676bb910725c6e"
+        }
+    },
+    {
+        "bitcoin256",
+        {
+            "9a538906e6466ebd2617d321f71bc94e56056ce213d366773699e28158e00614",
+            "58636c3ec08c12d55aedda056d602d5bcca72d8df6a69b519b72d32dc2428b4f",
+            "c2a66d2b08dd6336c8f01cad09114ae57aadf1cb3630ff094b793fbba33a91a6"
+        }
+    },
+    {
+        "sha160",
+        {
+            "5ba93c9db0cff93f52b521d7420e43f6eda2784f",
+            "a9993e364706816aba3e25717850c26c9cd0d89d",
+            "62a38b1bbd9185de7db06642435217fdb435d57b"
+        }
+    },
+    {
+        "sha256",
+        {
+            "6e340b9cffb37a989ca544e6bb780a2c78901d3fb33738768511a30617afa01d",
+            "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad",
+            "506824d9214a36b441c5a799e080e1f43cdfa435a97aa052656a7ae6ad2d78ee"
+        }
+    }
+};
+
+BOOST_AUTO_TEST_CASE(hash_batch__invoke__empty__okay_output)
+{
+    for (const auto& vector: hash_batch_vectors)
+    {
+        BX_DECLARE_COMMAND(hash_batch);
+        command.set_algorithm_option(vector.algorithm);
+        command.set_base16s_argument({ "" });
+        BX_REQUIRE_OKAY(command.invoke(output, error));
+        BX_REQUIRE_OUTPUT("");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_batch__invoke__one_line__okay_output)
+{
+    for (const auto& vector: hash_batch_vectors)
+    {
+        BX_DECLARE_COMMAND(hash_batch);
+        command.set_algorithm_option(vector.algorithm);
+        command.set_base16s_argument({ "616263" });
+        BX_REQUIRE_OKAY(command.invoke(output, error));
+        BX_REQUIRE_OUTPUT(vector.hashes[1] + "\n");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_batch__invoke__lines__okay_output)
+{
+    for (const auto& vector: hash_batch_vectors)
+    {
+        std::string expected;
+        for (const auto item: hash_batch_items)
+            expected += vector.hashes[item] + "\n";
+
+        BX_DECLARE_COMMAND(hash_batch);
+        command.set_algorithm_option(vector.algorithm);
+        command.set_base16s_argument({ HASH_BATCH_DATA });
+        BX_REQUIRE_OKAY(command.invoke(output, error));
+        BX_REQUIRE_OUTPUT(expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(hash_batch__invoke__invalid_line__failure_error)
+{
+    BX_DECLARE_COMMAND(hash_batch);
+    command.set_algorithm_option("sha256");
+    command.set_base16s_argument({ "00\n\n0g\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The data on line 3 is not valid Base16.\n");
+}
+
+BOOST_AUTO_TEST_CASE(hash_batch__invoke__invalid_algorithm__failure_error)
+{
+    BX_DECLARE_COMMAND(hash_batch);
+    command.set_algorithm_option("sha512");
+    command.set_base16s_argument({ "00\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The hash algorithm 'sha512' is not supported.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -139,5 +139,23 @@ BOOST_AUTO_TEST_CASE(hd_private__invoke__testnet__okay_output)
     BX_REQUIRE_OUTPUT("tprv8ceMhknangxznNWYWLbRe6ovqv4rPkrnv61XEwfaoaXwHtPQVT8Rg4PUQaGuuHCEyRC4bAthkWKmmKGML38nCcn7sEZ4v1Cw5Ar6TP63QcC\n");
 }
 
+BOOST_AUTO_TEST_CASE(hd_private__invoke__mainnet_vector1_path__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_private);
+    command.set_path_option("m/0'/1/2'/2/1000000000");
+    command.set_hd_private_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("xprvA41z7zogVVwxVSgdKUHDy1SKmdb533PjDz7J6N6mV6uS3ze1ai8FHa8kmHScGpWmj4WggLyQjgPie1rFSruoUihUZREPSL39UNdE3BBDu76\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_private__invoke__invalid_path__failure_error)
+{
+    BX_DECLARE_COMMAND(hd_private);
+    command.set_path_option("m/2147483648");
+    command.set_hd_private_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HD_PRIVATE_INVALID_PATH "\n");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
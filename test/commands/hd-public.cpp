@@ -20,6 +20,10 @@
 
 #include "command.hpp"
 
+#include <iterator>
+#include <string>
+#include <boost/filesystem.hpp>
+
 BX_USING_NAMESPACES()
 
 BOOST_AUTO_TEST_SUITE(offline)
@@ -303,5 +307,82 @@ BOOST_AUTO_TEST_CASE(hd_public__invoke__public_derivation_testnet__okay_output)
     BX_REQUIRE_OUTPUT("tpubDBUXE2QrFFQBfPLxoKD3U1zG294LmLSG3rD9MvREmKcExYBeH4U1gyHcrtZDZe6JFxMFYVzYYhRDWCuJAQE3AbdpD3Qz4FdPVu5UHLT1NKa\n");
 }
 
+// path derivation
+
+#define HD_PUBLIC_CACHE_FILE "hd_public_cache.txt"
+
+static std::string read_cache()
+{
+    bc::ifstream file(HD_PUBLIC_CACHE_FILE);
+    return std::string(std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>());
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__invoke__mainnet_vector1_private_path__okay_output)
+{
+    BX_DECLARE_COMMAND(hd_public);
+    command.set_path_option("m/0'/1/2'/2/1000000000");
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("xpub6H1LXWLaKsWFhvm6RVpEL9P4KfRZSW7abD2ttkWP3SSQvnyA8FSVqNTEcYFgJS2UaFcxupHiYkro49S8yGasTvXEYBVPamhGW6cFJodrTHy\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__invoke__mainnet_vector1_public_hardened_path__failure_error)
+{
+    BX_DECLARE_COMMAND(hd_public);
+    command.set_path_option("m/0'/1");
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HD_PUBLIC_HARD_PATH_CONFLICT "\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__invoke__invalid_path__failure_error)
+{
+    BX_DECLARE_COMMAND(hd_public);
+    command.set_path_option("m/0'/x");
+    command.set_public_version_option(76067358);
+    command.set_secret_version_option(76066276);
+    command.set_hd_key_argument({ "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_HD_PUBLIC_INVALID_PATH "\n");
+}
+
+BOOST_AUTO_TEST_CASE(hd_public__invoke__mainnet_vector1_cached_path__okay_output)
+{
+    boost::filesystem::remove(HD_PUBLIC_CACHE_FILE);
+
+    // The first derivation is from the private key and caches the parent.
+    {
+        BX_DECLARE_COMMAND(hd_public);
+        command.set_cache_option(HD_PUBLIC_CACHE_FILE);
+        command.set_path_option("m/0'/1/2'/2/1000000000");
+        command.set_public_version_option(76067358);
+        command.set_secret_version_option(76066276);
+        command.set_hd_key_argument({ "xprv9s21ZrQH143K3QTDL4LXw2F7HEK3wJUD2nW2nRk4stbPy6cq3jPPqjiChkVvvNKmPGJxWUtg6LnF5kejMRNNU3TGtRBeJgk33yuGBxrMPHi" });
+        BX_REQUIRE_OKAY(command.invoke(output, error));
+        BX_REQUIRE_OUTPUT("xpub6H1LXWLaKsWFhvm6RVpEL9P4KfRZSW7abD2ttkWP3SSQvnyA8FSVqNTEcYFgJS2UaFcxupHiYkro49S8yGasTvXEYBVPamhGW6cFJodrTHy\n");
+    }
+
+    BOOST_REQUIRE_EQUAL(read_cache(), "8efafff7592612b3a45ddcbcdcd969d72283cc58 m/0'/1/2'/2 xpub6FHa3pjLCk84BayeJxFW2SP4XRrFd1JYnxeLeU8EqN3vDfZmbqBqaGJAyiLjTAwm6ZLRQUMv1ZACTj37sR62cfN7fe5JnJ7dh8zL4fiyLHV\n");
+
+    // The hardened path is then derivable from the public key of the root.
+    {
+        BX_DECLARE_COMMAND(hd_public);
+        command.set_cache_option(HD_PUBLIC_CACHE_FILE);
+        command.set_path_option("m/0'/1/2'/2/1000000000");
+        command.set_public_version_option(76067358);
+        command.set_secret_version_option(76066276);
+        command.set_hd_key_argument({ "xpub661MyMwAqRbcFtXgS5sYJABqqG9YLmC4Q1Rdap9gSE8NqtwybGhePY2gZ29ESFjqJoCu1Rupje8YtGqsefD265TMg7usUDFdp6W1EGMcet8" });
+        BX_REQUIRE_OKAY(command.invoke(output, error));
+        BX_REQUIRE_OUTPUT("xpub6H1LXWLaKsWFhvm6RVpEL9P4KfRZSW7abD2ttkWP3SSQvnyA8FSVqNTEcYFgJS2UaFcxupHiYkro49S8yGasTvXEYBVPamhGW6cFJodrTHy\n");
+    }
+
+    boost::filesystem::remove(HD_PUBLIC_CACHE_FILE);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
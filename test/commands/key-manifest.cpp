@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(key_manifest__invoke)
+
+#define KEY_MANIFEST_KEYS \
+"8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddb9c8\n" \
+"\n" \
+"  4c721ccd679b817ea5e86e34f9d46abb1660a63955dde908702214eaab038475\n" \
+"0000000000000000000000000000000000000000000000000000000000000001\r\n" \
+"fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364140\n"
+
+#define KEY_MANIFEST_COMPRESSED \
+"L21LJEeJwK35wby1BeTjwWssrhrgQE2MZrpTm2zbMC677czAHHu3 0247140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36 1EKJFK8kBmasFRYY3Ay9QjpJLm4vemJtC1\n" \
+"KynK1v6fGwt2deK5axWUi4dStZzyuhrMbsYwk52kXM5LMivMMrQp 03ac9e60013853128b42a1324609bac2ccff6a0b4844b6301f1f552e15ee14c7a5 1CkPz6jjgEv8p5zYVo6GgobgB2NytLVA4B\n" \
+"KwDiBf89QgGbjEhKnhXJuH7LrciVrZi3qYjgd9M7rFU73sVHnoWn 0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798 1BgGZ9tcN4rm9KBzDn7KprQz87SZ26SAMH\n" \
+"L5oLkpV3aqBjhki6LmvChTCV6odsp4SXM6FfU2Gppt5kFLaHLuZ9 0379be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798 1GrLCmVQXoyJXaPJQdqssNqwxvha1eUo2E\n"
+
+#define KEY_MANIFEST_UNCOMPRESSED \
+"5JuBiWpsjfXNxsWuc39KntBAiAiAP2bHtrMGaYGKCppq4MuVcQL 0447140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36e87bb04f401be3b770a0f3e2267a6c3b14a3074f6b5ce4419f1fcdc1ca4b1cb6 197FLrycah42jKDgfmTaok7b8kNHA7R2ih\n" \
+"5JPxHX9zA3vFRAMrydbKWhF9atRvDr8ZJsRTT55vpCoJ5LztFVJ 04ac9e60013853128b42a1324609bac2ccff6a0b4844b6301f1f552e15ee14c7a56e880343da4e6701e0c2266db10cffbd2b8c81d54ba77766d776c661476d1069 1BCB9ckaDoR1bceGggibaSukj58ZwoY6gX\n" \
+"5HpHagT65TZzG1PH3CSu63k8DbpvD8s5ip4nEB3kEsreAnchuDf 0479be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8 1EHNa6Q4Jz2uvNExL497mE43ikXhwF6kZm\n" \
+"5Km2kuu7vtFDPpxywn4u3NLpbr5jKpTB3jsuDU2KYEqetqj84qw 0479be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798b7c52588d95c3b9aa25b0403f1eef75702e84bb7597aabe663b82f6f04ef2777 1JPbzbsAx1HyaDQoLMapWGoqf9pD5uha5m\n"
+
+#define KEY_MANIFEST_TESTNET \
+"cSNKm9eANNjM73SGa4GsJqNwUwA64g83dtxvsTT6rJk7NN5fDPu3 0247140d2811498679fe9a0467a75ac7aa581476c102d27377bc0232635af8ad36 mtqFYNDizo282Y29kjwXEf2dCkfdZZydbf\n" \
+"cQ9JUq6Wi1aHo5nLyNKc5P8WWoJPa9x3fuhQrVVG2TjLcU12Z87g 03ac9e60013853128b42a1324609bac2ccff6a0b4844b6301f1f552e15ee14c7a5 msGMH9piVGMPbCUADN4eWip131ygp7gDjo\n" \
+"cMahea7zqjxrtgAbB7LSGbcQUr1uX1ojuat9jZodMN87JcbXMTcA 0279be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798 mrCDrCybB6J1vRfbwM5hemdJz73FwDBC8r\n" \
+"cWALDjUu1tszsCBMjBjL4mhYj2wHUWYDR8Q8aSjLKzjkW5eBtpzu 0379be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798 mwNHVpaPLqQZJgrv8CpFhJ4GpvJGumskXi\n"
+
+BOOST_AUTO_TEST_CASE(key_manifest__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(key_manifest);
+    command.set_wif_version_option(128);
+    command.set_ec_private_keys_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(key_manifest__invoke__compressed__okay_output)
+{
+    BX_DECLARE_COMMAND(key_manifest);
+    command.set_wif_version_option(128);
+    command.set_uncompressed_option(false);
+    command.set_ec_private_keys_argument({ KEY_MANIFEST_KEYS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(KEY_MANIFEST_COMPRESSED);
+}
+
+BOOST_AUTO_TEST_CASE(key_manifest__invoke__uncompressed__okay_output)
+{
+    BX_DECLARE_COMMAND(key_manifest);
+    command.set_wif_version_option(128);
+    command.set_uncompressed_option(true);
+    command.set_ec_private_keys_argument({ KEY_MANIFEST_KEYS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(KEY_MANIFEST_UNCOMPRESSED);
+}
+
+BOOST_AUTO_TEST_CASE(key_manifest__invoke__testnet__okay_output)
+{
+    BX_DECLARE_COMMAND(key_manifest);
+    command.set_version_option(111);
+    command.set_wif_version_option(239);
+    command.set_ec_private_keys_argument({ KEY_MANIFEST_KEYS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(KEY_MANIFEST_TESTNET);
+}
+
+BOOST_AUTO_TEST_CASE(key_manifest__invoke__invalid_key__failure_error)
+{
+    BX_DECLARE_COMMAND(key_manifest);
+    command.set_wif_version_option(128);
+    command.set_ec_private_keys_argument({ "0000000000000000000000000000000000000000000000000000000000000001\n\n0000000000000000000000000000000000000000000000000000000000000000\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The key on line 3 is not a valid EC private key.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(merkle_proof__invoke)
+
+// The transactions of the block of the block-decode tests, and one more.
+#define MERKLE_PROOF_HASHES \
+"39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" \
+"c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b\n" \
+"56944c5d3f98413ef45cf54545538103cc9f298e0575820ad3591376e2e0f65d\n"
+
+#define MERKLE_PROOF_BLOCK_BASE16 \
+"010000006fe28c0ab6f1b372c1a6a246ae63f74f931e8365e15a089c68d6190000000000121eb81089faac7652fe7891159d8705f25149081a6142018e18430193315fa929ab5f49ffff001d2a000000020100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac000000000100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000006a473044022039a36013301597daef41fbe593a02cc513d0b55527ec2df1050e2e8ff49c85c202201035fe810e283bcf394485c6a9dfd117ad9f684cdd83d36453718f5d0491b9dd012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+
+BOOST_AUTO_TEST_CASE(merkle_proof__invoke__first_hash__okay_output)
+{
+    BX_DECLARE_COMMAND(merkle_proof);
+    command.set_hash_argument({ "39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0" });
+    command.set_hashes_argument({ MERKLE_PROOF_HASHES });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("0\nc3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b\n93b3d00ba4b82b98384dc4179a5d866770d880736dcdfdaedb5ae895f1712b35\n");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_proof__invoke__last_odd_hash__okay_output)
+{
+    BX_DECLARE_COMMAND(merkle_proof);
+    command.set_hash_argument({ "56944c5d3f98413ef45cf54545538103cc9f298e0575820ad3591376e2e0f65d" });
+    command.set_hashes_argument({ MERKLE_PROOF_HASHES });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("2\n56944c5d3f98413ef45cf54545538103cc9f298e0575820ad3591376e2e0f65d\na95f31930143188e0142611a084951f205879d159178fe5276acfa8910b81e12\n");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_proof__invoke__block__okay_output)
+{
+    BX_DECLARE_COMMAND(merkle_proof);
+    command.set_block_option(true);
+    command.set_hash_argument({ "c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b" });
+    command.set_hashes_argument({ MERKLE_PROOF_BLOCK_BASE16 });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("1\n39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_proof__invoke__missing_hash__failure_error)
+{
+    BX_DECLARE_COMMAND(merkle_proof);
+    command.set_hash_argument({ "56944c5d3f98413ef45cf54545538103cc9f298e0575820ad3591376e2e0f65d" });
+    command.set_hashes_argument({ "39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\nc3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The transaction is not in the set.\n");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_proof__invoke__invalid_hash__failure_error)
+{
+    BX_DECLARE_COMMAND(merkle_proof);
+    command.set_hash_argument({ "39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0" });
+    command.set_hashes_argument({ "39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\nbogus\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The hash on line 2 is not valid.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(merkle_verify__invoke)
+
+// The header of the block of the block-decode tests.
+#define MERKLE_VERIFY_HEADER_BASE16 \
+"010000006fe28c0ab6f1b372c1a6a246ae63f74f931e8365e15a089c68d6190000000000121eb81089faac7652fe7891159d8705f25149081a6142018e18430193315fa929ab5f49ffff001d2a000000"
+
+BOOST_AUTO_TEST_CASE(merkle_verify__invoke__valid_proof__okay_output)
+{
+    BX_DECLARE_COMMAND(merkle_verify);
+    command.set_header_argument({ MERKLE_VERIFY_HEADER_BASE16 });
+    command.set_hash_argument({ "c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b" });
+    command.set_proof_argument({ "1\n39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("The transaction is in the block.\n");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_verify__invoke__wrong_position__invalid_output)
+{
+    BX_DECLARE_COMMAND(merkle_verify);
+    command.set_header_argument({ MERKLE_VERIFY_HEADER_BASE16 });
+    command.set_hash_argument({ "c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b" });
+    command.set_proof_argument({ "0\n39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("The transaction is not in the block.\n");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_verify__invoke__wrong_hash__invalid_output)
+{
+    BX_DECLARE_COMMAND(merkle_verify);
+    command.set_header_argument({ MERKLE_VERIFY_HEADER_BASE16 });
+    command.set_hash_argument({ "56944c5d3f98413ef45cf54545538103cc9f298e0575820ad3591376e2e0f65d" });
+    command.set_proof_argument({ "1\n39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("The transaction is not in the block.\n");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_verify__invoke__position_beyond_branch__failure_error)
+{
+    BX_DECLARE_COMMAND(merkle_verify);
+    command.set_header_argument({ MERKLE_VERIFY_HEADER_BASE16 });
+    command.set_hash_argument({ "c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b" });
+    command.set_proof_argument({ "2\n39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The proof is not valid.\n");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_verify__invoke__invalid_hash__failure_error)
+{
+    BX_DECLARE_COMMAND(merkle_verify);
+    command.set_header_argument({ MERKLE_VERIFY_HEADER_BASE16 });
+    command.set_hash_argument({ "c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b" });
+    command.set_proof_argument({ "1\nbogus\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The proof is not valid.\n");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_verify__invoke__empty__failure_error)
+{
+    BX_DECLARE_COMMAND(merkle_verify);
+    command.set_header_argument({ MERKLE_VERIFY_HEADER_BASE16 });
+    command.set_hash_argument({ "c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b" });
+    command.set_proof_argument({ "" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The proof is not valid.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,139 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(message_validate_batch__invoke)
+
+#define MESSAGE_VALIDATE_BATCH_ADDRESS_COMPRESSED "1PeChFbhxDD9NLbU21DfD55aQBC4ZTR3tE"
+#define MESSAGE_VALIDATE_BATCH_SIGNATURE_COMPRESSED "HxQp3cXgOIhBEGXks27sfeSQHVgNUeYgl5i5wG/dOUYaSIRnnzXR6NcyH+AfNAHtkWcyOD9rX4pojqmuQyH79K4="
+
+#define MESSAGE_VALIDATE_BATCH_ADDRESS_UNCOMPRESSED "1Em1SX7qQq1pTmByqLRafhL1ypx2V786tP"
+#define MESSAGE_VALIDATE_BATCH_SIGNATURE_UNCOMPRESSED "GxQp3cXgOIhBEGXks27sfeSQHVgNUeYgl5i5wG/dOUYaSIRnnzXR6NcyH+AfNAHtkWcyOD9rX4pojqmuQyH79K4="
+
+// The message "proof of reserves 2016" signed by the compressed key ce8f4b71...
+#define MESSAGE_VALIDATE_BATCH_ADDRESS_SPACED "1DRCR5Gvg18FNo8HUPH1u5bfd9b5XfnJDj"
+#define MESSAGE_VALIDATE_BATCH_SIGNATURE_SPACED "ILXFcVTimkigvvGycnX6tR3xA9036iypNRNJeIO2VA/YQZrDsxwJoBcdMxpNp363gArxqkh8F1imT3bCFTsO/6c="
+
+// The messages "trailing space \t " and "" signed by the compressed key
+// sha256("message-validate-batch").
+#define MESSAGE_VALIDATE_BATCH_ADDRESS_EDGE "1LLp69Kz6EguSRLfkAtygR4Poiz6rc2bxi"
+#define MESSAGE_VALIDATE_BATCH_SIGNATURE_TRAILING "Hwh2VlEAZpm0XjMWfP1RHVAXyurwFtkdEEqKjVM6pOt+O5949iaztKREL8WNuM0quQAcyB+T0hgCv3hoHl/3YR4="
+#define MESSAGE_VALIDATE_BATCH_SIGNATURE_EMPTY "HwdBGGrAZm3TXoSisGfIu+G99hhiYk9GsM005CH+TGN5GKlumOC0N0nmJ7Xbd/sQvVTNGra3E3aJxWnbiSjLIxU="
+
+#define MESSAGE_VALIDATE_BATCH_RECORD_COMPRESSED \
+    MESSAGE_VALIDATE_BATCH_ADDRESS_COMPRESSED " " MESSAGE_VALIDATE_BATCH_SIGNATURE_COMPRESSED " Nakomoto"
+#define MESSAGE_VALIDATE_BATCH_RECORD_UNCOMPRESSED \
+    MESSAGE_VALIDATE_BATCH_ADDRESS_UNCOMPRESSED " " MESSAGE_VALIDATE_BATCH_SIGNATURE_UNCOMPRESSED " Nakomoto"
+#define MESSAGE_VALIDATE_BATCH_RECORD_SPACED \
+    MESSAGE_VALIDATE_BATCH_ADDRESS_SPACED " " MESSAGE_VALIDATE_BATCH_SIGNATURE_SPACED " proof of reserves 2016"
+#define MESSAGE_VALIDATE_BATCH_RECORD_BOGUS \
+    MESSAGE_VALIDATE_BATCH_ADDRESS_COMPRESSED " " MESSAGE_VALIDATE_BATCH_SIGNATURE_COMPRESSED " Satoshi"
+
+BOOST_AUTO_TEST_CASE(message_validate_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(message_validate_batch);
+    command.set_records_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(message_validate_batch__invoke__all_valid__okay_output)
+{
+    BX_DECLARE_COMMAND(message_validate_batch);
+    command.set_records_argument({
+        MESSAGE_VALIDATE_BATCH_RECORD_COMPRESSED "\n"
+        MESSAGE_VALIDATE_BATCH_RECORD_UNCOMPRESSED "\r\n"
+        "\n"
+        MESSAGE_VALIDATE_BATCH_RECORD_SPACED });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(message_validate_batch__invoke__single_thread__okay_output)
+{
+    BX_DECLARE_COMMAND(message_validate_batch);
+    command.set_threads_option(1);
+    command.set_records_argument({
+        MESSAGE_VALIDATE_BATCH_RECORD_COMPRESSED "\n"
+        MESSAGE_VALIDATE_BATCH_RECORD_SPACED "\n" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(message_validate_batch__invoke__bogus_message__invalid_output)
+{
+    BX_DECLARE_COMMAND(message_validate_batch);
+    command.set_records_argument({
+        MESSAGE_VALIDATE_BATCH_RECORD_COMPRESSED "\n"
+        MESSAGE_VALIDATE_BATCH_RECORD_BOGUS "\n"
+        MESSAGE_VALIDATE_BATCH_RECORD_SPACED "\n" });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("The signature on line 2 is not valid for " MESSAGE_VALIDATE_BATCH_ADDRESS_COMPRESSED ".\n");
+}
+
+BOOST_AUTO_TEST_CASE(message_validate_batch__invoke__wrong_address__invalid_output)
+{
+    BX_DECLARE_COMMAND(message_validate_batch);
+    command.set_records_argument({
+        MESSAGE_VALIDATE_BATCH_ADDRESS_UNCOMPRESSED " " MESSAGE_VALIDATE_BATCH_SIGNATURE_COMPRESSED " Nakomoto" });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("The signature on line 1 is not valid for " MESSAGE_VALIDATE_BATCH_ADDRESS_UNCOMPRESSED ".\n");
+}
+
+BOOST_AUTO_TEST_CASE(message_validate_batch__invoke__trailing_space_message__invalid_output)
+{
+    BX_DECLARE_COMMAND(message_validate_batch);
+    command.set_records_argument({
+        MESSAGE_VALIDATE_BATCH_ADDRESS_EDGE " " MESSAGE_VALIDATE_BATCH_SIGNATURE_TRAILING " trailing space \t \r\n"
+        MESSAGE_VALIDATE_BATCH_ADDRESS_EDGE " " MESSAGE_VALIDATE_BATCH_SIGNATURE_TRAILING " trailing space\n" });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("The signature on line 2 is not valid for " MESSAGE_VALIDATE_BATCH_ADDRESS_EDGE ".\n");
+}
+
+BOOST_AUTO_TEST_CASE(message_validate_batch__invoke__empty_message__okay_output)
+{
+    BX_DECLARE_COMMAND(message_validate_batch);
+    command.set_records_argument({
+        MESSAGE_VALIDATE_BATCH_ADDRESS_EDGE " " MESSAGE_VALIDATE_BATCH_SIGNATURE_EMPTY " \n"
+        MESSAGE_VALIDATE_BATCH_ADDRESS_EDGE " " MESSAGE_VALIDATE_BATCH_SIGNATURE_EMPTY "\n" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(message_validate_batch__invoke__malformed_records__invalid_output)
+{
+    BX_DECLARE_COMMAND(message_validate_batch);
+    command.set_records_argument({
+        MESSAGE_VALIDATE_BATCH_ADDRESS_COMPRESSED "\n"
+        "bogus " MESSAGE_VALIDATE_BATCH_SIGNATURE_COMPRESSED " Nakomoto\n"
+        MESSAGE_VALIDATE_BATCH_ADDRESS_COMPRESSED " bogus Nakomoto\n"
+        MESSAGE_VALIDATE_BATCH_RECORD_COMPRESSED "\n" });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "The record on line 1 is not a payment address, signature and message.\n"
+        "The record on line 2 is not a payment address, signature and message.\n"
+        "The record on line 3 is not a payment address, signature and message.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,217 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(mnemonic_recover__invoke)
+
+// The address of the master key of the mnemonic, without passphrase.
+#define MNEMONIC_RECOVER_ADDRESS "1BZ9j3F7m4H1RPyeDp5iFwpR31SB6zrs19"
+
+// The HD public key of the mnemonic at 0'/1, without passphrase.
+#define MNEMONIC_RECOVER_KEY "xpub6A7PsGUCo9qsp8t5feeCx8AqLJ1w5dECaBAgNjmrhGVPWiPymXbtrBPzbzXVdyHjYxjwbhnM5L3W1368TPXeHkqEszytXPQEk4JjWePv6kT"
+
+#define MNEMONIC_RECOVER_SENTENCE \
+"abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about\n"
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__unknown_last_word__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ MNEMONIC_RECOVER_ADDRESS });
+    command.set_language_option({ "en" });
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "?"
+    });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MNEMONIC_RECOVER_SENTENCE);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__unknown_word_one_thread__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ MNEMONIC_RECOVER_ADDRESS });
+    command.set_threads_option(1);
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "?", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "about"
+    });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MNEMONIC_RECOVER_SENTENCE);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__misspelled_word__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ MNEMONIC_RECOVER_ADDRESS });
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandn", "about"
+    });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MNEMONIC_RECOVER_SENTENCE);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__prefixed_word__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ MNEMONIC_RECOVER_ADDRESS });
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "ab*"
+    });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MNEMONIC_RECOVER_SENTENCE);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__key_at_path__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_key_option({ MNEMONIC_RECOVER_KEY });
+    command.set_path_option("m/0'/1");
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "?"
+    });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MNEMONIC_RECOVER_SENTENCE);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__passphrase__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ "1HVTiWkuGKEJXJupriTdY5MKngcq2bH6P4" });
+    command.set_passphrase_option("TREZOR");
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "?"
+    });
+#ifdef WITH_ICU
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MNEMONIC_RECOVER_SENTENCE);
+#else
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_MNEMONIC_RECOVER_PASSPHRASE_UNSUPPORTED "\n");
+#endif
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__other_address__failure)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ "1HVTiWkuGKEJXJupriTdY5MKngcq2bH6P4" });
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "ab*"
+    });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__11_words__failure_error)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ MNEMONIC_RECOVER_ADDRESS });
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "?"
+    });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_MNEMONIC_RECOVER_LENGTH_INVALID_SENTENCE "\n");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__no_target__failure_error)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "?"
+    });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_MNEMONIC_RECOVER_TARGET_REQUIRED "\n");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__two_targets__failure_error)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ MNEMONIC_RECOVER_ADDRESS });
+    command.set_key_option({ MNEMONIC_RECOVER_KEY });
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "?"
+    });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_MNEMONIC_RECOVER_TARGET_REQUIRED "\n");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__invalid_path__failure_error)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ MNEMONIC_RECOVER_ADDRESS });
+    command.set_path_option("0/x");
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "?"
+    });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_MNEMONIC_RECOVER_INVALID_PATH "\n");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__mixed_languages__failure_error)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ MNEMONIC_RECOVER_ADDRESS });
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "previo", "?"
+    });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_MNEMONIC_RECOVER_INVALID_IN_LANGUAGES "\n");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__invoke__all_words_unknown__failure_error)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    command.set_address_option({ MNEMONIC_RECOVER_ADDRESS });
+    command.set_language_option({ "es" });
+    command.set_words_argument(
+    {
+        "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "abandon", "about"
+    });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_MNEMONIC_RECOVER_TOO_MANY_CANDIDATES "\n");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_recover__load_options__short_path_and_passphrase__parsed)
+{
+    BX_DECLARE_COMMAND(mnemonic_recover);
+    const char* argv[] = { "mnemonic-recover", "-d", "0'/1", "-p", "TREZOR" };
+    po::variables_map variables;
+    po::store(po::command_line_parser(5, argv)
+        .options(command.load_options()).run(), variables);
+    po::notify(variables);
+    BOOST_REQUIRE_EQUAL(command.get_path_option(), "0'/1");
+    BOOST_REQUIRE_EQUAL(command.get_passphrase_option(), "TREZOR");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(mnemonic_to_seed_batch__invoke)
+
+#define MNEMONIC_TO_SEED_BATCH_SENTENCES \
+"rival hurdle address inspire tenant alone\n" \
+"abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about\n" \
+"\n" \
+"  legal winner thank year wave\tsausage worth useful legal winner thank yellow\r\n" \
+"rival hurdle address inspire tenant alone\n" \
+"abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about\n"
+
+#define MNEMONIC_TO_SEED_BATCH_SEEDS \
+"33498afc5ef71e87afd7cad1e50a9d9adb9e30d3ca4b1da5dc370d266aa7796cbc1854eebce5ab3fd3b02b6625e2a82868dbb693e988e47d74106f04c76a6263\n" \
+"5eb00bbddcf069084889a8ab9155568165f5c453ccb85e70811aaed6f6da5fc19a5ac40b389cd370d086206dec8aa6c43daea6690f20ad3d8d48b2d2ce9e38e4\n" \
+"878386efb78845b3355bd15ea4d39ef97d179cb712b77d5c12b6be415fffeffe5f377ba02bf3f8544ab800b955e51fbff09828f682052a20faa6addbbddfb096\n" \
+"33498afc5ef71e87afd7cad1e50a9d9adb9e30d3ca4b1da5dc370d266aa7796cbc1854eebce5ab3fd3b02b6625e2a82868dbb693e988e47d74106f04c76a6263\n" \
+"5eb00bbddcf069084889a8ab9155568165f5c453ccb85e70811aaed6f6da5fc19a5ac40b389cd370d086206dec8aa6c43daea6690f20ad3d8d48b2d2ce9e38e4\n"
+
+BOOST_AUTO_TEST_CASE(mnemonic_to_seed_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_to_seed_batch);
+    command.set_sentences_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_to_seed_batch__invoke__one_thread__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_to_seed_batch);
+    command.set_language_option({ "en" });
+    command.set_threads_option(1);
+    command.set_sentences_argument({ MNEMONIC_TO_SEED_BATCH_SENTENCES });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MNEMONIC_TO_SEED_BATCH_SEEDS);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_to_seed_batch__invoke__two_threads__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_to_seed_batch);
+    command.set_threads_option(2);
+    command.set_sentences_argument({ MNEMONIC_TO_SEED_BATCH_SENTENCES });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(MNEMONIC_TO_SEED_BATCH_SEEDS);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_to_seed_batch__invoke__13_words__failure_error)
+{
+    BX_DECLARE_COMMAND(mnemonic_to_seed_batch);
+    command.set_sentences_argument({
+        "rival hurdle address inspire tenant alone\n"
+        "1 2 3 4 5 6 7 8 9 10 11 12 13\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+    BX_REQUIRE_ERROR("The number of words on line 2 is not divisible by 3.\n");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_to_seed_batch__invoke__24_invalid_words_en__failure_error)
+{
+    BX_DECLARE_COMMAND(mnemonic_to_seed_batch);
+    command.set_language_option({ "en" });
+    command.set_sentences_argument({
+        "1 2 3 4 5 6 7 8 1 2 3 4 5 6 7 8 1 2 3 4 5 6 7 8\n"
+        "rival hurdle address inspire tenant alone\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+    BX_REQUIRE_ERROR("The words on line 1 are not a valid mnemonic in the specified dictionary.\n");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_to_seed_batch__invoke__24_invalid_words__okay_warning)
+{
+    BX_DECLARE_COMMAND(mnemonic_to_seed_batch);
+    command.set_sentences_argument({
+        "rival hurdle address inspire tenant alone\n"
+        "1 2 3 4 5 6 7 8 1 2 3 4 5 6 7 8 1 2 3 4 5 6 7 8\n" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BOOST_REQUIRE_EQUAL(error.str(), "WARNING: The words on line 2 are not a valid mnemonic in any supported dictionary.\n");
+    BOOST_REQUIRE_EQUAL(output.str(),
+        "33498afc5ef71e87afd7cad1e50a9d9adb9e30d3ca4b1da5dc370d266aa7796cbc1854eebce5ab3fd3b02b6625e2a82868dbb693e988e47d74106f04c76a6263\n"
+        "4dcb7967130e59838c8aa12a61ce0fcbfd584d03885ce74f1f6775b3c881a2eeb34dca584e7ab2074cc6f0689fd1f1fb2545e35b979f1fe0aad0bbe31e0a011b\n");
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_to_seed_batch__invoke__passphrase__okay_output)
+{
+    BX_DECLARE_COMMAND(mnemonic_to_seed_batch);
+    command.set_passphrase_option("TREZOR");
+    command.set_sentences_argument({ "legal winner thank year wave sausage worth useful legal winner thank yellow\n" });
+#ifdef WITH_ICU
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("2e8905819b8723fe2c1d161860e5ee1830318dbf49a83bd451cfb8440c28bd6fa457fe1296106559a3c80937a1c1069be3a3a5bd381ee6260e8d9739fce1f607\n");
+#else
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_MNEMONIC_TO_SEED_BATCH_PASSPHRASE_UNSUPPORTED "\n");
+#endif
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
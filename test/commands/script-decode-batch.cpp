@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(script_decode_batch__invoke)
+
+#define SCRIPT_DECODE_BATCH_SCRIPTS \
+"76a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac\n" \
+"\n" \
+"  a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7387\r\n" \
+"512102aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa2103bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb52ae\n" \
+"6a0568656c6c6f\n" \
+"04cf2e5b02d6f02340f5a9defbbf710c388b8451c82145b1419fe9696837b1cdefc569a2a79baa6da2f747c3b25a102a081dfd5e799abc41262103e0d17114770b"
+
+#define SCRIPT_DECODE_BATCH_TEXT \
+"dup hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equalverify checksig\n" \
+"hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equal\n" \
+"1 [02aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa] [03bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb] 2 checkmultisig\n" \
+"return [68656c6c6f]\n" \
+"[cf2e5b02] 0xd6 0xf0 [40f5a9defbbf710c388b8451c82145b1419fe9696837b1cdefc569a2a79baa6da2f747] 0xc3 nop3 10 [2a081dfd5e799abc41262103e0d17114] nip <invalid>\n"
+
+#define SCRIPT_DECODE_BATCH_PATTERN_TEXT \
+"pay_key_hash dup hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equalverify checksig\n" \
+"pay_script_hash hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equal\n" \
+"pay_multisig 1 [02aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa] [03bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb] 2 checkmultisig\n" \
+"null_data return [68656c6c6f]\n" \
+"non_standard [cf2e5b02] 0xd6 0xf0 [40f5a9defbbf710c388b8451c82145b1419fe9696837b1cdefc569a2a79baa6da2f747] 0xc3 nop3 10 [2a081dfd5e799abc41262103e0d17114] nip <invalid>\n"
+
+BOOST_AUTO_TEST_CASE(script_decode_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(script_decode_batch);
+    command.set_base16s_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(script_decode_batch__invoke__scripts__okay_output)
+{
+    BX_DECLARE_COMMAND(script_decode_batch);
+    command.set_base16s_argument({ SCRIPT_DECODE_BATCH_SCRIPTS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(SCRIPT_DECODE_BATCH_TEXT);
+}
+
+BOOST_AUTO_TEST_CASE(script_decode_batch__invoke__pattern__okay_output)
+{
+    BX_DECLARE_COMMAND(script_decode_batch);
+    command.set_pattern_option(true);
+    command.set_base16s_argument({ SCRIPT_DECODE_BATCH_SCRIPTS });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(SCRIPT_DECODE_BATCH_PATTERN_TEXT);
+}
+
+BOOST_AUTO_TEST_CASE(script_decode_batch__invoke__invalid_first_line__failure_error)
+{
+    BX_DECLARE_COMMAND(script_decode_batch);
+    command.set_base16s_argument({ "\n0g\n6a\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The script on line 2 is not valid Base16.\n");
+}
+
+BOOST_AUTO_TEST_CASE(script_decode_batch__invoke__invalid_later_line__failure_preceding_output)
+{
+    BX_DECLARE_COMMAND(script_decode_batch);
+    command.set_base16s_argument({ "6a\n6a0\n6a\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BOOST_REQUIRE_EQUAL(output.str(), "return\n");
+    BOOST_REQUIRE_EQUAL(error.str(), "The script on line 2 is not valid Base16.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(script_encode_batch__invoke)
+
+#define SCRIPT_ENCODE_BATCH_TEXT \
+"dup hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equalverify checksig\n" \
+"\n" \
+"  hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equal\r\n" \
+"1 [02aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa] [03bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb] 2 checkmultisig\n" \
+"return [68656c6c6f]"
+
+#define SCRIPT_ENCODE_BATCH_SCRIPTS \
+"76a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac\n" \
+"a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7387\n" \
+"512102aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa2103bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb52ae\n" \
+"6a0568656c6c6f\n"
+
+BOOST_AUTO_TEST_CASE(script_encode_batch__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(script_encode_batch);
+    command.set_scripts_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(script_encode_batch__invoke__scripts__okay_output)
+{
+    BX_DECLARE_COMMAND(script_encode_batch);
+    command.set_scripts_argument({ SCRIPT_ENCODE_BATCH_TEXT });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(SCRIPT_ENCODE_BATCH_SCRIPTS);
+}
+
+BOOST_AUTO_TEST_CASE(script_encode_batch__invoke__text_token__okay_output)
+{
+    BX_DECLARE_COMMAND(script_encode_batch);
+    command.set_scripts_argument({ "'hello'" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("0568656c6c6f\n");
+}
+
+BOOST_AUTO_TEST_CASE(script_encode_batch__invoke__invalid_line__failure_error)
+{
+    BX_DECLARE_COMMAND(script_encode_batch);
+    command.set_scripts_argument({ "\ndup bogus\nreturn\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The script on line 2 is not valid.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
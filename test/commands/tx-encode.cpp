@@ -18,6 +18,9 @@
  * along with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <fstream>
+#include <string>
+#include <boost/filesystem.hpp>
 #include "command.hpp"
 
 BX_USING_NAMESPACES()
@@ -141,5 +144,112 @@ BOOST_AUTO_TEST_CASE(tx_encode__invoke__one_input_stealth_output_no_filter_versi
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE(tx_encode__invoke__manifest)
+
+#define TX_ENCODE_MANIFEST_CSV \
+"# payout\n" \
+"input,97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3,1\n" \
+"\n" \
+"output,13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe,90000\n"
+
+#define TX_ENCODE_MANIFEST_JSON \
+"{\"hash\": \"97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3\", \"index\": 1}\n" \
+"{\"target\": \"13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe\", \"amount\": 90000}\n"
+
+// A temporary manifest file that is removed when the test completes.
+class manifest_fixture
+{
+public:
+    manifest_fixture(const std::string& contents)
+      : path_(boost::filesystem::temp_directory_path() /
+            boost::filesystem::unique_path("bx-tx-encode-%%%%-%%%%.txt"))
+    {
+        std::ofstream file(path_.string(), std::ios::binary);
+        file << contents;
+    }
+
+    ~manifest_fixture()
+    {
+        boost::system::error_code ignored;
+        boost::filesystem::remove(path_, ignored);
+    }
+
+    std::string path() const
+    {
+        return path_.string();
+    }
+
+private:
+    boost::filesystem::path path_;
+};
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__csv_manifest__okay_output)
+{
+    const manifest_fixture manifest(TX_ENCODE_MANIFEST_CSV);
+    BX_DECLARE_COMMAND(tx_encode);
+    command.set_version_option(1);
+    command.set_script_version_option(5);
+    command.set_manifest_option(manifest.path());
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_ENCODE_TX_BCV1_BASE16 "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__json_manifest__okay_output)
+{
+    const manifest_fixture manifest(TX_ENCODE_MANIFEST_JSON);
+    BX_DECLARE_COMMAND(tx_encode);
+    command.set_version_option(1);
+    command.set_script_version_option(5);
+    command.set_manifest_option(manifest.path());
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_ENCODE_TX_BCV1_BASE16 "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__manifest_following_options__okay_output)
+{
+    const manifest_fixture manifest("output,13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe,90000\n");
+    BX_DECLARE_COMMAND(tx_encode);
+    command.set_version_option(1);
+    command.set_script_version_option(5);
+    command.set_inputs_option({ { TX_ENCODE_INPUT_B } });
+    command.set_manifest_option(manifest.path());
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_ENCODE_TX_BCV1_BASE16 "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__manifest_estimate__okay_output)
+{
+    const manifest_fixture manifest(TX_ENCODE_MANIFEST_CSV);
+    BX_DECLARE_COMMAND(tx_encode);
+    command.set_version_option(1);
+    command.set_script_version_option(5);
+    command.set_estimate_option(true);
+    command.set_fee_rate_option(10);
+    command.set_manifest_option(manifest.path());
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("The signed transaction is at most 193 bytes, for a fee of 1930 satoshi.\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__invalid_manifest_line__failure_error)
+{
+    const manifest_fixture manifest(TX_ENCODE_MANIFEST_CSV "output,13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe\n");
+    BX_DECLARE_COMMAND(tx_encode);
+    command.set_manifest_option(manifest.path());
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("Line 5 of the manifest " + manifest.path() + " is not valid.\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_encode__invoke__missing_manifest__failure_error)
+{
+    const auto path = (boost::filesystem::temp_directory_path() /
+        boost::filesystem::unique_path("bx-tx-encode-%%%%-%%%%.txt")).string();
+    BX_DECLARE_COMMAND(tx_encode);
+    command.set_manifest_option(path);
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The manifest " + path + " cannot be read.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(tx_estimate__invoke)
+
+// Vectors correspond to those of tx-encode.
+#define TX_ESTIMATE_INPUT "97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3:1"
+#define TX_ESTIMATE_OUTPUT "13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe:90000"
+
+BOOST_AUTO_TEST_CASE(tx_estimate__invoke__default_type__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_estimate);
+    command.set_fee_rate_option(10);
+    command.set_script_version_option(5);
+    command.set_inputs_option({ { TX_ESTIMATE_INPUT } });
+    command.set_outputs_option({ { TX_ESTIMATE_OUTPUT } });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "estimate\n"
+        "{\n"
+        "    size 193\n"
+        "    virtual_size 193\n"
+        "    weight 772\n"
+        "    fee 1930\n"
+        "}\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_estimate__invoke__type_per_input__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_estimate);
+    command.set_format_option({ "xml" });
+    command.set_script_version_option(5);
+    command.set_script_types_option({ "p2pkh", "p2sh-p2wpkh" });
+    command.set_inputs_option({ { TX_ESTIMATE_INPUT }, { TX_ESTIMATE_INPUT } });
+    command.set_outputs_option({ { TX_ESTIMATE_OUTPUT } });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+        "<estimate><size>369</size><virtual_size>285</virtual_size><weight>1140</weight><fee>0</fee></estimate>\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_estimate__invoke__type_count_mismatch__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_estimate);
+    command.set_script_types_option({ "p2pkh", "p2pkh" });
+    command.set_inputs_option({ { TX_ESTIMATE_INPUT } });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_TX_ESTIMATE_TYPE_COUNT_MISMATCH "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_estimate__invoke__invalid_type__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_estimate);
+    command.set_script_types_option({ "p2wsh" });
+    command.set_inputs_option({ { TX_ESTIMATE_INPUT } });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The script type p2wsh is not valid.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,133 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+#include <vector>
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(tx_hash__invoke)
+
+// Vector: sx.dyne.org/offlinetx.html
+
+#define TX_HASH_TX_A_BASE16 \
+"0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+#define TX_HASH_TX_A_HASH \
+"39d2caaf112f21364be00c5d0b14e3763468934e586e416bf74647a1906b18e0\n"
+
+#define TX_HASH_TX_B_BASE16 \
+"0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000006a473044022039a36013301597daef41fbe593a02cc513d0b55527ec2df1050e2e8ff49c85c202201035fe810e283bcf394485c6a9dfd117ad9f684cdd83d36453718f5d0491b9dd012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+#define TX_HASH_TX_B_HASH \
+"c3350a915979f8296675115f4e579c2a1aacc08074249584f794e1dfbda3609b\n"
+
+#define TX_HASH_LINES \
+TX_HASH_TX_A_BASE16 "\n" \
+"\n" \
+"  " TX_HASH_TX_B_BASE16 "\r\n" \
+TX_HASH_TX_A_BASE16 "\n"
+
+// Binary transactions, each preceded by its four byte size.
+static data_chunk make_records(const std::vector<std::string>& hexcodes)
+{
+    data_chunk out;
+    for (const auto& hexcode: hexcodes)
+    {
+        data_chunk tx;
+        BOOST_REQUIRE(decode_base16(tx, hexcode));
+        extend_data(out, to_little_endian(static_cast<uint32_t>(tx.size())));
+        extend_data(out, tx);
+    }
+
+    return out;
+}
+
+BOOST_AUTO_TEST_CASE(tx_hash__invoke__empty__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_hash);
+    command.set_transactions_argument({ "" });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(tx_hash__invoke__lines__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_hash);
+    command.set_transactions_argument({ TX_HASH_LINES });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_HASH_TX_A_HASH TX_HASH_TX_B_HASH TX_HASH_TX_A_HASH);
+}
+
+BOOST_AUTO_TEST_CASE(tx_hash__invoke__lines_unique__okay_first_occurrences)
+{
+    BX_DECLARE_COMMAND(tx_hash);
+    command.set_unique_option(true);
+    command.set_transactions_argument({ TX_HASH_LINES });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_HASH_TX_A_HASH TX_HASH_TX_B_HASH);
+}
+
+BOOST_AUTO_TEST_CASE(tx_hash__invoke__binary_unique__okay_first_occurrences)
+{
+    const auto records = make_records(
+    {
+        TX_HASH_TX_B_BASE16, TX_HASH_TX_A_BASE16, TX_HASH_TX_B_BASE16
+    });
+
+    BX_DECLARE_COMMAND(tx_hash);
+    command.set_binary_option(true);
+    command.set_unique_option(true);
+    command.set_transactions_argument({ records });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_HASH_TX_B_HASH TX_HASH_TX_A_HASH);
+}
+
+BOOST_AUTO_TEST_CASE(tx_hash__invoke__binary_truncated__failure_error)
+{
+    auto records = make_records({ TX_HASH_TX_A_BASE16, TX_HASH_TX_B_BASE16 });
+    records.pop_back();
+
+    BX_DECLARE_COMMAND(tx_hash);
+    command.set_binary_option(true);
+    command.set_transactions_argument({ records });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The transaction in record 2 is not valid.\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_hash__invoke__trailing_bytes__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_hash);
+    command.set_transactions_argument({ TX_HASH_TX_A_BASE16 "\n\n"
+        TX_HASH_TX_A_BASE16 "00\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The transaction on line 3 is not valid.\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_hash__invoke__invalid_line__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_hash);
+    command.set_transactions_argument({ TX_HASH_TX_A_BASE16 "\n0g\n" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The transaction on line 2 is not valid Base16.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
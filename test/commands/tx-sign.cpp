@@ -21,14 +21,109 @@
 
 BX_USING_NAMESPACES()
 
-BOOST_AUTO_TEST_SUITE(stub)
+BOOST_AUTO_TEST_SUITE(offline)
 BOOST_AUTO_TEST_SUITE(tx_sign__invoke)
 
-BOOST_AUTO_TEST_CASE(tx_sign__invoke__always__failure_error)
+// Vectors correspond to those of input-sign.
+#define TX_SIGN_PRIVATE_KEY_A "ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333"
+#define TX_SIGN_PRIVATE_KEY_B "0000000000000000000000000000000000000000000000000000000000000001"
+#define TX_SIGN_PREVOUT_A "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig"
+#define TX_SIGN_PREVOUT_UNCOMPRESSED_A "dup hash160 [e60921dbfe1e066113f1c6e0ea15517234187d47] equalverify checksig"
+#define TX_SIGN_PREVOUT_NULL_DATA "return [42]"
+
+// One input, one output.
+#define TX_SIGN_TX_A "0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+#define TX_SIGN_SIGNED_TX_A "0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000006a473044022016516aabd04d3b27bec799bbadc55bad447db1e4bb663a32ed8ff6c6b7b6752602203651316e363b8c41c1b9db050690c6e5e9540ad04ded69184e710197734d3cf6012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+
+// One input, one output, spending from the uncompressed key address.
+#define TX_SIGN_SIGNED_TX_UNCOMPRESSED_A "0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000008b483045022100e30deeb719767aabf333da7f09d44101c1e73b9f43cfb470d86440fd62bc13b102204615a87dfba0bc1070e652af06cda3176ac617465c03f3fb37ac785ff47039cf014104c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0adb73f303ae1682415253f4411777224ab477ad098347ddb7e0b94d49261e613ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+
+// Two inputs, one output, both spending from the same address.
+#define TX_SIGN_TX_B "0100000002b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffffb3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970000000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+#define TX_SIGN_SIGNED_TX_B "0100000002b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000006a47304402204bf8e21a665bcb8792e8e305bc4010590923c7be40fcebf82d08c6b2bfc21e9c02205a04372602e4a34f72f84c284bf6ee809406d41a0ac79e2bb9152c4ebd320052012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffffb3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097000000006a473044022007549a44bc58c1accafdf316068f59a145b23232f181d8621c9e4c9ed005340502207ad0a80ebfe71215da5ca67c57f25ed5f4b86ad8f31fa27a4f1cb09433e1791d012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+
+BOOST_AUTO_TEST_CASE(tx_sign__invoke__single_input__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_sign);
+    command.set_sign_type_option({ "all" });
+    command.set_keys_option({ { TX_SIGN_PRIVATE_KEY_A } });
+    command.set_prevouts_option({ { TX_SIGN_PREVOUT_A } });
+    command.set_transaction_argument({ TX_SIGN_TX_A });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_SIGN_SIGNED_TX_A "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_sign__invoke__uncompressed_key__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_sign);
+    command.set_sign_type_option({ "all" });
+    command.set_keys_option({ { TX_SIGN_PRIVATE_KEY_A } });
+    command.set_prevouts_option({ { TX_SIGN_PREVOUT_UNCOMPRESSED_A } });
+    command.set_transaction_argument({ TX_SIGN_TX_A });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_SIGN_SIGNED_TX_UNCOMPRESSED_A "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_sign__invoke__two_inputs_single_key__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_sign);
+    command.set_sign_type_option({ "all" });
+    command.set_keys_option({ { TX_SIGN_PRIVATE_KEY_A } });
+    command.set_prevouts_option({ { TX_SIGN_PREVOUT_A } });
+    command.set_transaction_argument({ TX_SIGN_TX_B });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_SIGN_SIGNED_TX_B "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_sign__invoke__two_inputs_key_per_input_one_thread__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_sign);
+    command.set_threads_option(1);
+    command.set_sign_type_option({ "all" });
+    command.set_keys_option({ { TX_SIGN_PRIVATE_KEY_A }, { TX_SIGN_PRIVATE_KEY_A } });
+    command.set_prevouts_option({ { TX_SIGN_PREVOUT_A }, { TX_SIGN_PREVOUT_A } });
+    command.set_transaction_argument({ TX_SIGN_TX_B });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(TX_SIGN_SIGNED_TX_B "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_sign__invoke__no_keys__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_sign);
+    command.set_prevouts_option({ { TX_SIGN_PREVOUT_A } });
+    command.set_transaction_argument({ TX_SIGN_TX_A });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_TX_SIGN_KEY_COUNT_MISMATCH "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_sign__invoke__prevout_count_mismatch__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_sign);
+    command.set_keys_option({ { TX_SIGN_PRIVATE_KEY_A } });
+    command.set_prevouts_option({ { TX_SIGN_PREVOUT_A }, { TX_SIGN_PREVOUT_A }, { TX_SIGN_PREVOUT_A } });
+    command.set_transaction_argument({ TX_SIGN_TX_B });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_TX_SIGN_PREVOUT_COUNT_MISMATCH "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_sign__invoke__wrong_key__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_sign);
+    command.set_keys_option({ { TX_SIGN_PRIVATE_KEY_B } });
+    command.set_prevouts_option({ { TX_SIGN_PREVOUT_A } });
+    command.set_transaction_argument({ TX_SIGN_TX_A });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The key for input 0 does not correspond to its previous output script.\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_sign__invoke__unsupported_prevout__failure_error)
 {
     BX_DECLARE_COMMAND(tx_sign);
+    command.set_keys_option({ { TX_SIGN_PRIVATE_KEY_A } });
+    command.set_prevouts_option({ { TX_SIGN_PREVOUT_NULL_DATA } });
+    command.set_transaction_argument({ TX_SIGN_TX_A });
     BX_REQUIRE_FAILURE(command.invoke(output, error));
-    BX_REQUIRE_ERROR(BX_TX_SIGN_NOT_IMPLEMENTED "\n");
+    BX_REQUIRE_ERROR("The previous output script for input 0 is not pay-to-public-key or pay-to-public-key-hash.\n");
 }
 
 BOOST_AUTO_TEST_SUITE_END()
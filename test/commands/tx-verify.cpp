@@ -0,0 +1,107 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(tx_verify__invoke)
+
+// Vectors correspond to those of tx-sign.
+#define TX_VERIFY_PREVOUT_A "dup hash160 [88350574280395ad2c3e2ee20e322073d94e5e40] equalverify checksig"
+#define TX_VERIFY_PREVOUT_OTHER "dup hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equalverify checksig"
+#define TX_VERIFY_UNSIGNED_TX_A "0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+#define TX_VERIFY_SIGNED_TX_A "0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000006a473044022016516aabd04d3b27bec799bbadc55bad447db1e4bb663a32ed8ff6c6b7b6752602203651316e363b8c41c1b9db050690c6e5e9540ad04ded69184e710197734d3cf6012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+#define TX_VERIFY_SIGNED_TX_B "0100000002b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000006a47304402204bf8e21a665bcb8792e8e305bc4010590923c7be40fcebf82d08c6b2bfc21e9c02205a04372602e4a34f72f84c284bf6ee809406d41a0ac79e2bb9152c4ebd320052012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffffb3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097000000006a473044022007549a44bc58c1accafdf316068f59a145b23232f181d8621c9e4c9ed005340502207ad0a80ebfe71215da5ca67c57f25ed5f4b86ad8f31fa27a4f1cb09433e1791d012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+
+BOOST_AUTO_TEST_CASE(tx_verify__invoke__signed_single_input__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_verify);
+    command.set_amounts_option({ 100000 });
+    command.set_prevouts_option({ { TX_VERIFY_PREVOUT_A } });
+    command.set_transaction_argument({ TX_VERIFY_SIGNED_TX_A });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("Input 0 is valid, 4 operations.\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_verify__invoke__signed_two_inputs_one_thread__okay_output)
+{
+    BX_DECLARE_COMMAND(tx_verify);
+    command.set_threads_option(1);
+    command.set_rules_option({ "bip16", "bip66" });
+    command.set_prevouts_option({ { TX_VERIFY_PREVOUT_A }, { TX_VERIFY_PREVOUT_A } });
+    command.set_transaction_argument({ TX_VERIFY_SIGNED_TX_B });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "Input 0 is valid, 4 operations.\n"
+        "Input 1 is valid, 4 operations.\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_verify__invoke__unsigned__invalid_output)
+{
+    BX_DECLARE_COMMAND(tx_verify);
+    command.set_prevouts_option({ { TX_VERIFY_PREVOUT_A } });
+    command.set_transaction_argument({ TX_VERIFY_UNSIGNED_TX_A });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("Input 0 is not valid, 4 operations.\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_verify__invoke__other_prevout__invalid_output)
+{
+    BX_DECLARE_COMMAND(tx_verify);
+    command.set_prevouts_option({ { TX_VERIFY_PREVOUT_A }, { TX_VERIFY_PREVOUT_OTHER } });
+    command.set_transaction_argument({ TX_VERIFY_SIGNED_TX_B });
+    BX_REQUIRE_INVALID(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(
+        "Input 0 is valid, 4 operations.\n"
+        "Input 1 is not valid, 4 operations.\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_verify__invoke__no_prevouts__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_verify);
+    command.set_transaction_argument({ TX_VERIFY_SIGNED_TX_A });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_TX_VERIFY_PREVOUT_COUNT_MISMATCH "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_verify__invoke__amount_count_mismatch__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_verify);
+    command.set_amounts_option({ 1, 2, 3 });
+    command.set_prevouts_option({ { TX_VERIFY_PREVOUT_A } });
+    command.set_transaction_argument({ TX_VERIFY_SIGNED_TX_B });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_TX_VERIFY_AMOUNT_COUNT_MISMATCH "\n");
+}
+
+BOOST_AUTO_TEST_CASE(tx_verify__invoke__unknown_rule__failure_error)
+{
+    BX_DECLARE_COMMAND(tx_verify);
+    command.set_rules_option({ "bip99" });
+    command.set_prevouts_option({ { TX_VERIFY_PREVOUT_A } });
+    command.set_transaction_argument({ TX_VERIFY_SIGNED_TX_A });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR("The rule bip99 is not known.\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
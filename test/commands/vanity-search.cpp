@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "command.hpp"
+
+BX_USING_NAMESPACES()
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(vanity_search__invoke)
+
+// The seed derives the key 8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddb9c8.
+#define VANITY_SEARCH_SEED "baadf00dbaadf00dbaadf00dbaadf00d"
+
+#define VANITY_SEARCH_1J_INFO \
+"key\n" \
+"{\n" \
+"    address 1JLKXzmHadsViSrZ2XQL6J3ariPUQtCPFa\n" \
+"    offset 17\n" \
+"    private_key 8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddb9d9\n" \
+"}\n"
+
+#define VANITY_SEARCH_11_INFO \
+"key\n" \
+"{\n" \
+"    address 113Brp86C56hKgTSJUxvtWuJpvSwokftej\n" \
+"    offset 71\n" \
+"    private_key 8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddba0f\n" \
+"}\n"
+
+#define VANITY_SEARCH_1bx_INFO \
+"key\n" \
+"{\n" \
+"    address 1bxEnJXRtXQrssAn2joJKAePyPyoT9Pg1\n" \
+"    offset 1875\n" \
+"    private_key 8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddc11b\n" \
+"}\n"
+
+#define VANITY_SEARCH_1BX_INFO \
+"key\n" \
+"{\n" \
+"    address 1BXHprg6Gr3C8Yesehq2xq8oMXvSVRnET9\n" \
+"    offset 1908\n" \
+"    private_key 8ed1d17dabce1fccbbe5e9bf008b318334e5bcc78eb9e7c1ea850b7eb0ddc13c\n" \
+"}\n"
+
+BOOST_AUTO_TEST_CASE(vanity_search__invoke__1J__okay_output)
+{
+    BX_DECLARE_COMMAND(vanity_search);
+    command.set_format_option({ encoding_engine::info });
+    command.set_threads_option(1);
+    command.set_prefix_argument("1J");
+    command.set_seed_argument({ VANITY_SEARCH_SEED });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(VANITY_SEARCH_1J_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__invoke__leading_zeros__okay_output)
+{
+    BX_DECLARE_COMMAND(vanity_search);
+    command.set_format_option({ encoding_engine::info });
+    command.set_threads_option(1);
+    command.set_prefix_argument("11");
+    command.set_seed_argument({ VANITY_SEARCH_SEED });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(VANITY_SEARCH_11_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__invoke__case_sensitive__okay_output)
+{
+    BX_DECLARE_COMMAND(vanity_search);
+    command.set_format_option({ encoding_engine::info });
+    command.set_threads_option(1);
+    command.set_prefix_argument("1BX");
+    command.set_seed_argument({ VANITY_SEARCH_SEED });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(VANITY_SEARCH_1BX_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__invoke__within_limit__okay_output)
+{
+    BX_DECLARE_COMMAND(vanity_search);
+    command.set_format_option({ encoding_engine::info });
+    command.set_limit_option(2000);
+    command.set_threads_option(1);
+    command.set_prefix_argument("1bx");
+    command.set_seed_argument({ VANITY_SEARCH_SEED });
+    BX_REQUIRE_OKAY(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT(VANITY_SEARCH_1bx_INFO);
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__invoke__beyond_limit__failure)
+{
+    BX_DECLARE_COMMAND(vanity_search);
+    command.set_limit_option(1875);
+    command.set_threads_option(1);
+    command.set_prefix_argument("1bx");
+    command.set_seed_argument({ VANITY_SEARCH_SEED });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_OUTPUT("");
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__invoke__other_version__failure_error)
+{
+    BX_DECLARE_COMMAND(vanity_search);
+    command.set_prefix_argument("3");
+    command.set_seed_argument({ VANITY_SEARCH_SEED });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_VANITY_SEARCH_INVALID_PREFIX "\n");
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__invoke__invalid_character__failure_error)
+{
+    BX_DECLARE_COMMAND(vanity_search);
+    command.set_prefix_argument("1l");
+    command.set_seed_argument({ VANITY_SEARCH_SEED });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_VANITY_SEARCH_INVALID_PREFIX "\n");
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__invoke__testnet_version__failure_error)
+{
+    BX_DECLARE_COMMAND(vanity_search);
+    command.set_version_option(111);
+    command.set_prefix_argument("1");
+    command.set_seed_argument({ VANITY_SEARCH_SEED });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_VANITY_SEARCH_INVALID_PREFIX "\n");
+}
+
+BOOST_AUTO_TEST_CASE(vanity_search__invoke__64_bit_seed__failure_error)
+{
+    BX_DECLARE_COMMAND(vanity_search);
+    command.set_prefix_argument("1");
+    command.set_seed_argument({ "baadf00dbaadf00d" });
+    BX_REQUIRE_FAILURE(command.invoke(output, error));
+    BX_REQUIRE_ERROR(BX_VANITY_SEARCH_SHORT_SEED "\n");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,102 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <sstream>
+#include <string>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer::config;
+
+#define TRANSACTION_A_BASE16 \
+"0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee0970100000000ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"
+
+BOOST_AUTO_TEST_SUITE(config)
+BOOST_AUTO_TEST_SUITE(config__transaction)
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__base16__round_trips)
+{
+    std::stringstream output;
+    output << transaction(TRANSACTION_A_BASE16);
+    BOOST_REQUIRE_EQUAL(output.str(), TRANSACTION_A_BASE16);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__upper_case_base16__round_trips)
+{
+    const auto upper = boost::to_upper_copy(std::string(TRANSACTION_A_BASE16));
+
+    std::stringstream output;
+    output << transaction(upper);
+    BOOST_REQUIRE_EQUAL(output.str(), TRANSACTION_A_BASE16);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__odd_length__throws)
+{
+    const std::string hexcode(TRANSACTION_A_BASE16);
+    BOOST_REQUIRE_THROW(transaction(hexcode.substr(1)), po::error);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__constructor__invalid_character__throws)
+{
+    std::string hexcode(TRANSACTION_A_BASE16);
+    hexcode[10] = 'g';
+    BOOST_REQUIRE_THROW(transaction(hexcode), po::error);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__valid__true)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, TRANSACTION_A_BASE16));
+
+    transaction instance;
+    BOOST_REQUIRE(instance.from_data(data));
+
+    std::stringstream output;
+    output << instance;
+    BOOST_REQUIRE_EQUAL(output.str(), TRANSACTION_A_BASE16);
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_data__truncated__false)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, TRANSACTION_A_BASE16));
+    data.resize(data.size() - 1);
+
+    transaction instance;
+    BOOST_REQUIRE(!instance.from_data(data));
+}
+
+BOOST_AUTO_TEST_CASE(transaction__from_binary__stream__true)
+{
+    data_chunk data;
+    BOOST_REQUIRE(decode_base16(data, TRANSACTION_A_BASE16));
+    std::stringstream input(std::string(data.begin(), data.end()));
+
+    transaction instance;
+    BOOST_REQUIRE(instance.from_binary(input));
+
+    std::stringstream output;
+    output << instance;
+    BOOST_REQUIRE_EQUAL(output.str(), TRANSACTION_A_BASE16);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,94 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Uniform hashes, as transaction hashes are.
+static hash_digest make_hash(uint32_t value)
+{
+    return sha256_hash(to_chunk(to_little_endian(value)));
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(cuckoo_filter__insert)
+
+BOOST_AUTO_TEST_CASE(cuckoo_filter__insert__empty__true_contains)
+{
+    cuckoo_filter filter(10);
+    BOOST_REQUIRE(!filter.contains(make_hash(1)));
+    BOOST_REQUIRE(filter.insert(make_hash(1)));
+    BOOST_REQUIRE(filter.contains(make_hash(1)));
+    BOOST_REQUIRE(!filter.contains(make_hash(2)));
+    BOOST_REQUIRE_EQUAL(filter.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(cuckoo_filter__insert__duplicate__false_unchanged)
+{
+    cuckoo_filter filter(10);
+    BOOST_REQUIRE(filter.insert(make_hash(1)));
+    BOOST_REQUIRE(!filter.insert(make_hash(1)));
+    BOOST_REQUIRE_EQUAL(filter.size(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(cuckoo_filter__insert__zero_fingerprint__contains)
+{
+    cuckoo_filter filter(10);
+    const hash_digest zero{ { 0 } };
+    BOOST_REQUIRE(filter.insert(zero));
+    BOOST_REQUIRE(filter.contains(zero));
+    BOOST_REQUIRE(!filter.insert(zero));
+}
+
+BOOST_AUTO_TEST_CASE(cuckoo_filter__insert__capacity__all_distinct)
+{
+    const size_t count = 100000;
+    cuckoo_filter filter(count);
+
+    for (uint32_t value = 0; value < count; ++value)
+        BOOST_REQUIRE(filter.insert(make_hash(value)));
+
+    for (uint32_t value = 0; value < count; ++value)
+        BOOST_REQUIRE(!filter.insert(make_hash(value)));
+
+    BOOST_REQUIRE_EQUAL(filter.size(), count);
+}
+
+BOOST_AUTO_TEST_CASE(cuckoo_filter__insert__over_capacity__no_misses)
+{
+    const size_t count = 1000;
+    cuckoo_filter filter(1);
+
+    for (uint32_t value = 0; value < count; ++value)
+        BOOST_REQUIRE(filter.insert(make_hash(value)));
+
+    for (uint32_t value = 0; value < count; ++value)
+        BOOST_REQUIRE(filter.contains(make_hash(value)));
+
+    BOOST_REQUIRE_EQUAL(filter.size(), count);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
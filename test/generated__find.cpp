@@ -34,6 +34,11 @@ BOOST_AUTO_TEST_CASE(generated__find__address_decode__returns_object)
     BOOST_REQUIRE(find("address-decode") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__address_decode_batch__returns_object)
+{
+    BOOST_REQUIRE(find("address-decode-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__address_embed__returns_object)
 {
     BOOST_REQUIRE(find("address-embed") != nullptr);
@@ -94,6 +99,11 @@ BOOST_AUTO_TEST_CASE(generated__find__bitcoin256__returns_object)
     BOOST_REQUIRE(find("bitcoin256") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__block_decode__returns_object)
+{
+    BOOST_REQUIRE(find("block-decode") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__btc_to_satoshi__returns_object)
 {
     BOOST_REQUIRE(find("btc-to-satoshi") != nullptr);
@@ -109,6 +119,16 @@ BOOST_AUTO_TEST_CASE(generated__find__cert_public__returns_object)
     BOOST_REQUIRE(find("cert-public") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__chain_index__returns_object)
+{
+    BOOST_REQUIRE(find("chain-index") != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(generated__find__chain_scan__returns_object)
+{
+    BOOST_REQUIRE(find("chain-scan") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__ec_add__returns_object)
 {
     BOOST_REQUIRE(find("ec-add") != nullptr);
@@ -124,6 +144,11 @@ BOOST_AUTO_TEST_CASE(generated__find__ec_multiply__returns_object)
     BOOST_REQUIRE(find("ec-multiply") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__ec_multiply_batch__returns_object)
+{
+    BOOST_REQUIRE(find("ec-multiply-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__ec_multiply_secrets__returns_object)
 {
     BOOST_REQUIRE(find("ec-multiply-secrets") != nullptr);
@@ -139,16 +164,31 @@ BOOST_AUTO_TEST_CASE(generated__find__ec_to_address__returns_object)
     BOOST_REQUIRE(find("ec-to-address") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__ec_to_address_batch__returns_object)
+{
+    BOOST_REQUIRE(find("ec-to-address-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__ec_to_ek__returns_object)
 {
     BOOST_REQUIRE(find("ec-to-ek") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__ec_to_ek_batch__returns_object)
+{
+    BOOST_REQUIRE(find("ec-to-ek-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__ec_to_public__returns_object)
 {
     BOOST_REQUIRE(find("ec-to-public") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__ec_to_public_batch__returns_object)
+{
+    BOOST_REQUIRE(find("ec-to-public-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__ec_to_wif__returns_object)
 {
     BOOST_REQUIRE(find("ec-to-wif") != nullptr);
@@ -164,6 +204,11 @@ BOOST_AUTO_TEST_CASE(generated__find__ek_new__returns_object)
     BOOST_REQUIRE(find("ek-new") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__ek_new_batch__returns_object)
+{
+    BOOST_REQUIRE(find("ek-new-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__ek_public__returns_object)
 {
     BOOST_REQUIRE(find("ek-public") != nullptr);
@@ -189,6 +234,11 @@ BOOST_AUTO_TEST_CASE(generated__find__ek_to_ec__returns_object)
     BOOST_REQUIRE(find("ek-to-ec") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__ek_to_ec_batch__returns_object)
+{
+    BOOST_REQUIRE(find("ek-to-ec-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__fetch_balance__returns_object)
 {
     BOOST_REQUIRE(find("fetch-balance") != nullptr);
@@ -234,6 +284,11 @@ BOOST_AUTO_TEST_CASE(generated__find__fetch_utxo__returns_object)
     BOOST_REQUIRE(find("fetch-utxo") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__hash_batch__returns_object)
+{
+    BOOST_REQUIRE(find("hash-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__hd_new__returns_object)
 {
     BOOST_REQUIRE(find("hd-new") != nullptr);
@@ -289,6 +344,26 @@ BOOST_AUTO_TEST_CASE(generated__find__input_validate__returns_object)
     BOOST_REQUIRE(find("input-validate") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__key_manifest__returns_object)
+{
+    BOOST_REQUIRE(find("key-manifest") != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(generated__find__merkle_proof__returns_object)
+{
+    BOOST_REQUIRE(find("merkle-proof") != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(generated__find__merkle_root__returns_object)
+{
+    BOOST_REQUIRE(find("merkle-root") != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(generated__find__merkle_verify__returns_object)
+{
+    BOOST_REQUIRE(find("merkle-verify") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__message_sign__returns_object)
 {
     BOOST_REQUIRE(find("message-sign") != nullptr);
@@ -299,6 +374,11 @@ BOOST_AUTO_TEST_CASE(generated__find__message_validate__returns_object)
     BOOST_REQUIRE(find("message-validate") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__message_validate_batch__returns_object)
+{
+    BOOST_REQUIRE(find("message-validate-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__mnemonic_decode__returns_object)
 {
     BOOST_REQUIRE(find("mnemonic-decode") != nullptr);
@@ -314,11 +394,21 @@ BOOST_AUTO_TEST_CASE(generated__find__mnemonic_new__returns_object)
     BOOST_REQUIRE(find("mnemonic-new") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__mnemonic_recover__returns_object)
+{
+    BOOST_REQUIRE(find("mnemonic-recover") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__mnemonic_to_seed__returns_object)
 {
     BOOST_REQUIRE(find("mnemonic-to-seed") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__mnemonic_to_seed_batch__returns_object)
+{
+    BOOST_REQUIRE(find("mnemonic-to-seed-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__qrcode__returns_object)
 {
     BOOST_REQUIRE(find("qrcode") != nullptr);
@@ -339,11 +429,21 @@ BOOST_AUTO_TEST_CASE(generated__find__script_decode__returns_object)
     BOOST_REQUIRE(find("script-decode") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__script_decode_batch__returns_object)
+{
+    BOOST_REQUIRE(find("script-decode-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__script_encode__returns_object)
 {
     BOOST_REQUIRE(find("script-encode") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__script_encode_batch__returns_object)
+{
+    BOOST_REQUIRE(find("script-encode-batch") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__script_to_address__returns_object)
 {
     BOOST_REQUIRE(find("script-to-address") != nullptr);
@@ -419,6 +519,11 @@ BOOST_AUTO_TEST_CASE(generated__find__token_new__returns_object)
     BOOST_REQUIRE(find("token-new") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__tx_ancestors__returns_object)
+{
+    BOOST_REQUIRE(find("tx-ancestors") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__tx_decode__returns_object)
 {
     BOOST_REQUIRE(find("tx-decode") != nullptr);
@@ -429,11 +534,26 @@ BOOST_AUTO_TEST_CASE(generated__find__tx_encode__returns_object)
     BOOST_REQUIRE(find("tx-encode") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__tx_estimate__returns_object)
+{
+    BOOST_REQUIRE(find("tx-estimate") != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(generated__find__tx_hash__returns_object)
+{
+    BOOST_REQUIRE(find("tx-hash") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__tx_sign__returns_object)
 {
     BOOST_REQUIRE(find("tx-sign") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__tx_verify__returns_object)
+{
+    BOOST_REQUIRE(find("tx-verify") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__uri_decode__returns_object)
 {
     BOOST_REQUIRE(find("uri-decode") != nullptr);
@@ -449,6 +569,11 @@ BOOST_AUTO_TEST_CASE(generated__find__validate_tx__returns_object)
     BOOST_REQUIRE(find("validate-tx") != nullptr);
 }
 
+BOOST_AUTO_TEST_CASE(generated__find__vanity_search__returns_object)
+{
+    BOOST_REQUIRE(find("vanity-search") != nullptr);
+}
+
 BOOST_AUTO_TEST_CASE(generated__find__watch_address__returns_object)
 {
     BOOST_REQUIRE(find("watch-address") != nullptr);
@@ -34,6 +34,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__address_decode__returns_expected_value)
     BOOST_REQUIRE_EQUAL(address_decode::symbol(), "address-decode");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__address_decode_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(address_decode_batch::symbol(), "address-decode-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__address_embed__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(address_embed::symbol(), "address-embed");
@@ -94,6 +99,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__bitcoin256__returns_expected_value)
     BOOST_REQUIRE_EQUAL(bitcoin256::symbol(), "bitcoin256");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__block_decode__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(block_decode::symbol(), "block-decode");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__btc_to_satoshi__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(btc_to_satoshi::symbol(), "btc-to-satoshi");
@@ -109,6 +119,16 @@ BOOST_AUTO_TEST_CASE(generated__symbol__cert_public__returns_expected_value)
     BOOST_REQUIRE_EQUAL(cert_public::symbol(), "cert-public");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__chain_index__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(chain_index::symbol(), "chain-index");
+}
+
+BOOST_AUTO_TEST_CASE(generated__symbol__chain_scan__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(chain_scan::symbol(), "chain-scan");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__ec_add__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(ec_add::symbol(), "ec-add");
@@ -124,6 +144,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__ec_multiply__returns_expected_value)
     BOOST_REQUIRE_EQUAL(ec_multiply::symbol(), "ec-multiply");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__ec_multiply_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(ec_multiply_batch::symbol(), "ec-multiply-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__ec_multiply_secrets__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(ec_multiply_secrets::symbol(), "ec-multiply-secrets");
@@ -139,16 +164,31 @@ BOOST_AUTO_TEST_CASE(generated__symbol__ec_to_address__returns_expected_value)
     BOOST_REQUIRE_EQUAL(ec_to_address::symbol(), "ec-to-address");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__ec_to_address_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(ec_to_address_batch::symbol(), "ec-to-address-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__ec_to_ek__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(ec_to_ek::symbol(), "ec-to-ek");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__ec_to_ek_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(ec_to_ek_batch::symbol(), "ec-to-ek-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__ec_to_public__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(ec_to_public::symbol(), "ec-to-public");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__ec_to_public_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(ec_to_public_batch::symbol(), "ec-to-public-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__ec_to_wif__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(ec_to_wif::symbol(), "ec-to-wif");
@@ -164,6 +204,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__ek_new__returns_expected_value)
     BOOST_REQUIRE_EQUAL(ek_new::symbol(), "ek-new");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__ek_new_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(ek_new_batch::symbol(), "ek-new-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__ek_public__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(ek_public::symbol(), "ek-public");
@@ -189,6 +234,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__ek_to_ec__returns_expected_value)
     BOOST_REQUIRE_EQUAL(ek_to_ec::symbol(), "ek-to-ec");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__ek_to_ec_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(ek_to_ec_batch::symbol(), "ek-to-ec-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__fetch_balance__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(fetch_balance::symbol(), "fetch-balance");
@@ -234,6 +284,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__fetch_utxo__returns_expected_value)
     BOOST_REQUIRE_EQUAL(fetch_utxo::symbol(), "fetch-utxo");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__hash_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(hash_batch::symbol(), "hash-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__hd_new__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(hd_new::symbol(), "hd-new");
@@ -289,6 +344,26 @@ BOOST_AUTO_TEST_CASE(generated__symbol__input_validate__returns_expected_value)
     BOOST_REQUIRE_EQUAL(input_validate::symbol(), "input-validate");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__key_manifest__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(key_manifest::symbol(), "key-manifest");
+}
+
+BOOST_AUTO_TEST_CASE(generated__symbol__merkle_proof__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(merkle_proof::symbol(), "merkle-proof");
+}
+
+BOOST_AUTO_TEST_CASE(generated__symbol__merkle_root__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(merkle_root::symbol(), "merkle-root");
+}
+
+BOOST_AUTO_TEST_CASE(generated__symbol__merkle_verify__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(merkle_verify::symbol(), "merkle-verify");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__message_sign__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(message_sign::symbol(), "message-sign");
@@ -299,6 +374,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__message_validate__returns_expected_value
     BOOST_REQUIRE_EQUAL(message_validate::symbol(), "message-validate");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__message_validate_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(message_validate_batch::symbol(), "message-validate-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__mnemonic_decode__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(mnemonic_decode::symbol(), "mnemonic-decode");
@@ -314,11 +394,21 @@ BOOST_AUTO_TEST_CASE(generated__symbol__mnemonic_new__returns_expected_value)
     BOOST_REQUIRE_EQUAL(mnemonic_new::symbol(), "mnemonic-new");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__mnemonic_recover__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(mnemonic_recover::symbol(), "mnemonic-recover");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__mnemonic_to_seed__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(mnemonic_to_seed::symbol(), "mnemonic-to-seed");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__mnemonic_to_seed_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(mnemonic_to_seed_batch::symbol(), "mnemonic-to-seed-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__qrcode__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(qrcode::symbol(), "qrcode");
@@ -339,11 +429,21 @@ BOOST_AUTO_TEST_CASE(generated__symbol__script_decode__returns_expected_value)
     BOOST_REQUIRE_EQUAL(script_decode::symbol(), "script-decode");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__script_decode_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(script_decode_batch::symbol(), "script-decode-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__script_encode__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(script_encode::symbol(), "script-encode");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__script_encode_batch__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(script_encode_batch::symbol(), "script-encode-batch");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__script_to_address__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(script_to_address::symbol(), "script-to-address");
@@ -419,6 +519,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__token_new__returns_expected_value)
     BOOST_REQUIRE_EQUAL(token_new::symbol(), "token-new");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__tx_ancestors__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(tx_ancestors::symbol(), "tx-ancestors");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__tx_decode__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(tx_decode::symbol(), "tx-decode");
@@ -429,11 +534,26 @@ BOOST_AUTO_TEST_CASE(generated__symbol__tx_encode__returns_expected_value)
     BOOST_REQUIRE_EQUAL(tx_encode::symbol(), "tx-encode");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__tx_estimate__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(tx_estimate::symbol(), "tx-estimate");
+}
+
+BOOST_AUTO_TEST_CASE(generated__symbol__tx_hash__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(tx_hash::symbol(), "tx-hash");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__tx_sign__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(tx_sign::symbol(), "tx-sign");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__tx_verify__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(tx_verify::symbol(), "tx-verify");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__uri_decode__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(uri_decode::symbol(), "uri-decode");
@@ -449,6 +569,11 @@ BOOST_AUTO_TEST_CASE(generated__symbol__validate_tx__returns_expected_value)
     BOOST_REQUIRE_EQUAL(validate_tx::symbol(), "validate-tx");
 }
 
+BOOST_AUTO_TEST_CASE(generated__symbol__vanity_search__returns_expected_value)
+{
+    BOOST_REQUIRE_EQUAL(vanity_search::symbol(), "vanity-search");
+}
+
 BOOST_AUTO_TEST_CASE(generated__symbol__watch_address__returns_expected_value)
 {
     BOOST_REQUIRE_EQUAL(watch_address::symbol(), "watch-address");
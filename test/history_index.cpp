@@ -0,0 +1,395 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <boost/filesystem.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::explorer;
+
+// A temporary index directory that is removed when the test completes.
+class index_directory_fixture
+{
+public:
+    index_directory_fixture()
+      : path_(boost::filesystem::temp_directory_path() /
+            boost::filesystem::unique_path("bx-history-index-%%%%-%%%%"))
+    {
+    }
+
+    ~index_directory_fixture()
+    {
+        boost::system::error_code ignored;
+        boost::filesystem::remove_all(path_, ignored);
+    }
+
+    std::string path() const
+    {
+        return path_.string();
+    }
+
+private:
+    boost::filesystem::path path_;
+};
+
+static short_hash make_key(uint8_t seed)
+{
+    auto hash = null_short_hash;
+    hash[0] = seed;
+    return hash;
+}
+
+static output make_output(uint64_t value, uint8_t seed)
+{
+    return output{ value, script{ script::to_pay_key_hash_pattern(
+        make_key(seed)) } };
+}
+
+// The locktime distinguishes the coinbase txs of the same output.
+static transaction make_coinbase(uint32_t tag, uint64_t value, uint8_t seed)
+{
+    const input coinbase{ output_point{ null_hash, max_uint32 }, script{},
+        max_uint32 };
+    return transaction{ 1, tag, { coinbase }, { make_output(value, seed) } };
+}
+
+static transaction make_spend(const hash_digest& hash, uint32_t index,
+    const output::list& outputs)
+{
+    const input spend{ output_point{ hash, index }, script{}, max_uint32 };
+    return transaction{ 1, 0, { spend }, outputs };
+}
+
+static data_chunk make_block(const hash_digest& previous, uint32_t nonce,
+    const transaction::list& txs)
+{
+    const header block_header{ 1, previous, null_hash, 0, 0, nonce };
+    return block{ block_header, txs }.to_data();
+}
+
+static hash_digest block_hash(const data_chunk& block)
+{
+    header parsed;
+    BOOST_REQUIRE(parse_block_header(parsed, block));
+    return parsed.hash();
+}
+
+static std::vector<data_slice> to_records(const std::vector<data_chunk>& blocks)
+{
+    return std::vector<data_slice>(blocks.begin(), blocks.end());
+}
+
+// Copy the files of a directory that are not present in another, ignoring
+// the file of block hashes unless specified.
+static void copy_missing_files(const std::string& from, const std::string& to,
+    bool chain=false)
+{
+    using namespace boost::filesystem;
+    create_directories(to);
+
+    for (directory_iterator it(from); it != directory_iterator(); ++it)
+    {
+        const auto target = path(to) / it->path().filename();
+        if (it->path().filename() == "chain")
+        {
+            if (!chain)
+                continue;
+
+            remove(target);
+        }
+
+        if (!exists(target))
+            copy_file(it->path(), target);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(history_index__append)
+
+BOOST_AUTO_TEST_CASE(history_index__append__missing_directory__empty_history)
+{
+    const index_directory_fixture directory;
+    history_index index(directory.path());
+    BOOST_REQUIRE(index.load());
+    BOOST_REQUIRE_EQUAL(index.blocks(), 0u);
+
+    history::list rows;
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(1))));
+    BOOST_REQUIRE(rows.empty());
+}
+
+BOOST_AUTO_TEST_CASE(history_index__append__unordered_branches__longest_indexed)
+{
+    const index_directory_fixture directory;
+    const auto coinbase0 = make_coinbase(0, 50, 1);
+    const auto genesis = make_block(null_hash, 0, { coinbase0 });
+    const auto spend1 = make_spend(coinbase0.hash(), 0,
+        { make_output(10, 1), make_output(40, 3) });
+    const auto block1 = make_block(block_hash(genesis), 1,
+        { make_coinbase(1, 25, 2), spend1 });
+    const auto fork1 = make_block(block_hash(genesis), 99,
+        { make_coinbase(1, 25, 9) });
+    const auto spend2 = make_spend(spend1.hash(), 0, { make_output(10, 2) });
+    const auto block2 = make_block(block_hash(block1), 2,
+        { make_coinbase(2, 25, 2), spend2 });
+
+    size_t indexed;
+    size_t invalid;
+    history_index index(directory.path());
+    BOOST_REQUIRE(index.load());
+    BOOST_REQUIRE(index.append(indexed, invalid,
+        to_records({ block2, fork1, genesis, block1 }), 2) ==
+        history_index_result::okay);
+    BOOST_REQUIRE_EQUAL(indexed, 3u);
+    BOOST_REQUIRE_EQUAL(index.blocks(), 3u);
+
+    history::list rows;
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(1))));
+    BOOST_REQUIRE_EQUAL(rows.size(), 2u);
+    BOOST_REQUIRE(rows[0].output == output_point(coinbase0.hash(), 0));
+    BOOST_REQUIRE_EQUAL(rows[0].output_height, 0u);
+    BOOST_REQUIRE_EQUAL(rows[0].value, 50u);
+    BOOST_REQUIRE(rows[0].spend == input_point(spend1.hash(), 0));
+    BOOST_REQUIRE_EQUAL(rows[0].spend_height, 1u);
+    BOOST_REQUIRE(rows[1].output == output_point(spend1.hash(), 0));
+    BOOST_REQUIRE_EQUAL(rows[1].output_height, 1u);
+    BOOST_REQUIRE(rows[1].spend == input_point(spend2.hash(), 0));
+    BOOST_REQUIRE_EQUAL(rows[1].spend_height, 2u);
+
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(3))));
+    BOOST_REQUIRE_EQUAL(rows.size(), 1u);
+    BOOST_REQUIRE_EQUAL(rows[0].value, 40u);
+    BOOST_REQUIRE(rows[0].spend.hash() == null_hash);
+
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(9))));
+    BOOST_REQUIRE(rows.empty());
+}
+
+BOOST_AUTO_TEST_CASE(history_index__append__incremental__spends_earlier_run)
+{
+    const index_directory_fixture directory;
+    const auto coinbase0 = make_coinbase(0, 50, 1);
+    const auto genesis = make_block(null_hash, 0, { coinbase0 });
+    const auto spend1 = make_spend(coinbase0.hash(), 0, { make_output(50, 2) });
+    const auto block1 = make_block(block_hash(genesis), 1,
+        { make_coinbase(1, 25, 2), spend1 });
+
+    size_t indexed;
+    size_t invalid;
+    {
+        history_index index(directory.path());
+        BOOST_REQUIRE(index.load());
+        BOOST_REQUIRE(index.append(indexed, invalid, to_records({ genesis })) ==
+            history_index_result::okay);
+        BOOST_REQUIRE_EQUAL(indexed, 1u);
+    }
+
+    history_index index(directory.path());
+    BOOST_REQUIRE(index.load());
+    BOOST_REQUIRE_EQUAL(index.blocks(), 1u);
+    BOOST_REQUIRE(index.append(indexed, invalid,
+        to_records({ genesis, block1, block1 })) ==
+        history_index_result::okay);
+    BOOST_REQUIRE_EQUAL(indexed, 1u);
+    BOOST_REQUIRE_EQUAL(index.blocks(), 2u);
+
+    history::list rows;
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(1))));
+    BOOST_REQUIRE_EQUAL(rows.size(), 1u);
+    BOOST_REQUIRE(rows[0].spend == input_point(spend1.hash(), 0));
+    BOOST_REQUIRE_EQUAL(rows[0].spend_height, 1u);
+
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(2))));
+    BOOST_REQUIRE_EQUAL(rows.size(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(history_index__append__many_runs__merged_history)
+{
+    const index_directory_fixture directory;
+    auto previous = null_hash;
+    size_t indexed;
+    size_t invalid;
+
+    // Each append is a run, so the runs are merged along the way.
+    for (uint32_t height = 0; height < 12; ++height)
+    {
+        const auto block = make_block(previous, height,
+            { make_coinbase(height, 1, 7), make_coinbase(height, 2, 8) });
+        previous = block_hash(block);
+
+        history_index index(directory.path());
+        BOOST_REQUIRE(index.load());
+        BOOST_REQUIRE(index.append(indexed, invalid, to_records({ block }),
+            4) == history_index_result::okay);
+        BOOST_REQUIRE_EQUAL(index.blocks(), height + 1u);
+    }
+
+    history_index index(directory.path());
+    BOOST_REQUIRE(index.load());
+
+    history::list rows;
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(7))));
+    BOOST_REQUIRE_EQUAL(rows.size(), 12u);
+
+    for (uint32_t height = 0; height < 12; ++height)
+        BOOST_REQUIRE_EQUAL(rows[height].output_height, height);
+}
+
+BOOST_AUTO_TEST_CASE(history_index__append__spend_of_merged_run__spent)
+{
+    const index_directory_fixture directory;
+    const auto coinbase0 = make_coinbase(0, 50, 1);
+    auto previous = null_hash;
+    size_t indexed;
+    size_t invalid;
+
+    // The output of the first block is in a merged run when it is spent.
+    for (uint32_t height = 0; height < 6; ++height)
+    {
+        const auto block = make_block(previous, height,
+            { height == 0 ? coinbase0 : make_coinbase(height, 1, 7) });
+        previous = block_hash(block);
+
+        history_index index(directory.path());
+        BOOST_REQUIRE(index.load());
+        BOOST_REQUIRE(index.append(indexed, invalid, to_records({ block })) ==
+            history_index_result::okay);
+    }
+
+    const auto spend6 = make_spend(coinbase0.hash(), 0, { make_output(50, 2) });
+    const auto block6 = make_block(previous, 6,
+        { make_coinbase(6, 1, 7), spend6 });
+
+    history_index index(directory.path());
+    BOOST_REQUIRE(index.load());
+    BOOST_REQUIRE(index.append(indexed, invalid, to_records({ block6 })) ==
+        history_index_result::okay);
+
+    history::list rows;
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(1))));
+    BOOST_REQUIRE_EQUAL(rows.size(), 1u);
+    BOOST_REQUIRE(rows[0].spend == input_point(spend6.hash(), 0));
+    BOOST_REQUIRE_EQUAL(rows[0].spend_height, 6u);
+}
+
+BOOST_AUTO_TEST_CASE(history_index__append__interrupted_append__ignored)
+{
+    const index_directory_fixture directory;
+    const index_directory_fixture saved;
+    const auto coinbase0 = make_coinbase(0, 50, 1);
+    const auto genesis = make_block(null_hash, 0, { coinbase0 });
+    const auto spend1 = make_spend(coinbase0.hash(), 0, { make_output(50, 2) });
+    const auto block1 = make_block(block_hash(genesis), 1,
+        { make_coinbase(1, 25, 2), spend1 });
+
+    size_t indexed;
+    size_t invalid;
+    {
+        history_index index(directory.path());
+        BOOST_REQUIRE(index.load());
+        BOOST_REQUIRE(index.append(indexed, invalid, to_records({ genesis })) ==
+            history_index_result::okay);
+        copy_missing_files(directory.path(), saved.path(), true);
+        BOOST_REQUIRE(index.append(indexed, invalid, to_records({ block1 })) ==
+            history_index_result::okay);
+    }
+
+    // Restoring the block hashes leaves the files of an uncommitted append.
+    copy_missing_files(saved.path(), directory.path(), true);
+
+    history_index index(directory.path());
+    BOOST_REQUIRE(index.load());
+    BOOST_REQUIRE_EQUAL(index.blocks(), 1u);
+
+    history::list rows;
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(1))));
+    BOOST_REQUIRE_EQUAL(rows.size(), 1u);
+    BOOST_REQUIRE(rows[0].spend.hash() == null_hash);
+
+    BOOST_REQUIRE(index.append(indexed, invalid, to_records({ block1 })) ==
+        history_index_result::okay);
+    BOOST_REQUIRE_EQUAL(indexed, 1u);
+
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(1))));
+    BOOST_REQUIRE_EQUAL(rows.size(), 1u);
+    BOOST_REQUIRE(rows[0].spend == input_point(spend1.hash(), 0));
+    BOOST_REQUIRE_EQUAL(rows[0].spend_height, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(history_index__append__interrupted_merge__no_duplicates)
+{
+    const index_directory_fixture directory;
+    const index_directory_fixture saved;
+    auto previous = null_hash;
+    size_t indexed;
+    size_t invalid;
+
+    // The eighth run merges all of the runs, which are then restored.
+    for (uint32_t height = 0; height < 8; ++height)
+    {
+        const auto block = make_block(previous, height,
+            { make_coinbase(height, 1, 7) });
+        previous = block_hash(block);
+
+        if (height == 7)
+            copy_missing_files(directory.path(), saved.path());
+
+        history_index index(directory.path());
+        BOOST_REQUIRE(index.load());
+        BOOST_REQUIRE(index.append(indexed, invalid, to_records({ block })) ==
+            history_index_result::okay);
+    }
+
+    copy_missing_files(saved.path(), directory.path());
+
+    history_index index(directory.path());
+    BOOST_REQUIRE(index.load());
+    BOOST_REQUIRE_EQUAL(index.blocks(), 8u);
+
+    history::list rows;
+    BOOST_REQUIRE(index.history(rows, wallet::payment_address(make_key(7))));
+    BOOST_REQUIRE_EQUAL(rows.size(), 8u);
+}
+
+BOOST_AUTO_TEST_CASE(history_index__append__invalid_block__invalid_unchanged)
+{
+    const index_directory_fixture directory;
+    const auto genesis = make_block(null_hash, 0, { make_coinbase(0, 50, 1) });
+    const data_chunk garbage(10, 0x00);
+
+    size_t indexed;
+    size_t invalid;
+    history_index index(directory.path());
+    BOOST_REQUIRE(index.load());
+    BOOST_REQUIRE(index.append(indexed, invalid,
+        to_records({ genesis, garbage })) ==
+        history_index_result::invalid_block);
+    BOOST_REQUIRE_EQUAL(invalid, 1u);
+    BOOST_REQUIRE_EQUAL(index.blocks(), 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
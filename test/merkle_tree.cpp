@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+#include "benchmark.hpp"
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Distinct leaves, the hashes of their little-endian positions.
+static hash_list make_leaves(size_t count)
+{
+    hash_list leaves(count);
+    for (size_t index = 0; index < count; ++index)
+        leaves[index] = bitcoin_hash(to_chunk(to_little_endian(
+            static_cast<uint32_t>(index))));
+
+    return leaves;
+}
+
+// The merkle root computed one pair at a time, as a reference.
+static hash_digest reference_root(hash_list level)
+{
+    if (level.empty())
+        return null_hash;
+
+    while (level.size() > 1)
+    {
+        if (level.size() % 2 != 0)
+            level.push_back(level.back());
+
+        hash_list next;
+        for (size_t index = 0; index < level.size(); index += 2)
+            next.push_back(bitcoin_hash(build_chunk(
+                { level[index], level[index + 1] })));
+
+        level = next;
+    }
+
+    return level.front();
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(merkle_tree__root)
+
+BOOST_AUTO_TEST_CASE(merkle_tree__root__empty__null_hash)
+{
+    const merkle_tree tree(hash_list{});
+    BOOST_REQUIRE_EQUAL(tree.size(), 0u);
+    BOOST_REQUIRE(tree.root() == null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__root__one_leaf__leaf)
+{
+    const auto leaves = make_leaves(1);
+    const merkle_tree tree(leaves);
+    BOOST_REQUIRE_EQUAL(tree.size(), 1u);
+    BOOST_REQUIRE(tree.root() == leaves.front());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__root__five_leaves__expected)
+{
+    const merkle_tree tree(make_leaves(5));
+    BOOST_REQUIRE_EQUAL(encode_hash(tree.root()), "ac5016e25643b57f6fb3c85a1df73b43e170491d959a7da1e512d93b5732106f");
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__root__odd_and_even_sizes__matches_reference)
+{
+    for (size_t count = 1; count <= 40; ++count)
+    {
+        const auto leaves = make_leaves(count);
+        BOOST_REQUIRE(merkle_tree(leaves).root() == reference_root(leaves));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(merkle_tree__branch)
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch__out_of_range__false)
+{
+    hash_list branch;
+    const merkle_tree tree(make_leaves(3));
+    BOOST_REQUIRE(!tree.branch(branch, 3));
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch__one_leaf__empty)
+{
+    hash_list branch;
+    const merkle_tree tree(make_leaves(1));
+    BOOST_REQUIRE(tree.branch(branch, 0));
+    BOOST_REQUIRE(branch.empty());
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch__every_leaf__branch_root_matches_root)
+{
+    for (size_t count = 1; count <= 17; ++count)
+    {
+        const auto leaves = make_leaves(count);
+        const merkle_tree tree(leaves);
+
+        for (size_t index = 0; index < count; ++index)
+        {
+            hash_list branch;
+            BOOST_REQUIRE(tree.branch(branch, index));
+            BOOST_REQUIRE(merkle_tree::branch_root(leaves[index], branch,
+                index) == tree.root());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(merkle_tree__branch_root__wrong_index__mismatch)
+{
+    const auto leaves = make_leaves(6);
+    const merkle_tree tree(leaves);
+
+    hash_list branch;
+    BOOST_REQUIRE(tree.branch(branch, 2));
+    BOOST_REQUIRE(merkle_tree::branch_root(leaves[2], branch, 3) !=
+        tree.root());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+// The benchmark suite compares the merkle root of the tree and of the pairwise
+// reference on a single thread.
+BOOST_AUTO_TEST_SUITE(benchmark)
+BOOST_AUTO_TEST_SUITE(merkle_tree__benchmark)
+
+BOOST_AUTO_TEST_CASE(merkle_tree__benchmark__root__4000_leaves)
+{
+    constexpr size_t count = 4000;
+    constexpr size_t rounds = 50;
+    const auto leaves = make_leaves(count);
+
+    hash_digest expected;
+    const auto reference_start = benchmark_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        expected = reference_root(leaves);
+
+    const auto reference_time = seconds_since(reference_start);
+
+    hash_digest actual;
+    const auto tree_start = benchmark_clock::now();
+    for (size_t round = 0; round < rounds; ++round)
+        actual = merkle_tree(leaves).root();
+
+    const auto tree_time = seconds_since(tree_start);
+
+    BOOST_REQUIRE(actual == expected);
+    BOOST_TEST_MESSAGE("leaves: " << count << " reference: " <<
+        rounds / reference_time << " roots/s tree: " <<
+        rounds / tree_time << " roots/s");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,193 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+#include "benchmark.hpp"
+
+using namespace bc;
+using namespace bc::explorer;
+using namespace bc::wallet;
+
+// Entropy of distinct values for each of the BIP39 entropy sizes.
+static data_chunk make_entropy(size_t size, size_t seed)
+{
+    data_chunk entropy(size);
+    for (size_t index = 0; index < size; ++index)
+        entropy[index] = static_cast<uint8_t>(seed * 131 + index * 17);
+
+    return entropy;
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(mnemonic_index__validate)
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__validate__created_mnemonics__valid)
+{
+    const auto& index = mnemonic_index::all();
+    for (const auto lexicon: language::all)
+    {
+        for (size_t size = 16; size <= 32; size += 4)
+        {
+            const auto words = create_mnemonic(make_entropy(size, size),
+                *lexicon);
+            BOOST_REQUIRE(index.validate(words, *lexicon));
+            BOOST_REQUIRE(index.validate(words, language::all) != nullptr);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__validate__changed_word__matches_libbitcoin)
+{
+    const auto& index = mnemonic_index::all();
+    for (size_t seed = 0; seed < 64; ++seed)
+    {
+        auto words = create_mnemonic(make_entropy(16, seed), language::en);
+        words[seed % words.size()] = language::en[seed * 31];
+        BOOST_REQUIRE_EQUAL(index.validate(words, language::en),
+            validate_mnemonic(words, language::en));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__validate__wrong_language__invalid)
+{
+    const auto words = create_mnemonic(make_entropy(16, 1), language::en);
+    BOOST_REQUIRE(!mnemonic_index::all().validate(words, language::es));
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__validate__13_words__invalid)
+{
+    auto words = create_mnemonic(make_entropy(16, 1), language::en);
+    words.push_back(language::en[0]);
+    BOOST_REQUIRE(!mnemonic_index::all().validate(words, language::en));
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__validate__unknown_word__invalid)
+{
+    auto words = create_mnemonic(make_entropy(16, 1), language::en);
+    words[0] = "bogus";
+    BOOST_REQUIRE(mnemonic_index::all().validate(words, language::all) ==
+        nullptr);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(mnemonic_index__checksum)
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__checksum__valid_indexes__true)
+{
+    // abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about
+    const std::vector<uint16_t> indexes{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3 };
+    BOOST_REQUIRE(mnemonic_index::checksum(indexes));
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__checksum__invalid_indexes__false)
+{
+    const std::vector<uint16_t> indexes{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    BOOST_REQUIRE(!mnemonic_index::checksum(indexes));
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__checksum__11_indexes__false)
+{
+    const std::vector<uint16_t> indexes{ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3 };
+    BOOST_REQUIRE(!mnemonic_index::checksum(indexes));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(mnemonic_index__find)
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__find__dictionary_words__positions)
+{
+    const word_list words{ language::es[0], language::es[1000], language::es[2047] };
+    std::vector<uint16_t> positions;
+    BOOST_REQUIRE(mnemonic_index::all().find(positions, words, language::es));
+    BOOST_REQUIRE_EQUAL(positions.size(), 3u);
+    BOOST_REQUIRE_EQUAL(positions[0], 0u);
+    BOOST_REQUIRE_EQUAL(positions[1], 1000u);
+    BOOST_REQUIRE_EQUAL(positions[2], 2047u);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__find__other_dictionary__false)
+{
+    const word_list words{ language::en[0] };
+    std::vector<uint16_t> positions;
+    BOOST_REQUIRE(!mnemonic_index::all().find(positions, words, language::ja));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(mnemonic_index__languages)
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__languages__english__en)
+{
+    const auto words = create_mnemonic(make_entropy(16, 2), language::en);
+    const auto languages = mnemonic_index::all().languages(words);
+    BOOST_REQUIRE_EQUAL(languages.size(), 1u);
+    BOOST_REQUIRE(languages.front() == &language::en);
+}
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__languages__unknown_word__empty)
+{
+    const word_list words{ language::en[0], "bogus" };
+    BOOST_REQUIRE(mnemonic_index::all().languages(words).empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+// The benchmark suite compares validation by libbitcoin and by the index in
+// all languages.
+BOOST_AUTO_TEST_SUITE(benchmark)
+BOOST_AUTO_TEST_SUITE(mnemonic_index__benchmark)
+
+BOOST_AUTO_TEST_CASE(mnemonic_index__benchmark__validate_any__1000_mnemonics)
+{
+    const auto& index = mnemonic_index::all();
+    const auto& lexicons = language::all;
+    std::vector<word_list> mnemonics;
+
+    // The last dictionary is the worst case for a search of all languages.
+    for (size_t seed = 0; seed < 1000; ++seed)
+        mnemonics.push_back(create_mnemonic(make_entropy(32, seed),
+            *lexicons.back()));
+
+    const auto library_start = benchmark_clock::now();
+    for (const auto& words: mnemonics)
+        BOOST_REQUIRE(validate_mnemonic(words, lexicons));
+
+    const auto library_time = microseconds_since(library_start);
+
+    const auto index_start = benchmark_clock::now();
+    for (const auto& words: mnemonics)
+        BOOST_REQUIRE(index.validate(words, lexicons) != nullptr);
+
+    const auto index_time = microseconds_since(index_start);
+
+    BOOST_TEST_MESSAGE("library: " << library_time / mnemonics.size() <<
+        "us/mnemonic index: " << index_time / mnemonics.size() <<
+        "us/mnemonic");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,202 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+#include "benchmark.hpp"
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Messages of every length to 200 bytes, spanning the padding boundaries.
+static data_stack make_messages(size_t count)
+{
+    data_stack messages;
+    for (size_t index = 0; index < count; ++index)
+    {
+        data_chunk message(index % 201);
+        for (size_t byte = 0; byte < message.size(); ++byte)
+            message[byte] = static_cast<uint8_t>(index * 31 + byte * 7);
+
+        messages.push_back(message);
+    }
+
+    return messages;
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(multi_sha256__sha256_hash_batch)
+
+BOOST_AUTO_TEST_CASE(multi_sha256__sha256_hash_batch__empty__empty)
+{
+    BOOST_REQUIRE(sha256_hash_batch({}).empty());
+}
+
+BOOST_AUTO_TEST_CASE(multi_sha256__sha256_hash_batch__nist_vectors__expected)
+{
+    const data_stack messages
+    {
+        to_chunk(std::string("")),
+        to_chunk(std::string("abc")),
+        to_chunk(std::string("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"))
+    };
+
+    const auto hashes = sha256_hash_batch(messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), 3u);
+    BOOST_REQUIRE_EQUAL(encode_base16(hashes[0]), "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    BOOST_REQUIRE_EQUAL(encode_base16(hashes[1]), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    BOOST_REQUIRE_EQUAL(encode_base16(hashes[2]), "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+}
+
+BOOST_AUTO_TEST_CASE(multi_sha256__sha256_hash_batch__mixed_lengths__matches_sha256_hash)
+{
+    // Lengths are not ordered, so messages are regrouped across lanes.
+    auto messages = make_messages(3 * 201);
+    std::swap(messages[3], messages[400]);
+    const auto hashes = sha256_hash_batch(messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_REQUIRE(hashes[index] == sha256_hash(messages[index]));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(multi_sha256__bitcoin_hash_batch)
+
+BOOST_AUTO_TEST_CASE(multi_sha256__bitcoin_hash_batch__mixed_lengths__matches_bitcoin_hash)
+{
+    const auto messages = make_messages(219);
+    const auto hashes = bitcoin_hash_batch(messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_REQUIRE(hashes[index] == bitcoin_hash(messages[index]));
+}
+
+BOOST_AUTO_TEST_CASE(multi_sha256__bitcoin_hash_batch__slices__matches_bitcoin_hash)
+{
+    const auto messages = make_messages(219);
+    const std::vector<data_slice> slices(messages.begin(), messages.end());
+    const auto hashes = bitcoin_hash_batch(slices);
+    BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_REQUIRE(hashes[index] == bitcoin_hash(messages[index]));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(multi_sha256__bitcoin_short_hash_batch)
+
+BOOST_AUTO_TEST_CASE(multi_sha256__bitcoin_short_hash_batch__mixed_lengths__matches_bitcoin_short_hash)
+{
+    const auto messages = make_messages(219);
+    const auto hashes = bitcoin_short_hash_batch(messages);
+    BOOST_REQUIRE_EQUAL(hashes.size(), messages.size());
+
+    for (size_t index = 0; index < messages.size(); ++index)
+        BOOST_REQUIRE(hashes[index] == bitcoin_short_hash(messages[index]));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(multi_sha256__bitcoin_hash_pairs)
+
+// Pairs of distinct hashes, spanning more than one group of lanes.
+static hash_list make_pairs(size_t pairs)
+{
+    hash_list hashes(2 * pairs);
+    for (size_t index = 0; index < hashes.size(); ++index)
+        hashes[index] = bitcoin_hash(to_chunk(to_little_endian(
+            static_cast<uint32_t>(index))));
+
+    return hashes;
+}
+
+BOOST_AUTO_TEST_CASE(multi_sha256__bitcoin_hash_pairs__mixed_groups__matches_bitcoin_hash)
+{
+    constexpr size_t pairs = 19;
+    const auto hashes = make_pairs(pairs);
+    hash_list out(pairs);
+    bitcoin_hash_pairs(out.data(), hashes.data(), pairs);
+
+    for (size_t pair = 0; pair < pairs; ++pair)
+    {
+        const auto joined = build_chunk({ hashes[2 * pair], hashes[2 * pair + 1] });
+        BOOST_REQUIRE(out[pair] == bitcoin_hash(joined));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(multi_sha256__bitcoin_hash_pairs__in_place__matches_bitcoin_hash)
+{
+    constexpr size_t pairs = 19;
+    auto hashes = make_pairs(pairs);
+    const auto expected = hashes;
+    bitcoin_hash_pairs(hashes.data(), hashes.data(), pairs);
+
+    for (size_t pair = 0; pair < pairs; ++pair)
+    {
+        const auto joined = build_chunk({ expected[2 * pair], expected[2 * pair + 1] });
+        BOOST_REQUIRE(hashes[pair] == bitcoin_hash(joined));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+// The benchmark suite compares the hash rate of libbitcoin and of the batch
+// on a single thread.
+BOOST_AUTO_TEST_SUITE(benchmark)
+BOOST_AUTO_TEST_SUITE(multi_sha256__benchmark)
+
+BOOST_AUTO_TEST_CASE(multi_sha256__benchmark__bitcoin_hash__32_to_512_bytes)
+{
+    constexpr size_t count = 100000;
+
+    for (size_t size = 32; size <= 512; size *= 4)
+    {
+        const data_stack messages(count, data_chunk(size, 0x42));
+        std::vector<hash_digest> expected(count);
+
+        const auto library_start = benchmark_clock::now();
+        for (size_t index = 0; index < count; ++index)
+            expected[index] = bitcoin_hash(messages[index]);
+
+        const auto library_time = seconds_since(library_start);
+
+        const auto batch_start = benchmark_clock::now();
+        const auto actual = bitcoin_hash_batch(messages);
+        const auto batch_time = seconds_since(batch_start);
+
+        BOOST_REQUIRE(actual == expected);
+        BOOST_TEST_MESSAGE("bytes: " << size << " library: " <<
+            count / library_time << " hashes/s batch: " <<
+            count / batch_time << " hashes/s");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+#include "benchmark.hpp"
+
+using namespace bc;
+using namespace bc::explorer;
+
+// Passwords of distinct lengths, spanning the HMAC key block size.
+static data_stack make_passwords(size_t count)
+{
+    data_stack passwords;
+    for (size_t index = 0; index < count; ++index)
+        passwords.push_back(data_chunk(index * 29, static_cast<uint8_t>(index)));
+
+    return passwords;
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(pbkdf2__pbkdf2_sha512)
+
+BOOST_AUTO_TEST_CASE(pbkdf2__pbkdf2_sha512__one_iteration__expected)
+{
+    const auto key = pbkdf2_sha512(to_chunk(std::string("password")),
+        to_chunk(std::string("salt")), 1);
+    BOOST_REQUIRE_EQUAL(encode_base16(key), "867f70cf1ade02cff3752599a3a53dc4af34c7a669815ae5d513554e1c8cf252c02d470a285a0501bad999bfe943c08f050235d7d68b1da55e63f73b60a57fce");
+}
+
+BOOST_AUTO_TEST_CASE(pbkdf2__pbkdf2_sha512__two_iterations__expected)
+{
+    const auto key = pbkdf2_sha512(to_chunk(std::string("password")),
+        to_chunk(std::string("salt")), 2);
+    BOOST_REQUIRE_EQUAL(encode_base16(key), "e1d9c16aa681708a45f5c7c4e215ceb66e011a2e9f0040713f18aefdb866d53cf76cab2868a39b9f7840edce4fef5a82be67335c77a6068e04112754f27ccf4e");
+}
+
+BOOST_AUTO_TEST_CASE(pbkdf2__pbkdf2_sha512__long_salt__expected)
+{
+    const auto key = pbkdf2_sha512(
+        to_chunk(std::string("passwordPASSWORDpassword")),
+        to_chunk(std::string("saltSALTsaltSALTsaltSALTsaltSALTsalt")), 4096);
+    BOOST_REQUIRE_EQUAL(encode_base16(key), "8c0511f4c6e597c6ac6315d8f0362e225f3c501495ba23b868c005174dc4ee71115b59f9e60cd9532fa33e0f75aefe30225c583a186cd82bd4daea9724a3d3b8");
+}
+
+BOOST_AUTO_TEST_CASE(pbkdf2__pbkdf2_sha512__hashed_key__expected)
+{
+    const auto key = pbkdf2_sha512(to_chunk(std::string(200, 'x')),
+        to_chunk(std::string("mnemonic")), 2048);
+    BOOST_REQUIRE_EQUAL(encode_base16(key), "c24b715a9fcda8d44b596545bb95feaacb6ea1b3c5e0c0b5f696f9defb46df51d7c373fd411c861bc9e9ac79ac271dae6d898724e5618d4d3a404bd2e679fb21");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(pbkdf2__pbkdf2_sha512_batch)
+
+BOOST_AUTO_TEST_CASE(pbkdf2__pbkdf2_sha512_batch__empty__empty)
+{
+    const auto keys = pbkdf2_sha512_batch({}, to_chunk(std::string("salt")), 2);
+    BOOST_REQUIRE(keys.empty());
+}
+
+BOOST_AUTO_TEST_CASE(pbkdf2__pbkdf2_sha512_batch__0_to_9_passwords__expected)
+{
+    const auto salt = to_chunk(std::string("mnemonic"));
+    for (size_t count = 0; count < 10; ++count)
+    {
+        const auto passwords = make_passwords(count);
+        const auto keys = pbkdf2_sha512_batch(passwords, salt, 3);
+        BOOST_REQUIRE_EQUAL(keys.size(), count);
+
+        for (size_t index = 0; index < count; ++index)
+            BOOST_REQUIRE(keys[index] == pkcs5_pbkdf2_hmac_sha512(
+                passwords[index], salt, 3));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+// The benchmark suite compares the derivation rate of libbitcoin and of the
+// batch on a single thread (seeds per second per core).
+BOOST_AUTO_TEST_SUITE(benchmark)
+BOOST_AUTO_TEST_SUITE(pbkdf2__benchmark)
+
+BOOST_AUTO_TEST_CASE(pbkdf2__benchmark__bip39_seeds__64_to_256_sentences)
+{
+    const auto salt = to_chunk(std::string("mnemonic"));
+    const auto sentence = to_chunk(std::string("abandon abandon abandon "
+        "abandon abandon abandon abandon abandon abandon abandon abandon "
+        "about"));
+
+    for (size_t count = 64; count <= 256; count *= 2)
+    {
+        const data_stack sentences(count, sentence);
+        std::vector<long_hash> expected(count);
+
+        const auto library_start = benchmark_clock::now();
+        for (size_t index = 0; index < count; ++index)
+            expected[index] = pkcs5_pbkdf2_hmac_sha512(sentences[index],
+                salt, 2048);
+
+        const auto library_time = seconds_since(library_start);
+
+        const auto batch_start = benchmark_clock::now();
+        const auto actual = pbkdf2_sha512_batch(sentences, salt, 2048);
+        const auto batch_time = seconds_since(batch_start);
+
+        BOOST_REQUIRE(actual == expected);
+        BOOST_TEST_MESSAGE("sentences: " << count << " library: " <<
+            count / library_time << " seeds/s batch: " << count / batch_time <<
+            " seeds/s");
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
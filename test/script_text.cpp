@@ -0,0 +1,204 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+#define SCRIPT_TEXT_PAY_KEY_HASH \
+"76a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac"
+#define SCRIPT_TEXT_PAY_KEY_HASH_TEXT \
+"dup hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equalverify checksig"
+#define SCRIPT_TEXT_PAY_SCRIPT_HASH \
+"a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7387"
+#define SCRIPT_TEXT_PAY_SCRIPT_HASH_TEXT \
+"hash160 [18c0bd8d1818f1bf99cb1df2269c645318ef7b73] equal"
+#define SCRIPT_TEXT_PAY_MULTISIG \
+"512102aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa2103bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb52ae"
+#define SCRIPT_TEXT_PAY_MULTISIG_TEXT \
+"1 [02aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa] [03bbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbbb] 2 checkmultisig"
+#define SCRIPT_TEXT_NULL_DATA \
+"6a0568656c6c6f"
+#define SCRIPT_TEXT_NULL_DATA_TEXT \
+"return [68656c6c6f]"
+#define SCRIPT_TEXT_NON_STANDARD \
+"04cf2e5b02d6f02340f5a9defbbf710c388b8451c82145b1419fe9696837b1cdefc569a2a79baa6da2f747c3b25a102a081dfd5e799abc41262103e0d17114770b"
+#define SCRIPT_TEXT_NON_STANDARD_TEXT \
+"[cf2e5b02] 0xd6 0xf0 [40f5a9defbbf710c388b8451c82145b1419fe9696837b1cdefc569a2a79baa6da2f747] 0xc3 nop3 10 [2a081dfd5e799abc41262103e0d17114] nip <invalid>"
+
+static data_chunk to_script(const std::string& hexcode)
+{
+    data_chunk out;
+    BOOST_REQUIRE(decode_base16(out, hexcode));
+    return out;
+}
+
+static std::string to_text(const std::string& hexcode)
+{
+    std::string out;
+    append_script_text(out, to_script(hexcode));
+    return out;
+}
+
+static bool to_data(std::string& out, const std::string& text)
+{
+    data_chunk script;
+    if (!append_script_data(script, data_slice(to_chunk(text))))
+        return false;
+
+    out = encode_base16(script);
+    return true;
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(script_text__match_standard_script)
+
+BOOST_AUTO_TEST_CASE(script_text__match_standard_script__templates__expected)
+{
+    BOOST_REQUIRE(match_standard_script(to_script(SCRIPT_TEXT_PAY_KEY_HASH)) ==
+        standard_script::pay_key_hash);
+    BOOST_REQUIRE(match_standard_script(to_script(SCRIPT_TEXT_PAY_SCRIPT_HASH)) ==
+        standard_script::pay_script_hash);
+    BOOST_REQUIRE(match_standard_script(to_script(SCRIPT_TEXT_PAY_MULTISIG)) ==
+        standard_script::pay_multisig);
+    BOOST_REQUIRE(match_standard_script(to_script(SCRIPT_TEXT_NULL_DATA)) ==
+        standard_script::null_data);
+    BOOST_REQUIRE(match_standard_script(to_script(SCRIPT_TEXT_NON_STANDARD)) ==
+        standard_script::non_standard);
+}
+
+BOOST_AUTO_TEST_CASE(script_text__match_standard_script__near_templates__non_standard)
+{
+    // A truncated key hash, more signatures than keys and no keys.
+    BOOST_REQUIRE(match_standard_script(to_script("76a91318c0bd8d1818f1bf99cb1df2269c645318ef7b88ac")) ==
+        standard_script::non_standard);
+    BOOST_REQUIRE(match_standard_script(to_script("532102aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa52ae")) ==
+        standard_script::non_standard);
+    BOOST_REQUIRE(match_standard_script(to_script("5151ae")) ==
+        standard_script::non_standard);
+    BOOST_REQUIRE(match_standard_script(to_script("")) ==
+        standard_script::non_standard);
+}
+
+BOOST_AUTO_TEST_CASE(script_text__match_standard_script__null_data_over_80_bytes__non_standard)
+{
+    const auto script = "6a4c51" + std::string(2 * 81, '0');
+    BOOST_REQUIRE(match_standard_script(to_script(script)) ==
+        standard_script::non_standard);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(script_text__append_script_text)
+
+BOOST_AUTO_TEST_CASE(script_text__append_script_text__templates__expected)
+{
+    BOOST_REQUIRE_EQUAL(to_text(SCRIPT_TEXT_PAY_KEY_HASH), SCRIPT_TEXT_PAY_KEY_HASH_TEXT);
+    BOOST_REQUIRE_EQUAL(to_text(SCRIPT_TEXT_PAY_SCRIPT_HASH), SCRIPT_TEXT_PAY_SCRIPT_HASH_TEXT);
+    BOOST_REQUIRE_EQUAL(to_text(SCRIPT_TEXT_PAY_MULTISIG), SCRIPT_TEXT_PAY_MULTISIG_TEXT);
+    BOOST_REQUIRE_EQUAL(to_text(SCRIPT_TEXT_NULL_DATA), SCRIPT_TEXT_NULL_DATA_TEXT);
+}
+
+BOOST_AUTO_TEST_CASE(script_text__append_script_text__non_standard__expected)
+{
+    BOOST_REQUIRE_EQUAL(to_text(SCRIPT_TEXT_NON_STANDARD), SCRIPT_TEXT_NON_STANDARD_TEXT);
+}
+
+BOOST_AUTO_TEST_CASE(script_text__append_script_text__non_minimal_push__prefixed)
+{
+    BOOST_REQUIRE_EQUAL(to_text("6a4c0568656c6c6f"), "return [1.68656c6c6f]");
+    BOOST_REQUIRE_EQUAL(to_text("4d0100ff"), "[2.ff]");
+    BOOST_REQUIRE_EQUAL(to_text("4c"), "<invalid>");
+}
+
+BOOST_AUTO_TEST_CASE(script_text__append_script_text__matches_script_to_string)
+{
+    const auto flags = machine::rule_fork::all_rules;
+    for (const auto& hexcode:
+    {
+        SCRIPT_TEXT_PAY_KEY_HASH, SCRIPT_TEXT_PAY_MULTISIG,
+        SCRIPT_TEXT_NULL_DATA, SCRIPT_TEXT_NON_STANDARD, "6a4c0568656c6c6f",
+        "00516093b1b2ba"
+    })
+    {
+        chain::script script;
+        BOOST_REQUIRE(script.from_data(to_script(hexcode), false));
+        BOOST_REQUIRE_EQUAL(to_text(hexcode), script.to_string(flags));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script_text__append_script_text__appends)
+{
+    std::string out("x ");
+    append_script_text(out, to_script(SCRIPT_TEXT_NULL_DATA));
+    BOOST_REQUIRE_EQUAL(out, "x " SCRIPT_TEXT_NULL_DATA_TEXT);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(script_text__append_script_data)
+
+BOOST_AUTO_TEST_CASE(script_text__append_script_data__round_trip__expected)
+{
+    std::string out;
+    BOOST_REQUIRE(to_data(out, SCRIPT_TEXT_PAY_KEY_HASH_TEXT));
+    BOOST_REQUIRE_EQUAL(out, SCRIPT_TEXT_PAY_KEY_HASH);
+    BOOST_REQUIRE(to_data(out, SCRIPT_TEXT_PAY_MULTISIG_TEXT));
+    BOOST_REQUIRE_EQUAL(out, SCRIPT_TEXT_PAY_MULTISIG);
+    BOOST_REQUIRE(to_data(out, " \t" SCRIPT_TEXT_NULL_DATA_TEXT "  "));
+    BOOST_REQUIRE_EQUAL(out, SCRIPT_TEXT_NULL_DATA);
+    BOOST_REQUIRE(to_data(out, "return [1.68656c6c6f]"));
+    BOOST_REQUIRE_EQUAL(out, "6a4c0568656c6c6f");
+}
+
+BOOST_AUTO_TEST_CASE(script_text__append_script_data__matches_script_from_string)
+{
+    const std::vector<std::string> texts
+    {
+        "zero [] [01] 17 -1 nop3 checklocktimeverify",
+        "DUP 'hello' [2.ff] [" + std::string(2 * 300, 'a') + "]"
+    };
+
+    for (const auto& text: texts)
+    {
+        chain::script script;
+        BOOST_REQUIRE(script.from_string(text));
+
+        std::string out;
+        BOOST_REQUIRE(to_data(out, text));
+        BOOST_REQUIRE_EQUAL(out, encode_base16(script.to_data(false)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(script_text__append_script_data__invalid__false_unchanged)
+{
+    data_chunk script{ 0x42 };
+    BOOST_REQUIRE(!append_script_data(script, data_slice(to_chunk(std::string("dup bogus")))));
+    BOOST_REQUIRE(!append_script_data(script, data_slice(to_chunk(std::string("[0g]")))));
+    BOOST_REQUIRE(!append_script_data(script, data_slice(to_chunk(std::string("<invalid>")))));
+    BOOST_REQUIRE_EQUAL(script.size(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
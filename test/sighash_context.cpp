@@ -0,0 +1,209 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+#include "benchmark.hpp"
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::explorer;
+
+// A pay-to-public-key-hash script for distinguishing inputs and outputs.
+static script make_script(size_t seed)
+{
+    short_hash hash = null_short_hash;
+    hash[0] = static_cast<uint8_t>(seed);
+    hash[1] = static_cast<uint8_t>(seed >> 8);
+    return script{ script::to_pay_key_hash_pattern(hash) };
+}
+
+// A tx with distinct prevouts, mixed sequences and distinct outputs.
+static tx_type make_tx(size_t inputs, size_t outputs)
+{
+    tx_type tx;
+    tx.set_version(1);
+    tx.set_locktime(42);
+
+    for (size_t index = 0; index < inputs; ++index)
+    {
+        auto hash = null_hash;
+        hash[0] = static_cast<uint8_t>(index);
+        hash[1] = static_cast<uint8_t>(index >> 8);
+        const auto point = output_point{ hash, static_cast<uint32_t>(index) };
+        const auto sequence = max_uint32 - static_cast<uint32_t>(index % 2);
+        tx.inputs().push_back(tx_input_type{ point, script{}, sequence });
+    }
+
+    for (size_t index = 0; index < outputs; ++index)
+        tx.outputs().push_back({ 1000 + index, make_script(index) });
+
+    return tx;
+}
+
+static const uint8_t sighash_types[] =
+{
+    machine::sighash_algorithm::all,
+    machine::sighash_algorithm::none,
+    machine::sighash_algorithm::single,
+    machine::sighash_algorithm::all |
+        machine::sighash_algorithm::anyone_can_pay,
+    machine::sighash_algorithm::none |
+        machine::sighash_algorithm::anyone_can_pay,
+    machine::sighash_algorithm::single |
+        machine::sighash_algorithm::anyone_can_pay
+};
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(sighash_context__signature_hash)
+
+BOOST_AUTO_TEST_CASE(sighash_context__signature_hash__all_types__matches_script)
+{
+    const auto tx = make_tx(5, 3);
+    const auto contract = make_script(42);
+    const sighash_context sighash(tx);
+    BOOST_REQUIRE_EQUAL(sighash.inputs(), 5u);
+
+    for (const auto type: sighash_types)
+    {
+        for (uint32_t index = 0; index < 5; ++index)
+        {
+            const auto expected = script::generate_signature_hash(tx, index,
+                contract, type);
+            const auto actual = sighash.signature_hash(index, contract, type);
+            BOOST_REQUIRE(actual == expected);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(sighash_context__signature_hash__single_without_output__matches_script)
+{
+    const auto tx = make_tx(3, 1);
+    const auto contract = make_script(42);
+    const sighash_context sighash(tx);
+    const uint8_t type = machine::sighash_algorithm::single;
+    const auto expected = script::generate_signature_hash(tx, 2, contract,
+        type);
+    BOOST_REQUIRE(sighash.signature_hash(2, contract, type) == expected);
+}
+
+BOOST_AUTO_TEST_CASE(sighash_context__signature_hash__index_out_of_range__matches_script)
+{
+    const auto tx = make_tx(2, 2);
+    const auto contract = make_script(42);
+    const sighash_context sighash(tx);
+    const uint8_t type = machine::sighash_algorithm::all;
+    const auto expected = script::generate_signature_hash(tx, 2, contract,
+        type);
+    BOOST_REQUIRE(sighash.signature_hash(2, contract, type) == expected);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(sighash_context__create_endorsement)
+
+BOOST_AUTO_TEST_CASE(sighash_context__create_endorsement__two_inputs__matches_script_and_checks)
+{
+    const auto tx = make_tx(2, 2);
+    const auto contract = make_script(42);
+    const sighash_context sighash(tx);
+    const uint8_t type = machine::sighash_algorithm::all;
+    const auto secret = base16_literal(
+        "ce8f4b713ffdd2658900845251890f30371856be201cd1f5b3d970f793634333");
+
+    ec_compressed point;
+    BOOST_REQUIRE(secret_to_public(point, secret));
+
+    for (uint32_t index = 0; index < 2; ++index)
+    {
+        endorsement expected;
+        BOOST_REQUIRE(script::create_endorsement(expected, secret, contract,
+            tx, index, type));
+
+        endorsement actual;
+        BOOST_REQUIRE(sighash.create_endorsement(actual, secret, contract,
+            index, type));
+        BOOST_REQUIRE(actual == expected);
+
+        ec_signature signature;
+        BOOST_REQUIRE(parse_signature(signature,
+            { actual.begin(), actual.end() - 1 }, false));
+        BOOST_REQUIRE(sighash.check_signature(signature, actual.back(),
+            point, contract, index));
+        BOOST_REQUIRE(!sighash.check_signature(signature, actual.back(),
+            point, contract, 1 - index));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
+
+// Timings for signature hashing of every input of a tx, in the manner of
+// tx-sign, against the rehash of the full tx by script for each input.
+BOOST_AUTO_TEST_SUITE(benchmark)
+BOOST_AUTO_TEST_SUITE(sighash_context__benchmark)
+
+static void benchmark_inputs(size_t inputs, uint8_t type)
+{
+    const auto tx = make_tx(inputs, 2);
+    const auto contract = make_script(42);
+    std::vector<hash_digest> expected(inputs);
+    std::vector<hash_digest> actual(inputs);
+
+    const auto script_start = benchmark_clock::now();
+    for (size_t index = 0; index < inputs; ++index)
+        expected[index] = script::generate_signature_hash(tx,
+            static_cast<uint32_t>(index), contract, type);
+
+    const auto script_time = microseconds_since(script_start);
+
+    // The context construction is included in its time.
+    const auto context_start = benchmark_clock::now();
+    const sighash_context sighash(tx);
+    for (size_t index = 0; index < inputs; ++index)
+        actual[index] = sighash.signature_hash(static_cast<uint32_t>(index),
+            contract, type);
+
+    const auto context_time = microseconds_since(context_start);
+    BOOST_REQUIRE(actual == expected);
+
+    BOOST_TEST_MESSAGE("inputs: " << inputs << " type: " <<
+        static_cast<uint32_t>(type) << " script: " << script_time / inputs <<
+        "us/input context: " << context_time / inputs << "us/input");
+}
+
+BOOST_AUTO_TEST_CASE(sighash_context__benchmark__all__125_to_1000_inputs)
+{
+    for (size_t inputs = 125; inputs <= 1000; inputs *= 2)
+        benchmark_inputs(inputs, machine::sighash_algorithm::all);
+}
+
+BOOST_AUTO_TEST_CASE(sighash_context__benchmark__all_anyone_can_pay__125_to_1000_inputs)
+{
+    for (size_t inputs = 125; inputs <= 1000; inputs *= 2)
+        benchmark_inputs(inputs, machine::sighash_algorithm::all |
+            machine::sighash_algorithm::anyone_can_pay);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,291 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+static hash_digest make_hash(uint8_t value)
+{
+    hash_digest hash{ { 0 } };
+    hash[0] = value;
+    return hash;
+}
+
+static chain::transaction make_tx(const hash_list& parents)
+{
+    chain::input::list inputs;
+    for (const auto& parent: parents)
+        inputs.emplace_back(chain::output_point{ parent, 0 }, chain::script{},
+            0);
+
+    return { 1, 0, inputs, {} };
+}
+
+// A server of confirmed heights and pool transactions, which completes the
+// queries in order when run, or as they are made if immediate.
+class fake_server
+{
+public:
+    explicit fake_server(bool immediate=false)
+      : immediate_(immediate), in_flight_(0), most_in_flight_(0),
+        index_queries_(0), tx_queries_(0)
+    {
+    }
+
+    void confirm(const hash_digest& hash, size_t height)
+    {
+        heights_[hash] = height;
+    }
+
+    void pool(const hash_digest& hash, const hash_list& parents)
+    {
+        pool_[hash] = make_tx(parents);
+    }
+
+    tx_ancestry::index_fetcher index_fetcher()
+    {
+        return [this](const hash_digest& hash,
+            tx_ancestry::index_handler handler)
+        {
+            ++index_queries_;
+            post([this, hash, handler]()
+            {
+                const auto it = heights_.find(hash);
+                if (it == heights_.end())
+                    handler(error::not_found, 0);
+                else
+                    handler(error::success, it->second);
+            });
+        };
+    }
+
+    tx_ancestry::transaction_fetcher transaction_fetcher()
+    {
+        return [this](const hash_digest& hash,
+            tx_ancestry::transaction_handler handler)
+        {
+            ++tx_queries_;
+            post([this, hash, handler]()
+            {
+                const auto it = pool_.find(hash);
+                if (it == pool_.end())
+                    handler(error::not_found, {});
+                else
+                    handler(error::success, it->second);
+            });
+        };
+    }
+
+    void run()
+    {
+        while (!queries_.empty())
+        {
+            const auto query = queries_.front();
+            queries_.pop_front();
+            --in_flight_;
+            query();
+        }
+    }
+
+    size_t most_in_flight() const
+    {
+        return most_in_flight_;
+    }
+
+    size_t index_queries() const
+    {
+        return index_queries_;
+    }
+
+    size_t tx_queries() const
+    {
+        return tx_queries_;
+    }
+
+private:
+    void post(std::function<void()> query)
+    {
+        ++in_flight_;
+        most_in_flight_ = std::max(most_in_flight_, in_flight_);
+
+        if (immediate_)
+        {
+            --in_flight_;
+            query();
+            return;
+        }
+
+        queries_.push_back(query);
+    }
+
+    const bool immediate_;
+    std::map<hash_digest, size_t> heights_;
+    std::map<hash_digest, chain::transaction> pool_;
+    std::deque<std::function<void()>> queries_;
+    size_t in_flight_;
+    size_t most_in_flight_;
+    size_t index_queries_;
+    size_t tx_queries_;
+};
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(tx_ancestry__start)
+
+BOOST_AUTO_TEST_CASE(tx_ancestry__start__confirmed__one_confirmed_ancestor)
+{
+    fake_server server;
+    server.confirm(make_hash(1), 42);
+    tx_ancestry ancestry(server.index_fetcher(), server.transaction_fetcher(),
+        8, 25);
+    ancestry.start(make_hash(1));
+    server.run();
+    BOOST_REQUIRE(ancestry.complete());
+    BOOST_REQUIRE(!ancestry.error());
+    const auto& ancestors = ancestry.ancestors();
+    BOOST_REQUIRE_EQUAL(ancestors.size(), 1u);
+    BOOST_REQUIRE(ancestors[0].hash == make_hash(1));
+    BOOST_REQUIRE(ancestors[0].confirmed);
+    BOOST_REQUIRE_EQUAL(ancestors[0].depth, 0u);
+    BOOST_REQUIRE_EQUAL(ancestors[0].height, 42u);
+    BOOST_REQUIRE(ancestors[0].parents.empty());
+    BOOST_REQUIRE_EQUAL(server.tx_queries(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_ancestry__start__unconfirmed_chain__stops_at_confirmed)
+{
+    fake_server server;
+    server.pool(make_hash(1), { make_hash(2) });
+    server.pool(make_hash(2), { make_hash(3) });
+    server.confirm(make_hash(3), 7);
+    tx_ancestry ancestry(server.index_fetcher(), server.transaction_fetcher(),
+        8, 25);
+    ancestry.start(make_hash(1));
+    server.run();
+    BOOST_REQUIRE(!ancestry.error());
+    const auto& ancestors = ancestry.ancestors();
+    BOOST_REQUIRE_EQUAL(ancestors.size(), 3u);
+    BOOST_REQUIRE(!ancestors[0].confirmed);
+    BOOST_REQUIRE(ancestors[0].parents == hash_list{ make_hash(2) });
+    BOOST_REQUIRE(!ancestors[1].confirmed);
+    BOOST_REQUIRE_EQUAL(ancestors[1].depth, 1u);
+    BOOST_REQUIRE(ancestors[1].parents == hash_list{ make_hash(3) });
+    BOOST_REQUIRE(ancestors[2].confirmed);
+    BOOST_REQUIRE_EQUAL(ancestors[2].depth, 2u);
+    BOOST_REQUIRE_EQUAL(ancestors[2].height, 7u);
+    BOOST_REQUIRE_EQUAL(server.tx_queries(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_ancestry__start__shared_ancestor__queried_once)
+{
+    fake_server server;
+    server.pool(make_hash(1), { make_hash(2), make_hash(3), make_hash(2) });
+    server.pool(make_hash(2), { make_hash(4) });
+    server.pool(make_hash(3), { make_hash(4) });
+    server.confirm(make_hash(4), 1);
+    tx_ancestry ancestry(server.index_fetcher(), server.transaction_fetcher(),
+        8, 25);
+    ancestry.start(make_hash(1));
+    server.run();
+    BOOST_REQUIRE(!ancestry.error());
+    const auto& ancestors = ancestry.ancestors();
+    BOOST_REQUIRE_EQUAL(ancestors.size(), 4u);
+    const hash_list parents{ make_hash(2), make_hash(3) };
+    BOOST_REQUIRE(ancestors[0].parents == parents);
+    BOOST_REQUIRE_EQUAL(server.index_queries(), 4u);
+    BOOST_REQUIRE_EQUAL(server.tx_queries(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_ancestry__start__depth_limit__parents_listed_not_queried)
+{
+    fake_server server;
+    server.pool(make_hash(1), { make_hash(2) });
+    server.pool(make_hash(2), { make_hash(3) });
+    server.pool(make_hash(3), { make_hash(4) });
+    tx_ancestry ancestry(server.index_fetcher(), server.transaction_fetcher(),
+        8, 1);
+    ancestry.start(make_hash(1));
+    server.run();
+    BOOST_REQUIRE(!ancestry.error());
+    const auto& ancestors = ancestry.ancestors();
+    BOOST_REQUIRE_EQUAL(ancestors.size(), 2u);
+    BOOST_REQUIRE(ancestors[1].hash == make_hash(2));
+    BOOST_REQUIRE(ancestors[1].parents == hash_list{ make_hash(3) });
+    BOOST_REQUIRE_EQUAL(server.index_queries(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_ancestry__start__many_parents__window_bounds_queries)
+{
+    fake_server server;
+    hash_list parents;
+    for (uint8_t value = 2; value < 12; ++value)
+    {
+        parents.push_back(make_hash(value));
+        server.confirm(make_hash(value), value);
+    }
+
+    server.pool(make_hash(1), parents);
+    tx_ancestry ancestry(server.index_fetcher(), server.transaction_fetcher(),
+        3, 25);
+    ancestry.start(make_hash(1));
+    server.run();
+    BOOST_REQUIRE(ancestry.complete());
+    BOOST_REQUIRE(!ancestry.error());
+    BOOST_REQUIRE_EQUAL(ancestry.ancestors().size(), 11u);
+    BOOST_REQUIRE_EQUAL(server.most_in_flight(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_ancestry__start__immediate_handlers__complete)
+{
+    fake_server server(true);
+    server.pool(make_hash(1), { make_hash(2), make_hash(3) });
+    server.pool(make_hash(2), { make_hash(3) });
+    server.confirm(make_hash(3), 5);
+    tx_ancestry ancestry(server.index_fetcher(), server.transaction_fetcher(),
+        2, 25);
+    ancestry.start(make_hash(1));
+    BOOST_REQUIRE(ancestry.complete());
+    BOOST_REQUIRE(!ancestry.error());
+    BOOST_REQUIRE_EQUAL(ancestry.ancestors().size(), 3u);
+    BOOST_REQUIRE_EQUAL(server.index_queries(), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_ancestry__start__missing_parent__not_found)
+{
+    fake_server server;
+    server.pool(make_hash(1), { make_hash(2) });
+    tx_ancestry ancestry(server.index_fetcher(), server.transaction_fetcher(),
+        8, 25);
+    ancestry.start(make_hash(1));
+    server.run();
+    BOOST_REQUIRE(ancestry.complete());
+    BOOST_REQUIRE(ancestry.error() == error::not_found);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
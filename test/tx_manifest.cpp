@@ -0,0 +1,134 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <string>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::chain;
+using namespace bc::explorer;
+
+#define TX_MANIFEST_HASH "97e06e49dfdd26c5a904670971ccf4c7fe7d9da53cb379bf9b442fc9427080b3"
+#define TX_MANIFEST_ADDRESS "13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe"
+#define TX_MANIFEST_SCRIPT_ADDRESS "3CMNFxN1oHBc4R1EpboAL5yzHGgE611Xou"
+#define TX_MANIFEST_SCRIPT "76a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac"
+
+static bool read_manifest(transaction& tx, size_t& invalid,
+    const std::string& manifest)
+{
+    return read_tx_manifest(tx, invalid, to_chunk(manifest), 5);
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(tx_manifest__read_tx_manifest)
+
+BOOST_AUTO_TEST_CASE(tx_manifest__read_tx_manifest__empty__true_empty)
+{
+    transaction tx;
+    size_t invalid;
+    BOOST_REQUIRE(read_manifest(tx, invalid, "# nothing\n\n"));
+    BOOST_REQUIRE(tx.inputs().empty());
+    BOOST_REQUIRE(tx.outputs().empty());
+}
+
+BOOST_AUTO_TEST_CASE(tx_manifest__read_tx_manifest__csv__true_expected)
+{
+    transaction tx;
+    size_t invalid;
+    BOOST_REQUIRE(read_manifest(tx, invalid,
+        "input," TX_MANIFEST_HASH ",1\n"
+        " input , " TX_MANIFEST_HASH " , 2 , 7 \r\n"
+        "output," TX_MANIFEST_ADDRESS ",90000\n"
+        "output," TX_MANIFEST_SCRIPT_ADDRESS ",5\n"
+        "output," TX_MANIFEST_SCRIPT ",0"));
+
+    BOOST_REQUIRE_EQUAL(tx.inputs().size(), 2u);
+    BOOST_REQUIRE_EQUAL(encode_hash(tx.inputs()[0].previous_output().hash()), TX_MANIFEST_HASH);
+    BOOST_REQUIRE_EQUAL(tx.inputs()[0].previous_output().index(), 1u);
+    BOOST_REQUIRE_EQUAL(tx.inputs()[0].sequence(), max_input_sequence);
+    BOOST_REQUIRE_EQUAL(tx.inputs()[1].previous_output().index(), 2u);
+    BOOST_REQUIRE_EQUAL(tx.inputs()[1].sequence(), 7u);
+
+    BOOST_REQUIRE_EQUAL(tx.outputs().size(), 3u);
+    BOOST_REQUIRE_EQUAL(tx.outputs()[0].value(), 90000u);
+    BOOST_REQUIRE_EQUAL(encode_base16(tx.outputs()[0].script().to_data(false)), TX_MANIFEST_SCRIPT);
+    BOOST_REQUIRE(tx.outputs()[1].script().pattern() == machine::script_pattern::pay_script_hash);
+    BOOST_REQUIRE_EQUAL(encode_base16(tx.outputs()[2].script().to_data(false)), TX_MANIFEST_SCRIPT);
+}
+
+BOOST_AUTO_TEST_CASE(tx_manifest__read_tx_manifest__json__true_expected)
+{
+    transaction tx;
+    size_t invalid;
+    BOOST_REQUIRE(read_manifest(tx, invalid,
+        "{\"hash\": \"" TX_MANIFEST_HASH "\", \"index\": 1, \"sequence\": \"7\"}\n"
+        "{ \"amount\": 90000, \"target\": \"" TX_MANIFEST_ADDRESS "\" }\n"));
+
+    BOOST_REQUIRE_EQUAL(tx.inputs().size(), 1u);
+    BOOST_REQUIRE_EQUAL(tx.inputs()[0].previous_output().index(), 1u);
+    BOOST_REQUIRE_EQUAL(tx.inputs()[0].sequence(), 7u);
+    BOOST_REQUIRE_EQUAL(tx.outputs().size(), 1u);
+    BOOST_REQUIRE_EQUAL(tx.outputs()[0].value(), 90000u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_manifest__read_tx_manifest__appended__true_following)
+{
+    transaction tx;
+    tx.outputs().push_back({ 1, script{} });
+
+    size_t invalid;
+    BOOST_REQUIRE(read_manifest(tx, invalid, "output," TX_MANIFEST_ADDRESS ",2"));
+    BOOST_REQUIRE_EQUAL(tx.outputs().size(), 2u);
+    BOOST_REQUIRE_EQUAL(tx.outputs()[1].value(), 2u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_manifest__read_tx_manifest__invalid_lines__false_line)
+{
+    const std::string invalid_lines[] =
+    {
+        "input," TX_MANIFEST_HASH,
+        "input," TX_MANIFEST_HASH ",1,2,3",
+        "input," TX_MANIFEST_HASH ",4294967296",
+        "input,97e06e49,1",
+        "output," TX_MANIFEST_ADDRESS ",2100000000000001",
+        "output,not-a-target,1",
+        "other,1,2",
+        "{\"hash\": \"" TX_MANIFEST_HASH "\", \"index\": 1, \"amount\": 1}",
+        "{\"hash\": \"" TX_MANIFEST_HASH "\", \"hash\": \"" TX_MANIFEST_HASH "\", \"index\": 1}",
+        "{\"target\": \"" TX_MANIFEST_ADDRESS "\"}",
+        "{\"target\": \"" TX_MANIFEST_ADDRESS "\", \"amount\": 1} trailing",
+        "{\"other\": 1}",
+        "{}"
+    };
+
+    for (const auto& line: invalid_lines)
+    {
+        transaction tx;
+        size_t invalid;
+        BOOST_REQUIRE(!read_manifest(tx, invalid,
+            "output," TX_MANIFEST_ADDRESS ",1\n\n" + line));
+        BOOST_REQUIRE_EQUAL(invalid, 3u);
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,128 @@
+/**
+ * Copyright (c) 2011-2015 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin-explorer.
+ *
+ * libbitcoin-explorer is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Affero General Public License with
+ * additional permissions to the one published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option)
+ * any later version. For more information see LICENSE.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstddef>
+#include <vector>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test_suite.hpp>
+#include <bitcoin/explorer.hpp>
+
+using namespace bc;
+using namespace bc::explorer;
+
+// The script size of a pay-to-key-hash output.
+static const std::vector<size_t> pay_key_hash_output{ 25 };
+
+static input_script_type make_type(const std::string& token)
+{
+    input_script_type type;
+    BOOST_REQUIRE(parse_input_script_type(type, token));
+    return type;
+}
+
+BOOST_AUTO_TEST_SUITE(offline)
+BOOST_AUTO_TEST_SUITE(tx_size__parse_input_script_type)
+
+BOOST_AUTO_TEST_CASE(tx_size__parse_input_script_type__multisig__true_counts)
+{
+    const auto type = make_type("p2sh-multisig:2:3");
+    BOOST_REQUIRE(type.script == input_script::pay_script_hash_multisig);
+    BOOST_REQUIRE_EQUAL(type.signatures, 2u);
+    BOOST_REQUIRE_EQUAL(type.keys, 3u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_size__parse_input_script_type__invalid__false)
+{
+    input_script_type type;
+    BOOST_REQUIRE(!parse_input_script_type(type, "p2wsh"));
+    BOOST_REQUIRE(!parse_input_script_type(type, "p2sh-multisig:3:2"));
+    BOOST_REQUIRE(!parse_input_script_type(type, "p2sh-multisig:0:2"));
+    BOOST_REQUIRE(!parse_input_script_type(type, "p2sh-multisig:2:17"));
+    BOOST_REQUIRE(!parse_input_script_type(type, "p2sh-multisig:a:2"));
+    BOOST_REQUIRE(!parse_input_script_type(type, "p2sh-multisig:2"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(tx_size__estimate_tx_size)
+
+BOOST_AUTO_TEST_CASE(tx_size__estimate_tx_size__pay_key_hash__expected)
+{
+    const auto size = estimate_tx_size({ make_type("p2pkh") },
+        pay_key_hash_output);
+    BOOST_REQUIRE_EQUAL(size.size, 193u);
+    BOOST_REQUIRE_EQUAL(size.weight, 772u);
+    BOOST_REQUIRE_EQUAL(size.virtual_size, 193u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_size__estimate_tx_size__multisig__expected)
+{
+    const auto size = estimate_tx_size({ make_type("p2sh-multisig:2:3") },
+        pay_key_hash_output);
+    BOOST_REQUIRE_EQUAL(size.size, 343u);
+    BOOST_REQUIRE_EQUAL(size.virtual_size, 343u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_size__estimate_tx_size__witness_key_hash__expected)
+{
+    const auto size = estimate_tx_size({ make_type("p2wpkh") },
+        pay_key_hash_output);
+    BOOST_REQUIRE_EQUAL(size.size, 196u);
+    BOOST_REQUIRE_EQUAL(size.weight, 451u);
+    BOOST_REQUIRE_EQUAL(size.virtual_size, 113u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_size__estimate_tx_size__mixed_witness__expected)
+{
+    const auto size = estimate_tx_size(
+        { make_type("p2pkh"), make_type("p2sh-p2wpkh") },
+        pay_key_hash_output);
+    BOOST_REQUIRE_EQUAL(size.size, 369u);
+    BOOST_REQUIRE_EQUAL(size.weight, 1140u);
+    BOOST_REQUIRE_EQUAL(size.virtual_size, 285u);
+}
+
+BOOST_AUTO_TEST_CASE(tx_size__estimate_tx_size__signed_pay_key_hash__not_less_than_serialized)
+{
+    // The signed tx of the tx-sign tests, with a 71 byte signature.
+    data_chunk decoded;
+    BOOST_REQUIRE(decode_base16(decoded, "0100000001b3807042c92f449bbf79b33ca59d7dfec7f4cc71096704a9c526dddf496ee097010000006a473044022016516aabd04d3b27bec799bbadc55bad447db1e4bb663a32ed8ff6c6b7b6752602203651316e363b8c41c1b9db050690c6e5e9540ad04ded69184e710197734d3cf6012103c40cbd64c9c608df2c9730f49b0888c4db1c436e8b2b74aead6c6afbd10428c0ffffffff01905f0100000000001976a91418c0bd8d1818f1bf99cb1df2269c645318ef7b7388ac00000000"));
+
+    const auto size = estimate_tx_size({ make_type("p2pkh") },
+        pay_key_hash_output);
+    BOOST_REQUIRE_GE(size.size, decoded.size());
+    BOOST_REQUIRE_LE(size.size, decoded.size() + 2u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE(tx_size__append_script_sizes)
+
+BOOST_AUTO_TEST_CASE(tx_size__append_script_sizes__outputs__expected)
+{
+    std::vector<size_t> sizes;
+    append_script_sizes(sizes, { "13Ft7SkreJY9D823NPm4t6D1cBqLYTJtAe:1" }, 5);
+    append_script_sizes(sizes, { "3CMNFxN1oHBc4R1EpboAL5yzHGgE611Xou:1" }, 5);
+    append_script_sizes(sizes, { "6a0142:0" }, 5);
+    append_script_sizes(sizes, { "hfFGUXFPKkQ5M6LC6aEUKMsURdhw93bUdYdacEtBA8XttLv7evZkira2i:42:baadf00dbaadf00dbaadf00dbaadf00d" }, 5);
+    BOOST_REQUIRE(sizes == std::vector<size_t>({ 25, 23, 3, 58, 25 }));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+BOOST_AUTO_TEST_SUITE_END()